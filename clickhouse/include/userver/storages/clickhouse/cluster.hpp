@@ -28,6 +28,9 @@ namespace impl {
 struct ClickhouseSettings;
 }
 
+template <typename Row>
+class InsertBuffer;
+
 /// @ingroup userver_clients
 ///
 /// @brief Interface for executing queries on a cluster of ClickHouse servers.
@@ -60,6 +63,30 @@ class Cluster final {
   ExecutionResult Execute(OptionalCommandControl, const Query& query,
                           const Args&... args) const;
 
+  /// @brief Execute a statement at some host of the cluster with args as
+  /// query parameters, passing every block of the result to `callback` as
+  /// soon as it arrives.
+  ///
+  /// Unlike Execute, the result is never accumulated, so the memory is
+  /// bounded by the size of a single block. Use ExecutionResult::AsRows or
+  /// the column views of a block to process it.
+  ///
+  /// @note `callback` is called while the connection is held and the
+  /// `execute` timeout is ticking, avoid doing long work in it. If the
+  /// callback throws, the query is aborted and the exception is rethrown.
+  template <typename... Args>
+  void ExecuteStreaming(const ResultBlockCallback& callback,
+                        const Query& query, const Args&... args) const;
+
+  /// @brief Execute a statement with specified command control settings at
+  /// some host of the cluster with args as query parameters, passing every
+  /// block of the result to `callback` as soon as it arrives.
+  /// See the overload without command control for details.
+  template <typename... Args>
+  void ExecuteStreaming(OptionalCommandControl,
+                        const ResultBlockCallback& callback, const Query& query,
+                        const Args&... args) const;
+
   /// @brief Insert data at some host of the cluster;
   /// `T` is expected to be a struct of vectors of same length.
   /// @param table_name table to insert into
@@ -126,11 +153,17 @@ class Cluster final {
   };
 
  private:
+  template <typename Row>
+  friend class InsertBuffer;
+
   void DoInsert(OptionalCommandControl,
                 const impl::InsertionRequest& request) const;
 
   ExecutionResult DoExecute(OptionalCommandControl, const Query& query) const;
 
+  void DoExecuteStreaming(OptionalCommandControl, const Query& query,
+                          const ResultBlockCallback& callback) const;
+
   const impl::Pool& GetPool() const;
 
   std::vector<impl::Pool> pools_;
@@ -189,6 +222,20 @@ ExecutionResult Cluster::Execute(OptionalCommandControl optional_cc,
   return DoExecute(optional_cc, formatted_query);
 }
 
+template <typename... Args>
+void Cluster::ExecuteStreaming(const ResultBlockCallback& callback,
+                               const Query& query, const Args&... args) const {
+  ExecuteStreaming(OptionalCommandControl{}, callback, query, args...);
+}
+
+template <typename... Args>
+void Cluster::ExecuteStreaming(OptionalCommandControl optional_cc,
+                               const ResultBlockCallback& callback,
+                               const Query& query, const Args&... args) const {
+  const auto formatted_query = query.WithArgs(args...);
+  DoExecuteStreaming(optional_cc, formatted_query, callback);
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -3,12 +3,14 @@
 /// @file userver/storages/clickhouse/execution_result.hpp
 /// @brief Result accessor.
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
 #include <boost/pfr/core.hpp>
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+#include <userver/storages/clickhouse/io/columns/column_view.hpp>
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
 #include <userver/storages/clickhouse/io/result_mapper.hpp>
@@ -57,10 +59,25 @@ class ExecutionResult final {
   template <typename Container>
   Container AsContainer() &&;
 
+  /// Returns a view over the memory of the numeric column at `index`,
+  /// no data is copied.
+  /// @throws std::runtime_error if the column does not hold `T`
+  template <typename T>
+  io::columns::NumericColumnView<T> GetNumericColumn(size_t index) const;
+
+  /// Returns a view over the memory of the FixedString column at `index`,
+  /// no data is copied.
+  /// @throws std::runtime_error if the column is not a FixedString one
+  io::columns::FixedStringColumnView GetFixedStringColumn(size_t index) const;
+
  private:
   impl::BlockWrapperPtr block_;
 };
 
+/// @brief Receives blocks of a result one by one, see
+/// storages::clickhouse::Cluster::ExecuteStreaming
+using ResultBlockCallback = std::function<void(ExecutionResult&& block)>;
+
 template <typename T>
 T ExecutionResult::As() && {
   UASSERT(block_);
@@ -100,6 +117,14 @@ Container ExecutionResult::AsContainer() && {
   return result;
 }
 
+template <typename T>
+io::columns::NumericColumnView<T> ExecutionResult::GetNumericColumn(
+    size_t index) const {
+  UASSERT(block_);
+  return io::columns::NumericColumnView<T>{
+      io::columns::GetWrappedColumn(*block_, index)};
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
@@ -8,6 +8,7 @@
 #include <userver/utils/assert.hpp>
 
 #include <userver/storages/clickhouse/impl/block_wrapper_fwd.hpp>
+#include <userver/storages/clickhouse/impl/rows_columns_builder.hpp>
 #include <userver/storages/clickhouse/io/impl/validate.hpp>
 
 #include <userver/storages/clickhouse/io/columns/array_column.hpp>
@@ -36,6 +37,12 @@ class InsertionRequest final {
       const std::string& table_name,
       const std::vector<std::string_view>& column_names, const Container& data);
 
+  template <typename Row>
+  static InsertionRequest CreateFromColumns(
+      const std::string& table_name,
+      const std::vector<std::string_view>& column_names,
+      const RowsColumnsBuilder<Row>& data);
+
   const std::string& GetTableName() const;
 
   const impl::BlockWrapper& GetBlock() const;
@@ -92,6 +99,17 @@ class InsertionRequest final {
     const Container& data_;
   };
 
+  template <typename MappedType, typename Columns, size_t... I>
+  static void AppendColumns(impl::BlockWrapper& block,
+                            const std::vector<std::string_view>& column_names,
+                            const Columns& columns, std::index_sequence<I...>) {
+    (io::columns::AppendWrappedColumn(
+         block,
+         std::tuple_element_t<I, MappedType>::Serialize(std::get<I>(columns)),
+         column_names[I], I),
+     ...);
+  }
+
   const std::string& table_name_;
   const std::vector<std::string_view>& column_names_;
 
@@ -136,6 +154,23 @@ InsertionRequest InsertionRequest::CreateFromRows(
   return request;
 }
 
+template <typename Row>
+InsertionRequest InsertionRequest::CreateFromColumns(
+    const std::string& table_name,
+    const std::vector<std::string_view>& column_names,
+    const RowsColumnsBuilder<Row>& data) {
+  io::impl::ValidateColumnsCount<Row>(column_names.size());
+
+  UINVARIANT(!data.Empty(), "An attempt to insert empty chunk of data");
+
+  InsertionRequest request{table_name, column_names};
+  using Builder = RowsColumnsBuilder<Row>;
+  AppendColumns<typename Builder::MappedType>(
+      *request.block_, request.column_names_, data.GetColumns(),
+      std::make_index_sequence<Builder::kColumnsCount>{});
+  return request;
+}
+
 }  // namespace storages::clickhouse::impl
 
 USERVER_NAMESPACE_END
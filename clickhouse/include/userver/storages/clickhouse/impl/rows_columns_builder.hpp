@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/pfr/core.hpp>
+
+#include <userver/storages/clickhouse/io/impl/validate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::impl {
+
+/// Accumulates rows of a clickhouse-mapped `Row` directly into columns, so
+/// that they are serialized into a block without an intermediate copy.
+template <typename Row>
+class RowsColumnsBuilder final {
+ public:
+  using MappedType = io::impl::MappedType<Row>;
+
+  static constexpr std::size_t kColumnsCount =
+      io::impl::kClickhouseTypeColumnsCount<Row>;
+
+ private:
+  template <std::size_t... I>
+  static auto MakeColumns(std::index_sequence<I...>)
+      -> std::tuple<std::vector<io::impl::ClickhouseType<I, Row>>...>;
+
+ public:
+  using Columns =
+      decltype(MakeColumns(std::make_index_sequence<kColumnsCount>{}));
+
+  RowsColumnsBuilder() { io::impl::ValidateRowsMapping<Row>(); }
+
+  void Append(const Row& row) {
+    boost::pfr::for_each_field(row, [this](const auto& field, auto index) {
+      std::get<decltype(index)::value>(columns_).push_back(field);
+    });
+    ++size_;
+  }
+
+  /// Moves all the rows of `other` to the end of this builder
+  void Append(RowsColumnsBuilder&& other) {
+    if (other.size_ == 0) return;
+    if (size_ == 0) {
+      std::swap(columns_, other.columns_);
+      std::swap(size_, other.size_);
+      return;
+    }
+
+    AppendColumns(std::move(other.columns_),
+                  std::make_index_sequence<kColumnsCount>{});
+    size_ += other.size_;
+    other.Clear();
+  }
+
+  std::size_t Size() const noexcept { return size_; }
+
+  bool Empty() const noexcept { return size_ == 0; }
+
+  void Clear() noexcept {
+    std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+    size_ = 0;
+  }
+
+  const Columns& GetColumns() const noexcept { return columns_; }
+
+ private:
+  template <std::size_t... I>
+  void AppendColumns(Columns&& other, std::index_sequence<I...>) {
+    (std::get<I>(columns_).insert(
+         std::get<I>(columns_).end(),
+         std::make_move_iterator(std::get<I>(other).begin()),
+         std::make_move_iterator(std::get<I>(other).end())),
+     ...);
+  }
+
+  Columns columns_;
+  std::size_t size_{0};
+};
+
+}  // namespace storages::clickhouse::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,248 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/insert_buffer.hpp
+/// @brief @copybrief storages::clickhouse::InsertBuffer
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/formats/parse/to.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/impl/insertion_request.hpp>
+#include <userver/storages/clickhouse/impl/rows_columns_builder.hpp>
+#include <userver/storages/clickhouse/options.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+// clang-format off
+
+/// @brief Settings of storages::clickhouse::InsertBuffer
+///
+/// ## Static options:
+/// Name             | Description                                          | Default value
+/// ---------------- | ---------------------------------------------------- | -------------
+/// flush_rows       | buffered rows count that triggers a flush            | 10000
+/// flush_interval   | max time rows spend in the buffer                    | 1s
+/// max_pending_rows | rows that may be buffered or being inserted at once  | 100000
+/// insert_timeout   | timeout of a single insert, cluster default if unset | -
+
+// clang-format on
+struct InsertBufferSettings final {
+  std::size_t flush_rows{10'000};
+  std::chrono::milliseconds flush_interval{1000};
+  std::size_t max_pending_rows{100'000};
+  OptionalCommandControl command_control{};
+};
+
+InsertBufferSettings Parse(const yaml_config::YamlConfig& config,
+                           formats::parse::To<InsertBufferSettings>);
+
+namespace impl {
+
+struct InsertBufferStatistics final {
+  using Counter = USERVER_NAMESPACE::utils::statistics::RelaxedCounter<
+      std::uint64_t>;
+
+  Counter rows_pushed{};
+  Counter rows_dropped{};
+  Counter rows_inserted{};
+  Counter rows_failed{};
+  Counter flushes{};
+  Counter flush_errors{};
+  std::atomic<std::size_t> pending_rows{0};
+};
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const InsertBufferStatistics& stats);
+
+}  // namespace impl
+
+/// @ingroup userver_clients
+///
+/// @brief Accumulates rows pushed from many tasks and inserts them into a
+/// table in large blocks.
+///
+/// `Row` is expected to be a clickhouse-mapped type, the same as the
+/// `Container::value_type` of Cluster::InsertRows. Rows are appended directly
+/// into columns, so a flush serializes them into a native block without the
+/// extra copy made by Cluster::InsertRows.
+///
+/// Rows are flushed in the background once `flush_rows` of them are buffered
+/// or `flush_interval` elapses, whichever comes first. Blocks are compressed
+/// according to the `compression` option of the components::ClickHouse.
+///
+/// TryPush refuses rows while `max_pending_rows` rows are buffered or are
+/// being inserted, that is the backpressure signal for the callers. Rows of a
+/// failed insert are dropped and accounted in the statistics.
+///
+/// The remaining rows are flushed on destruction.
+template <typename Row>
+class InsertBuffer final {
+ public:
+  /// @param cluster cluster to insert into
+  /// @param table_name table to insert into
+  /// @param column_names names of columns of the table
+  /// @param settings flush and backpressure settings
+  InsertBuffer(ClusterPtr cluster, std::string table_name,
+               std::vector<std::string> column_names,
+               InsertBufferSettings settings);
+
+  InsertBuffer(const InsertBuffer&) = delete;
+  InsertBuffer& operator=(const InsertBuffer&) = delete;
+
+  ~InsertBuffer();
+
+  /// @brief Buffers the row.
+  /// @returns false if the row was dropped because of too many pending rows
+  [[nodiscard]] bool TryPush(const Row& row);
+
+  /// @brief Synchronously inserts all the buffered rows
+  void Flush();
+
+  /// @brief Rows that are buffered or are being inserted
+  std::size_t GetPendingRowsApprox() const noexcept;
+
+  /// Write buffer statistics
+  void WriteStatistics(
+      USERVER_NAMESPACE::utils::statistics::Writer& writer) const;
+
+ private:
+  // Tasks running on the same worker thread share a shard, so pushes from
+  // different threads rarely contend
+  static constexpr std::size_t kShardsCount = 16;
+
+  using Builder = impl::RowsColumnsBuilder<Row>;
+  using Shard = concurrent::Variable<Builder, std::mutex>;
+
+  Shard& GetCurrentShard();
+
+  const ClusterPtr cluster_;
+  const std::string table_name_;
+  const std::vector<std::string> column_names_;
+  const std::vector<std::string_view> column_names_views_;
+  const InsertBufferSettings settings_;
+
+  std::array<Shard, kShardsCount> shards_;
+  std::atomic<std::size_t> buffered_rows_{0};
+  impl::InsertBufferStatistics stats_;
+
+  engine::Mutex flush_mutex_;
+  USERVER_NAMESPACE::utils::PeriodicTask flush_task_;
+};
+
+template <typename Row>
+InsertBuffer<Row>::InsertBuffer(ClusterPtr cluster, std::string table_name,
+                                std::vector<std::string> column_names,
+                                InsertBufferSettings settings)
+    : cluster_(std::move(cluster)),
+      table_name_(std::move(table_name)),
+      column_names_(std::move(column_names)),
+      column_names_views_(column_names_.begin(), column_names_.end()),
+      settings_(std::move(settings)) {
+  UINVARIANT(cluster_, "InsertBuffer requires a cluster");
+  UINVARIANT(settings_.flush_rows > 0, "flush_rows must be positive");
+  io::impl::ValidateColumnsCount<Row>(column_names_views_.size());
+
+  flush_task_.Start("clickhouse_insert_buffer_" + table_name_,
+                    settings_.flush_interval, [this] { Flush(); });
+}
+
+template <typename Row>
+InsertBuffer<Row>::~InsertBuffer() {
+  flush_task_.Stop();
+  Flush();
+}
+
+template <typename Row>
+bool InsertBuffer<Row>::TryPush(const Row& row) {
+  auto pending = stats_.pending_rows.load();
+  do {
+    if (pending >= settings_.max_pending_rows) {
+      ++stats_.rows_dropped;
+      return false;
+    }
+  } while (!stats_.pending_rows.compare_exchange_weak(pending, pending + 1));
+
+  std::size_t buffered_rows = 0;
+  {
+    auto builder = GetCurrentShard().Lock();
+    builder->Append(row);
+    // under the lock, so that Flush never subtracts a row not counted yet
+    buffered_rows = buffered_rows_.fetch_add(1) + 1;
+  }
+  ++stats_.rows_pushed;
+
+  // rows pushed while a flush is in progress may jump past the limit, so
+  // every push over it wakes the flusher up
+  if (buffered_rows >= settings_.flush_rows) {
+    flush_task_.ForceStepAsync();
+  }
+  return true;
+}
+
+template <typename Row>
+void InsertBuffer<Row>::Flush() {
+  const std::lock_guard lock(flush_mutex_);
+
+  Builder block;
+  for (auto& shard : shards_) {
+    auto builder = shard.Lock();
+    block.Append(std::move(*builder));
+  }
+  if (block.Empty()) return;
+
+  const auto rows_count = block.Size();
+  buffered_rows_ -= rows_count;
+  ++stats_.flushes;
+  try {
+    const auto request = impl::InsertionRequest::CreateFromColumns(
+        table_name_, column_names_views_, block);
+    cluster_->DoInsert(settings_.command_control, request);
+    stats_.rows_inserted += rows_count;
+  } catch (const std::exception& ex) {
+    ++stats_.flush_errors;
+    stats_.rows_failed += rows_count;
+    LOG_ERROR() << "Failed to insert " << rows_count << " buffered rows into '"
+                << table_name_ << "': " << ex;
+  }
+  stats_.pending_rows -= rows_count;
+}
+
+template <typename Row>
+std::size_t InsertBuffer<Row>::GetPendingRowsApprox() const noexcept {
+  return stats_.pending_rows.load();
+}
+
+template <typename Row>
+void InsertBuffer<Row>::WriteStatistics(
+    USERVER_NAMESPACE::utils::statistics::Writer& writer) const {
+  writer.ValueWithLabels(stats_, {"clickhouse_table", table_name_});
+}
+
+template <typename Row>
+typename InsertBuffer<Row>::Shard& InsertBuffer<Row>::GetCurrentShard() {
+  const auto hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return shards_[hash % kShardsCount];
+}
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,91 @@
+#pragma once
+
+/// @file userver/storages/clickhouse/io/columns/column_view.hpp
+/// @brief Non-owning typed views over the columns of a result block
+/// @ingroup userver_clickhouse_types
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <userver/storages/clickhouse/io/columns/column_wrapper.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+/// @brief Represents a numeric ClickHouse column as a contiguous range of `T`
+/// without copying it.
+///
+/// Supported `T` are std::(u)int8_t ... std::(u)int64_t, float and double.
+/// The view holds a reference to the column, so it stays valid after the
+/// ExecutionResult it was taken from is destroyed.
+template <typename T>
+class NumericColumnView final {
+ public:
+  using value_type = T;
+  using iterator = const T*;
+
+  /// @throws std::runtime_error if `column` is not a column of `T`
+  explicit NumericColumnView(ColumnRef column);
+
+  iterator begin() const noexcept { return data_; }
+  iterator end() const noexcept { return data_ + size_; }
+
+  const T* Data() const noexcept { return data_; }
+  std::size_t Size() const noexcept { return size_; }
+
+  const T& operator[](std::size_t index) const noexcept {
+    UASSERT(index < size_);
+    return data_[index];
+  }
+
+ private:
+  ColumnRef column_;
+  const T* data_{nullptr};
+  std::size_t size_{0};
+};
+
+extern template class NumericColumnView<std::uint8_t>;
+extern template class NumericColumnView<std::uint16_t>;
+extern template class NumericColumnView<std::uint32_t>;
+extern template class NumericColumnView<std::uint64_t>;
+extern template class NumericColumnView<std::int8_t>;
+extern template class NumericColumnView<std::int16_t>;
+extern template class NumericColumnView<std::int32_t>;
+extern template class NumericColumnView<std::int64_t>;
+extern template class NumericColumnView<float>;
+extern template class NumericColumnView<double>;
+
+/// @brief Represents a ClickHouse FixedString(N) column as a range of
+/// std::string_view over the column memory.
+///
+/// The view holds a reference to the column, so it stays valid after the
+/// ExecutionResult it was taken from is destroyed.
+class FixedStringColumnView final {
+ public:
+  /// @throws std::runtime_error if `column` is not a FixedString column
+  explicit FixedStringColumnView(ColumnRef column);
+
+  std::size_t Size() const noexcept { return size_; }
+
+  /// Returns N of FixedString(N)
+  std::size_t GetFixedSize() const noexcept { return fixed_size_; }
+
+  /// Values are not trimmed, shorter strings are padded with zero bytes
+  std::string_view operator[](std::size_t index) const noexcept {
+    UASSERT(index < size_);
+    return {data_ + index * fixed_size_, fixed_size_};
+  }
+
+ private:
+  ColumnRef column_;
+  const char* data_{nullptr};
+  std::size_t size_{0};
+  std::size_t fixed_size_{0};
+};
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
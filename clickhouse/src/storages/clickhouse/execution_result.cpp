@@ -19,6 +19,13 @@ size_t ExecutionResult::GetColumnsCount() const {
 
 size_t ExecutionResult::GetRowsCount() const { return block_->GetRowsCount(); }
 
+io::columns::FixedStringColumnView ExecutionResult::GetFixedStringColumn(
+    size_t index) const {
+  UASSERT(block_);
+  return io::columns::FixedStringColumnView{
+      io::columns::GetWrappedColumn(*block_, index)};
+}
+
 }  // namespace storages::clickhouse
 
 USERVER_NAMESPACE_END
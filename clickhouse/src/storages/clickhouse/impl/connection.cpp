@@ -104,6 +104,31 @@ ExecutionResult Connection::Execute(OptionalCommandControl optional_cc,
   return ExecutionResult{BlockWrapperPtr{result_ptr.release()}};
 }
 
+void Connection::ExecuteStreaming(OptionalCommandControl optional_cc,
+                                  const Query& query,
+                                  const ResultBlockCallback& callback) {
+  clickhouse_cpp::Query native_query{query.QueryText()};
+  native_query.OnDataCancelable([]([[maybe_unused]] const auto& block) {
+    // we must return 'true' if we don't want to cancel query
+    return !engine::current_task::ShouldCancel();
+  });
+
+  auto& span = tracing::Span::CurrentSpan();
+  auto scope = span.CreateScopeTime(scopes::kExec);
+
+  // blocks share the columns with the client, nothing is copied. An exception
+  // from the callback aborts the query and breaks the connection.
+  native_query.OnData([&callback, &scope](const NativeBlock& data) {
+    scope.Reset(scopes::kExec);
+    if (data.GetColumnCount() == 0 || data.GetRowCount() == 0) return;
+
+    callback(ExecutionResult{
+        BlockWrapperPtr{new BlockWrapper{NativeBlock{data}}}});
+  });
+
+  DoExecute(optional_cc, native_query);
+}
+
 void Connection::Insert(OptionalCommandControl optional_cc,
                         const InsertionRequest& request) {
   const auto& block = request.GetBlock();
@@ -0,0 +1,47 @@
+#include <userver/storages/clickhouse/insert_buffer.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse {
+
+InsertBufferSettings Parse(const yaml_config::YamlConfig& config,
+                           formats::parse::To<InsertBufferSettings>) {
+  InsertBufferSettings result;
+  result.flush_rows = config["flush_rows"].As<std::size_t>(result.flush_rows);
+  result.flush_interval =
+      config["flush_interval"].As<std::chrono::milliseconds>(
+          result.flush_interval);
+  result.max_pending_rows =
+      config["max_pending_rows"].As<std::size_t>(result.max_pending_rows);
+
+  const auto insert_timeout =
+      config["insert_timeout"].As<std::optional<std::chrono::milliseconds>>();
+  if (insert_timeout) result.command_control.emplace(*insert_timeout);
+
+  UINVARIANT(result.flush_rows > 0, "flush_rows must be positive");
+  UINVARIANT(result.flush_rows <= result.max_pending_rows,
+             "flush_rows must not exceed max_pending_rows");
+  return result;
+}
+
+namespace impl {
+
+void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
+                const InsertBufferStatistics& stats) {
+  writer["rows"]["pushed"] = stats.rows_pushed;
+  writer["rows"]["dropped"] = stats.rows_dropped;
+  writer["rows"]["inserted"] = stats.rows_inserted;
+  writer["rows"]["failed"] = stats.rows_failed;
+  writer["rows"]["pending"] = stats.pending_rows.load();
+  writer["flushes"]["total"] = stats.flushes;
+  writer["flushes"]["error"] = stats.flush_errors;
+}
+
+}  // namespace impl
+
+}  // namespace storages::clickhouse
+
+USERVER_NAMESPACE_END
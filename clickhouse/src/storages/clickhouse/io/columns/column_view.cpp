@@ -0,0 +1,49 @@
+#include <userver/storages/clickhouse/io/columns/column_view.hpp>
+
+#include <clickhouse/columns/numeric.h>
+#include <clickhouse/columns/string.h>
+
+#include <storages/clickhouse/io/columns/impl/column_types_mapping.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::clickhouse::io::columns {
+
+template <typename T>
+NumericColumnView<T>::NumericColumnView(ColumnRef column)
+    : column_{std::move(column)} {
+  using NativeType = clickhouse::impl::clickhouse_cpp::ColumnVector<T>;
+  const auto typed_column =
+      impl::GetTypedColumn<NumericColumnView<T>, NativeType>(column_);
+
+  auto& data = typed_column->GetWritableData();
+  data_ = data.data();
+  size_ = data.size();
+}
+
+template class NumericColumnView<std::uint8_t>;
+template class NumericColumnView<std::uint16_t>;
+template class NumericColumnView<std::uint32_t>;
+template class NumericColumnView<std::uint64_t>;
+template class NumericColumnView<std::int8_t>;
+template class NumericColumnView<std::int16_t>;
+template class NumericColumnView<std::int32_t>;
+template class NumericColumnView<std::int64_t>;
+template class NumericColumnView<float>;
+template class NumericColumnView<double>;
+
+FixedStringColumnView::FixedStringColumnView(ColumnRef column)
+    : column_{std::move(column)} {
+  using NativeType = clickhouse::impl::clickhouse_cpp::ColumnFixedString;
+  const auto typed_column =
+      impl::GetTypedColumn<FixedStringColumnView, NativeType>(column_);
+
+  size_ = typed_column->Size();
+  fixed_size_ = typed_column->FixedSize();
+  // values are stored back to back, each of them takes exactly fixed_size_
+  if (size_ != 0) data_ = typed_column->At(0).data();
+}
+
+}  // namespace storages::clickhouse::io::columns
+
+USERVER_NAMESPACE_END
@@ -121,4 +121,57 @@ UTEST(Execute, IterationMovesFromUnderlying) {
   }
 }
 
+UTEST(Execute, Streaming) {
+  ClusterWrapper cluster{};
+
+  const storages::clickhouse::Query q{
+      "SELECT c.number, randomString(10), c.number as t, NOW64(9) "
+      "FROM numbers(0, {}) c SETTINGS max_block_size = 1000"};
+
+  /// [Sample ExecuteStreaming usage]
+  std::size_t blocks = 0;
+  uint64_t rows = 0;
+  uint64_t sum = 0;
+  cluster->ExecuteStreaming(
+      [&](storages::clickhouse::ExecutionResult&& block) {
+        ++blocks;
+        const auto numbers = block.GetNumericColumn<uint64_t>(0);
+        for (const auto number : numbers) sum += number;
+
+        for (const auto& row : std::move(block).AsRows<RowData>()) {
+          EXPECT_EQ(row.number, row.other_number);
+          ++rows;
+        }
+      },
+      q, 100'000);
+  /// [Sample ExecuteStreaming usage]
+
+  EXPECT_GT(blocks, 1);
+  EXPECT_EQ(rows, 100'000);
+  EXPECT_EQ(sum, uint64_t{100'000} * (100'000 - 1) / 2);
+}
+
+UTEST(Execute, ColumnViews) {
+  ClusterWrapper cluster{};
+
+  auto result = cluster->Execute(
+      "SELECT toInt32(c.number) - 5, toFixedString(toString(c.number), 3), "
+      "toFloat64(c.number) / 2 FROM numbers(0, 10) c");
+
+  const auto ints = result.GetNumericColumn<int32_t>(0);
+  ASSERT_EQ(ints.Size(), 10);
+  EXPECT_EQ(ints[0], -5);
+  EXPECT_EQ(ints[9], 4);
+
+  const auto strings = result.GetFixedStringColumn(1);
+  ASSERT_EQ(strings.Size(), 10);
+  EXPECT_EQ(strings.GetFixedSize(), 3);
+  EXPECT_EQ(strings[7], std::string_view("7\0\0", 3));
+
+  const auto doubles = result.GetNumericColumn<double>(2);
+  EXPECT_EQ(doubles[3], 1.5);
+
+  EXPECT_ANY_THROW(result.GetNumericColumn<uint64_t>(0));
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,118 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+#include <userver/storages/clickhouse/cluster.hpp>
+#include <userver/storages/clickhouse/insert_buffer.hpp>
+#include <userver/storages/clickhouse/io/columns/string_column.hpp>
+#include <userver/storages/clickhouse/io/columns/uint64_column.hpp>
+
+#include "utils_test.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct EventRow final {
+  uint64_t id;
+  std::string payload;
+};
+
+struct EventsData final {
+  std::vector<uint64_t> ids;
+};
+
+storages::clickhouse::ClusterPtr MakeNonOwning(ClusterWrapper& cluster) {
+  return {&*cluster, [](storages::clickhouse::Cluster*) {}};
+}
+
+void CreateTable(ClusterWrapper& cluster) {
+  cluster->Execute("DROP TABLE IF EXISTS insert_buffer_events");
+  cluster->Execute(
+      "CREATE TABLE insert_buffer_events (id UInt64, payload String) "
+      "ENGINE = Memory");
+}
+
+}  // namespace
+
+namespace storages::clickhouse::io {
+
+template <>
+struct CppToClickhouse<EventRow> {
+  using mapped_type = std::tuple<columns::UInt64Column, columns::StringColumn>;
+};
+
+template <>
+struct CppToClickhouse<EventsData> {
+  using mapped_type = std::tuple<columns::UInt64Column>;
+};
+
+}  // namespace storages::clickhouse::io
+
+UTEST_MT(InsertBuffer, ManyProducers, 4) {
+  constexpr std::size_t kTasks = 16;
+  constexpr std::size_t kRowsPerTask = 500;
+
+  ClusterWrapper cluster{};
+  CreateTable(cluster);
+
+  storages::clickhouse::InsertBufferSettings settings;
+  settings.flush_rows = 1000;
+  settings.max_pending_rows = kTasks * kRowsPerTask;
+  storages::clickhouse::InsertBuffer<EventRow> buffer{
+      MakeNonOwning(cluster), "insert_buffer_events", {"id", "payload"},
+      settings};
+
+  std::vector<engine::TaskWithResult<void>> tasks;
+  for (std::size_t task = 0; task < kTasks; ++task) {
+    tasks.push_back(engine::AsyncNoSpan([&buffer, task] {
+      for (std::size_t i = 0; i < kRowsPerTask; ++i) {
+        const auto id = task * kRowsPerTask + i;
+        EXPECT_TRUE(buffer.TryPush({id, std::to_string(id)}));
+      }
+    }));
+  }
+  engine::WaitAllChecked(tasks);
+  buffer.Flush();
+  EXPECT_EQ(buffer.GetPendingRowsApprox(), 0);
+
+  const auto result =
+      cluster->Execute("SELECT id FROM insert_buffer_events ORDER BY id")
+          .As<EventsData>();
+  ASSERT_EQ(result.ids.size(), kTasks * kRowsPerTask);
+  for (std::size_t i = 0; i < result.ids.size(); ++i) {
+    EXPECT_EQ(result.ids[i], i);
+  }
+}
+
+UTEST(InsertBuffer, Backpressure) {
+  ClusterWrapper cluster{};
+  CreateTable(cluster);
+
+  storages::clickhouse::InsertBufferSettings settings;
+  // never flushes in background during the test
+  settings.flush_rows = 100;
+  settings.flush_interval = std::chrono::hours{1};
+  settings.max_pending_rows = 10;
+  {
+    storages::clickhouse::InsertBuffer<EventRow> buffer{
+        MakeNonOwning(cluster), "insert_buffer_events", {"id", "payload"},
+        settings};
+    for (uint64_t i = 0; i < 10; ++i) {
+      EXPECT_TRUE(buffer.TryPush({i, "payload"}));
+    }
+    EXPECT_FALSE(buffer.TryPush({10, "payload"}));
+    EXPECT_EQ(buffer.GetPendingRowsApprox(), 10);
+
+    buffer.Flush();
+    EXPECT_TRUE(buffer.TryPush({10, "payload"}));
+    // flushed on destruction
+  }
+
+  const auto result =
+      cluster->Execute("SELECT id FROM insert_buffer_events ORDER BY id")
+          .As<EventsData>();
+  EXPECT_EQ(result.ids.size(), 11);
+}
+
+USERVER_NAMESPACE_END
@@ -77,6 +77,16 @@ async def test_duplex(websocket_client):
         assert response == b'ping'
 
 
+async def test_duplex_deflate(websocket_client):
+    async with websocket_client.get('duplex') as chat:
+        assert [ext.name for ext in chat.extensions] == ['permessage-deflate']
+
+        for msg in ('short', 'hello' * 10000, 'world' * 10000):
+            await chat.send(msg)
+            response = await chat.recv()
+            assert response == msg.encode()
+
+
 async def test_two(websocket_client):
     async with websocket_client.get('duplex') as chat1:
         async with websocket_client.get('duplex') as chat2:
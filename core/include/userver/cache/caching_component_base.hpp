@@ -3,9 +3,11 @@
 /// @file userver/cache/caching_component_base.hpp
 /// @brief @copybrief components::CachingComponentBase
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -18,6 +20,7 @@
 #include <userver/dump/helpers.hpp>
 #include <userver/dump/meta.hpp>
 #include <userver/dump/operations.hpp>
+#include <userver/dump/parts.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/rcu/rcu.hpp>
 #include <userver/utils/assert.hpp>
@@ -172,6 +175,27 @@ class CachingComponentBase : public LoggableComponentBase,
   virtual std::unique_ptr<const T> ReadContents(dump::Reader& reader) const;
   /// @}
 
+  /// @{
+  /// @brief Override to read compressed cache dumps in parallel
+  ///
+  /// If the dump format supports parts (see `dump.compression`),
+  /// WriteContentsParts is used instead of WriteContents. It should write the
+  /// contents as `parts_count` independent parts, each one after a
+  /// dump::Writer::BeginPart call, see dump::WriteContainerParts. Each part is
+  /// then read by ReadContentsPart in its own task, and the partial contents
+  /// are merged by MergeContents in the order the parts were written, see
+  /// dump::MergeContainers.
+  ///
+  /// By default the contents are written by WriteContents without parts and
+  /// are read sequentially.
+  virtual void WriteContentsParts(dump::Writer& writer, const T& contents,
+                                  std::size_t parts_count) const;
+
+  virtual std::unique_ptr<T> ReadContentsPart(dump::Reader& reader) const;
+
+  virtual void MergeContents(T& contents, T&& part) const;
+  /// @}
+
  private:
   void OnAllComponentsLoaded() final;
 
@@ -300,12 +324,39 @@ template <typename T>
 void CachingComponentBase<T>::GetAndWrite(dump::Writer& writer) const {
   const auto contents = GetUnsafe();
   if (!contents) throw cache::EmptyCacheError(Name());
-  WriteContents(writer, *contents);
+
+  const auto parts_count = writer.GetPartsCountHint();
+  if (parts_count != 0) {
+    WriteContentsParts(writer, *contents, parts_count);
+  } else {
+    WriteContents(writer, *contents);
+  }
 }
 
 template <typename T>
 void CachingComponentBase<T>::ReadAndSet(dump::Reader& reader) {
-  Set(ReadContents(reader));
+  auto parts = reader.SplitParts();
+  if (parts.empty()) {
+    Set(ReadContents(reader));
+    return;
+  }
+
+  std::vector<engine::TaskWithResult<std::unique_ptr<T>>> tasks;
+  tasks.reserve(parts.size());
+  for (auto& part : parts) {
+    tasks.push_back(engine::AsyncNoSpan(
+        engine::current_task::GetTaskProcessor(), [this, &part] {
+          auto contents = ReadContentsPart(*part);
+          part->Finish();
+          return contents;
+        }));
+  }
+
+  auto contents = tasks.front().Get();
+  for (std::size_t i = 1; i < tasks.size(); ++i) {
+    MergeContents(*contents, std::move(*tasks[i].Get()));
+  }
+  Set(std::move(contents));
 }
 
 template <typename T>
@@ -329,6 +380,32 @@ std::unique_ptr<const T> CachingComponentBase<T>::ReadContents(
   }
 }
 
+template <typename T>
+void CachingComponentBase<T>::WriteContentsParts(dump::Writer& writer,
+                                                 const T& contents,
+                                                 std::size_t) const {
+  WriteContents(writer, contents);
+}
+
+template <typename T>
+std::unique_ptr<T> CachingComponentBase<T>::ReadContentsPart(
+    dump::Reader& reader) const {
+  if constexpr (dump::kIsDumpable<T>) {
+    return std::unique_ptr<T>{new T(reader.Read<T>())};
+  } else {
+    dump::ThrowDumpUnimplemented(Name());
+  }
+}
+
+template <typename T>
+void CachingComponentBase<T>::MergeContents(T& contents, T&& part) const {
+  if constexpr (dump::kIsContainer<T>) {
+    dump::MergeContainers(contents, std::move(part));
+  } else {
+    dump::ThrowDumpUnimplemented(Name());
+  }
+}
+
 template <typename T>
 void CachingComponentBase<T>::OnAllComponentsLoaded() {
   AssertPeriodicUpdateStarted();
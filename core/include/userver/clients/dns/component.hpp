@@ -33,6 +33,7 @@ namespace clients::dns {
 /// cache-size-per-way | size of each way of network cache | 256
 /// cache-max-reply-ttl | TTL limit for network replies caching | 5m
 /// cache-failure-ttl | TTL for network failures caching | 5s
+/// cache-update-margin | time before network reply expiration during which accessed entries are refreshed in background | network-timeout
 ///
 /// ## Static configuration example:
 ///
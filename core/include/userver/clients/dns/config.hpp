@@ -4,6 +4,7 @@
 /// @brief @copybrief clients::dns::ResolverConfig
 
 #include <chrono>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,10 @@ struct ResolverConfig {
 
   /// Network cache failure TTL
   std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+  /// Network cache entries accessed within this interval before expiration
+  /// are refreshed in background (network timeout is used if not set or less)
+  std::optional<std::chrono::milliseconds> cache_update_margin;
 };
 
 }  // namespace clients::dns
@@ -6,18 +6,22 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
-#include <boost/lockfree/queue.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/lockfree/stack.hpp>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/get_all.hpp>
 #include <userver/engine/semaphore.hpp>
+#include <userver/engine/single_consumer_event.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -33,6 +37,12 @@ class PoolWaitLimitExceededError : public std::runtime_error {
 /// @brief Base connection pool implementation to be derived in different
 /// drivers. Takes care of synchronization, pool limits (min/max, simultaneously
 /// connecting etc.) and provides hooks for metrics.
+///
+/// Idle connections are kept in a lock-free stack, so the most recently used
+/// connections are reused first and stay warm. When all of the connections
+/// are given away, acquirers wait for their turn in FIFO order, each with its
+/// own deadline; a returned connection never lets a newcomer overtake
+/// the waiters.
 template <class Connection, class Derived>
 class ConnectionPoolBase : public std::enable_shared_from_this<Derived> {
  public:
@@ -85,8 +95,8 @@ class ConnectionPoolBase : public std::enable_shared_from_this<Derived> {
   /// correct way to return it back.
   void DoRelease(ConnectionUniquePtr connection_ptr);
 
-  /// @brief Creates a new connection and tries to push it into the ready
-  /// queue. If the queue is full, the connection is dropped immediately.
+  /// @brief Creates a new connection and tries to push it into the idle
+  /// stack. If the stack is full, the connection is dropped immediately.
   void PushConnection(engine::Deadline deadline);
   /// @brief Drops the connections - destroys the object and accounts for that.
   void Drop(ConnectionRawPtr connection_ptr) noexcept;
@@ -95,6 +105,10 @@ class ConnectionPoolBase : public std::enable_shared_from_this<Derived> {
   /// ready to use).
   std::size_t AliveConnectionsCountApprox() const;
 
+  /// @brief Returns the approximate count of acquirers waiting for
+  /// a connection to be returned into the pool.
+  std::size_t WaitersCountApprox() const;
+
   /// @brief Call this method if for some reason a connection previously
   /// acquired from the pool won't be returned into it.
   /// If one fails to do so pool limits might shrink until pool becomes
@@ -102,21 +116,48 @@ class ConnectionPoolBase : public std::enable_shared_from_this<Derived> {
   void NotifyConnectionWontBeReleased();
 
  private:
+  struct Waiter final {
+    using Hook = boost::intrusive::list_member_hook<>;
+
+    engine::SingleConsumerEvent slot_granted;
+    // protected by waiters_mutex_
+    bool has_slot{false};
+    Hook hook;
+  };
+
+  using WaitersList = boost::intrusive::list<
+      Waiter,
+      boost::intrusive::member_hook<Waiter, typename Waiter::Hook,
+                                    &Waiter::hook>>;
+
   Derived& AsDerived() noexcept;
   const Derived& AsDerived() const noexcept;
 
+  // A slot is a permission to hold a connection given away
+  bool TryAcquireSlot() noexcept;
+  bool DoTryAcquireSlot() noexcept;
+  bool WaitForSlot(engine::Deadline deadline);
+  void ReleaseSlot() noexcept;
+  void GrantSlotsToWaiters() noexcept;
+
   ConnectionUniquePtr CreateConnection(
       const engine::SemaphoreLock& connecting_lock, engine::Deadline deadline);
 
-  void CleanupQueue();
+  void CleanupIdle();
 
   void EnsureInitialized() const;
   void EnsureReset() const;
 
-  engine::Semaphore given_away_semaphore_;
+  const std::size_t max_pool_size_;
+  std::atomic<std::size_t> given_away_{0};
+
+  std::mutex waiters_mutex_;
+  WaitersList waiters_;
+  std::atomic<std::size_t> waiters_count_{0};
+
   engine::Semaphore connecting_semaphore_;
 
-  boost::lockfree::queue<ConnectionRawPtr> queue_;
+  boost::lockfree::stack<ConnectionRawPtr> stack_;
   std::atomic<std::size_t> alive_connections_{0};
 
   bool initialized_{false};
@@ -127,9 +168,9 @@ template <class Connection, class Derived>
 ConnectionPoolBase<Connection, Derived>::ConnectionPoolBase(
     std::size_t max_pool_size,
     std::size_t max_simultaneously_connecting_clients)
-    : given_away_semaphore_{max_pool_size},
+    : max_pool_size_{max_pool_size},
       connecting_semaphore_{max_simultaneously_connecting_clients},
-      queue_{max_pool_size} {}
+      stack_{max_pool_size} {}
 
 template <class Connection, class Derived>
 ConnectionPoolBase<Connection, Derived>::~ConnectionPoolBase() {
@@ -174,7 +215,7 @@ void ConnectionPoolBase<Connection, Derived>::Reset() {
   UASSERT_MSG(!reset_, "Calling Reset multiple times is a API misuse");
   reset_ = true;
 
-  CleanupQueue();
+  CleanupIdle();
 }
 
 template <class Connection, class Derived>
@@ -195,7 +236,7 @@ void ConnectionPoolBase<Connection, Derived>::ReleaseConnection(
 
   DoRelease(std::move(connection_ptr));
 
-  given_away_semaphore_.unlock_shared();
+  ReleaseSlot();
   AsDerived().AccountConnectionReleased();
 }
 
@@ -210,6 +251,66 @@ const Derived& ConnectionPoolBase<Connection, Derived>::AsDerived() const
   return *static_cast<const Derived*>(this);
 }
 
+template <class Connection, class Derived>
+bool ConnectionPoolBase<Connection, Derived>::TryAcquireSlot() noexcept {
+  // newcomers must not overtake the waiters
+  if (waiters_count_.load() != 0) return false;
+  return DoTryAcquireSlot();
+}
+
+template <class Connection, class Derived>
+bool ConnectionPoolBase<Connection, Derived>::DoTryAcquireSlot() noexcept {
+  auto given_away = given_away_.load();
+  do {
+    if (given_away >= max_pool_size_) return false;
+  } while (!given_away_.compare_exchange_weak(given_away, given_away + 1));
+  return true;
+}
+
+template <class Connection, class Derived>
+bool ConnectionPoolBase<Connection, Derived>::WaitForSlot(
+    engine::Deadline deadline) {
+  Waiter waiter;
+  {
+    const std::lock_guard lock{waiters_mutex_};
+    waiters_.push_back(waiter);
+    waiters_count_.fetch_add(1);
+    // a slot might have been released before we were linked
+    GrantSlotsToWaiters();
+  }
+
+  [[maybe_unused]] const auto is_signaled =
+      waiter.slot_granted.WaitForEventUntil(deadline);
+
+  const std::lock_guard lock{waiters_mutex_};
+  if (waiter.has_slot) return true;
+
+  waiters_.erase(WaitersList::s_iterator_to(waiter));
+  waiters_count_.fetch_sub(1);
+  return false;
+}
+
+template <class Connection, class Derived>
+void ConnectionPoolBase<Connection, Derived>::ReleaseSlot() noexcept {
+  given_away_.fetch_sub(1);
+  if (waiters_count_.load() != 0) {
+    const std::lock_guard lock{waiters_mutex_};
+    GrantSlotsToWaiters();
+  }
+}
+
+template <class Connection, class Derived>
+void ConnectionPoolBase<Connection, Derived>::GrantSlotsToWaiters() noexcept {
+  while (!waiters_.empty() && DoTryAcquireSlot()) {
+    auto& waiter = waiters_.front();
+    waiters_.pop_front();
+    waiters_count_.fetch_sub(1);
+    waiter.has_slot = true;
+    // under the lock, so that the waiter could not be destroyed yet
+    waiter.slot_granted.Send();
+  }
+}
+
 template <class Connection, class Derived>
 typename ConnectionPoolBase<Connection, Derived>::ConnectionUniquePtr
 ConnectionPoolBase<Connection, Derived>::CreateConnection(
@@ -230,11 +331,11 @@ typename ConnectionPoolBase<Connection, Derived>::ConnectionUniquePtr
 ConnectionPoolBase<Connection, Derived>::Pop(engine::Deadline deadline) {
   EnsureInitialized();
 
-  engine::SemaphoreLock given_away_lock{given_away_semaphore_, deadline};
-  if (!given_away_lock.OwnsLock()) {
+  if (!TryAcquireSlot() && !WaitForSlot(deadline)) {
     AsDerived().AccountOverload();
     throw PoolWaitLimitExceededError{};
   }
+  utils::FastScopeGuard slot_guard{[this]() noexcept { ReleaseSlot(); }};
 
   auto connection_ptr = TryPop();
   if (!connection_ptr) {
@@ -252,7 +353,7 @@ ConnectionPoolBase<Connection, Derived>::Pop(engine::Deadline deadline) {
 
   UASSERT(connection_ptr);
 
-  given_away_lock.Release();
+  slot_guard.Release();
   AsDerived().AccountConnectionAcquired();
 
   return connection_ptr;
@@ -264,7 +365,7 @@ ConnectionPoolBase<Connection, Derived>::TryPop() {
   EnsureInitialized();
 
   ConnectionRawPtr connection_ptr{nullptr};
-  if (!queue_.pop(connection_ptr)) {
+  if (!stack_.pop(connection_ptr)) {
     return nullptr;
   }
 
@@ -279,7 +380,7 @@ void ConnectionPoolBase<Connection, Derived>::DoRelease(
 
   const auto is_broken = connection_ptr->IsBroken();
   ConnectionRawPtr connection_raw_ptr = connection_ptr.release();
-  if (is_broken || !queue_.bounded_push(connection_raw_ptr)) {
+  if (is_broken || !stack_.bounded_push(connection_raw_ptr)) {
     Drop(connection_raw_ptr);
   }
 }
@@ -299,7 +400,7 @@ void ConnectionPoolBase<Connection, Derived>::PushConnection(
   connecting_lock.Unlock();
 
   ConnectionRawPtr connection_raw_ptr = connection_ptr.release();
-  if (!queue_.bounded_push(connection_raw_ptr)) {
+  if (!stack_.bounded_push(connection_raw_ptr)) {
     Drop(connection_raw_ptr);
   }
 }
@@ -327,21 +428,29 @@ ConnectionPoolBase<Connection, Derived>::AliveConnectionsCountApprox() const {
   return alive_connections_.load();
 }
 
+template <class Connection, class Derived>
+std::size_t ConnectionPoolBase<Connection, Derived>::WaitersCountApprox()
+    const {
+  EnsureInitialized();
+
+  return waiters_count_.load();
+}
+
 template <class Connection, class Derived>
 void ConnectionPoolBase<Connection, Derived>::NotifyConnectionWontBeReleased() {
   EnsureInitialized();
 
-  given_away_semaphore_.unlock_shared();
+  ReleaseSlot();
   alive_connections_.fetch_sub(1);
 }
 
 template <class Connection, class Derived>
-void ConnectionPoolBase<Connection, Derived>::CleanupQueue() {
+void ConnectionPoolBase<Connection, Derived>::CleanupIdle() {
   EnsureInitialized();
 
   ConnectionRawPtr connection_ptr{nullptr};
 
-  while (queue_.pop(connection_ptr)) {
+  while (stack_.pop(connection_ptr)) {
     Drop(connection_ptr);
   }
 }
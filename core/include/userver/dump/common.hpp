@@ -7,6 +7,7 @@
 /// @ingroup userver_dump_read_write
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <stdexcept>
 #include <string>
@@ -66,6 +67,9 @@ void WriteInteger(Writer& writer, std::uint64_t value);
 
 std::uint64_t ReadInteger(Reader& reader);
 
+/// @brief Reads exactly `size` bytes into `data` in blocks of bounded size
+void ReadBytes(Reader& reader, char* data, std::size_t size);
+
 template <typename Duration>
 inline constexpr bool kIsDumpedAsNanoseconds =
     std::is_integral_v<typename Duration::rep> &&
@@ -75,6 +79,43 @@ inline constexpr bool kIsDumpedAsNanoseconds =
 
 }  // namespace impl
 
+/// @brief Enables dumping a trivially copyable type as its raw bytes
+///
+/// To enable, add in the global namespace:
+///
+/// @code
+/// template <>
+/// struct dump::IsDumpedTrivially<MyStruct>;
+/// @endcode
+///
+/// `std::vector` of such types (as well as of floating-point types and 1-byte
+/// integers) is written and read with a single copy of the whole range.
+///
+/// @warning The layout of the type and the platform endianness become a part
+/// of the dump format. Don't forget to increment format-version if the layout
+/// changes.
+template <typename T>
+struct IsDumpedTrivially {};
+
+namespace impl {
+
+// Only the non-specialized IsDumpedTrivially struct is defined,
+// the specializations are declared without a definition
+template <typename T>
+using IsNotDumpedTrivially = decltype(sizeof(IsDumpedTrivially<T>));
+
+template <typename T>
+inline constexpr bool kIsMarkedDumpedTrivially =
+    !meta::kIsDetected<IsNotDumpedTrivially, T>;
+
+/// Whether `T` is dumped as its raw bytes
+template <typename T>
+inline constexpr bool kIsDumpedAsBytes =
+    std::is_floating_point_v<T> || (meta::kIsInteger<T> && sizeof(T) == 1) ||
+    kIsMarkedDumpedTrivially<T>;
+
+}  // namespace impl
+
 /// @brief Write-only `std::string_view` support
 /// @see `ReadStringViewUnsafe`
 void Write(Writer& writer, std::string_view value);
@@ -126,6 +167,21 @@ std::enable_if_t<std::is_floating_point_v<T>, T> Read(Reader& reader, To<T>) {
   return impl::ReadTrivial<T>(reader);
 }
 
+/// @brief Serialization support for types marked with dump::IsDumpedTrivially
+template <typename T>
+std::enable_if_t<impl::kIsMarkedDumpedTrivially<T>> Write(Writer& writer,
+                                                          const T& value) {
+  impl::WriteTrivial(writer, value);
+}
+
+/// @brief Deserialization support for types marked with
+/// dump::IsDumpedTrivially
+template <typename T>
+std::enable_if_t<impl::kIsMarkedDumpedTrivially<T>, T> Read(Reader& reader,
+                                                            To<T>) {
+  return impl::ReadTrivial<T>(reader);
+}
+
 /// @brief bool serialization support
 void Write(Writer& writer, bool value);
 
@@ -93,6 +93,14 @@ VariantType ReadVariant(Reader& reader, std::size_t index) {
   return std::move(*result);
 }
 
+template <typename T>
+inline constexpr bool kIsContiguousBytesRange = false;
+
+// vector<bool> is not contiguous, bool is not dumped as bytes anyway
+template <typename T, typename Alloc>
+inline constexpr bool kIsContiguousBytesRange<std::vector<T, Alloc>> =
+    kIsDumpedAsBytes<T> && !std::is_same_v<T, bool>;
+
 }  // namespace impl
 
 /// @brief Container serialization support
@@ -100,6 +108,16 @@ template <typename T>
 std::enable_if_t<kIsContainer<T> && kIsWritable<meta::RangeValueType<T>>> Write(
     Writer& writer, const T& value) {
   writer.Write(std::size(value));
+  if constexpr (impl::kIsContiguousBytesRange<T>) {
+    static_assert(std::is_trivially_copyable_v<meta::RangeValueType<T>>,
+                  "dump::IsDumpedTrivially is specialized for a type that is "
+                  "not trivially copyable");
+    // same format as writing the items one by one
+    WriteStringViewUnsafe(
+        writer, std::string_view{reinterpret_cast<const char*>(value.data()),
+                                 value.size() * sizeof(value[0])});
+    return;
+  }
   for (const auto& item : value) {
     // explicit cast for vector<bool> shenanigans
     writer.Write(static_cast<const meta::RangeValueType<T>&>(item));
@@ -111,6 +129,15 @@ template <typename T>
 std::enable_if_t<kIsContainer<T> && kIsReadable<meta::RangeValueType<T>>, T>
 Read(Reader& reader, To<T>) {
   const auto size = reader.Read<std::size_t>();
+  if constexpr (impl::kIsContiguousBytesRange<T>) {
+    static_assert(std::is_trivially_copyable_v<meta::RangeValueType<T>>,
+                  "dump::IsDumpedTrivially is specialized for a type that is "
+                  "not trivially copyable");
+    T result(size);
+    impl::ReadBytes(reader, reinterpret_cast<char*>(result.data()),
+                    size * sizeof(result[0]));
+    return result;
+  }
   T result{};
   if constexpr (meta::kIsReservable<T>) {
     result.reserve(size);
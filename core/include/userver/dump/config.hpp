@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -45,6 +46,11 @@ struct Config final {
   std::optional<std::chrono::milliseconds> max_dump_age;
   bool max_dump_age_set;
   bool dump_is_encrypted;
+  bool dump_is_compressed;
+  int compression_level;
+  std::size_t chunk_size;
+  std::size_t parallelism;
+  bool use_mmap;
 
   bool static_dumps_enabled;
   std::chrono::milliseconds static_min_dump_interval;
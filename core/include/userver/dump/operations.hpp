@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <userver/dump/fwd.hpp>
 #include <userver/dump/meta.hpp>
@@ -35,6 +38,19 @@ class Writer {
   /// @throws `Error` on write operation failure
   virtual void Finish() = 0;
 
+  /// @brief The number of independent parts the data should be split into,
+  /// 0 if the format does not support parts
+  /// @see `BeginPart`
+  virtual std::size_t GetPartsCountHint() const noexcept;
+
+  /// @brief Starts an independent part of the data
+  /// @details The data written until the next `BeginPart` call can be read
+  /// by a separate `Reader` concurrently with the other parts, see
+  /// `Reader::SplitParts`. Must only be called if `GetPartsCountHint` is
+  /// not 0.
+  /// @throws `Error` on write operation failure
+  virtual void BeginPart();
+
  protected:
   /// @brief Writes binary data
   /// @details Unlike `Write`, doesn't write the size of `data`
@@ -60,6 +76,25 @@ class Reader {
   /// @throws `Error` on read operation failure or if there is leftover data
   virtual void Finish() = 0;
 
+  /// @brief Creates readers of the parts of the data written after
+  /// `Writer::BeginPart` calls, one per part
+  /// @details The parts are all the remaining data, so once the readers are
+  /// created, nothing is left to be read by this reader. Each of the readers
+  /// may be used in its own task, `Finish` must be called for each of them.
+  /// @returns an empty vector if the format does not support parts or no
+  /// parts were written, the data must then be read sequentially
+  /// @throws `Error` on read operation failure
+  virtual std::vector<std::unique_ptr<Reader>> SplitParts();
+
+  /// @brief Returns an owner of the memory the read data points to, if the
+  /// data stays valid after the subsequent reads, e.g. for a memory-mapped
+  /// file
+  /// @details Allows deserializing into views of the dump data instead of
+  /// copies, the views stay valid while the returned pointer is alive, see
+  /// `ReadBorrowedStringView`.
+  /// @returns nullptr if the data is invalidated by the next read
+  virtual std::shared_ptr<const void> GetBackingStorage() const;
+
  protected:
   /// @brief Reads binary data
   /// @note Invalidates the memory returned by the previous call of `ReadRaw`
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <userver/dump/factory.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+/// Settings of the chunked dump format
+struct ChunkedSettings final {
+  /// zlib compression level of the chunks, 0 to store them uncompressed
+  int compression_level{1};
+
+  /// Size of the uncompressed data of a chunk
+  std::size_t chunk_size{4 * 1024 * 1024};
+
+  /// Max number of chunks compressed or decompressed at once, also the
+  /// number of parts the data is split into, see `Writer::BeginPart`
+  std::size_t parallelism{4};
+};
+
+/// @brief A handle to a chunked dump file. File operations block the thread.
+///
+/// The data is split into chunks of `chunk_size`, which are compressed
+/// independently in separate tasks of the current task processor and are
+/// followed by an index of the chunks. Parts are supported, each part starts
+/// a new chunk.
+class ChunkedFileWriter final : public Writer {
+ public:
+  /// @brief Creates a new dump file and opens it
+  /// @throws `Error` on a filesystem error
+  ChunkedFileWriter(std::string path, boost::filesystem::perms perms,
+                    const ChunkedSettings& settings, tracing::ScopeTime& scope);
+
+  ~ChunkedFileWriter() override;
+
+  void Finish() override;
+
+  std::size_t GetPartsCountHint() const noexcept override;
+
+  void BeginPart() override;
+
+ private:
+  void WriteRaw(std::string_view data) override;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// @brief A handle to a chunked dump file. File operations block the thread.
+///
+/// Chunks following the one being read are decompressed ahead in separate
+/// tasks of the current task processor.
+class ChunkedFileReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file and reads its index
+  /// @throws `Error` on a filesystem error or a malformed index
+  ChunkedFileReader(std::string path, const ChunkedSettings& settings);
+
+  ~ChunkedFileReader() override;
+
+  void Finish() override;
+
+  std::vector<std::unique_ptr<Reader>> SplitParts() override;
+
+ private:
+  struct Impl;
+
+  explicit ChunkedFileReader(std::unique_ptr<Impl>&& impl);
+
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::unique_ptr<Impl> impl_;
+};
+
+class ChunkedOperationsFactory final : public OperationsFactory {
+ public:
+  ChunkedOperationsFactory(const ChunkedSettings& settings,
+                           boost::filesystem::perms perms);
+
+  std::unique_ptr<Reader> CreateReader(std::string full_path) override;
+
+  std::unique_ptr<Writer> CreateWriter(std::string full_path,
+                                       tracing::ScopeTime& scope) override;
+
+ private:
+  const ChunkedSettings settings_;
+  const boost::filesystem::perms perms_;
+};
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
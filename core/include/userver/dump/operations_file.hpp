@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <memory>
 
 #include <boost/filesystem/operations.hpp>
 
@@ -52,9 +53,38 @@ class FileReader final : public Reader {
   std::string curr_chunk_;
 };
 
+/// @brief A handle to a dump file mapped into memory
+///
+/// The data is read without copying it into an intermediate buffer. It stays
+/// valid while the storage returned by `GetBackingStorage` is alive, which
+/// allows deserializing into views of the file, see `ReadBorrowedStringView`.
+class MmapFileReader final : public Reader {
+ public:
+  /// @brief Opens an existing dump file and maps it into memory
+  /// @throws `Error` on a filesystem error
+  explicit MmapFileReader(std::string path);
+
+  ~MmapFileReader() override;
+
+  void Finish() override;
+
+  std::shared_ptr<const void> GetBackingStorage() const override;
+
+ private:
+  class Mapping;
+
+  std::string_view ReadRaw(std::size_t max_size) override;
+
+  std::string path_;
+  std::shared_ptr<const Mapping> mapping_;
+  std::string_view unread_;
+};
+
 class FileOperationsFactory final : public OperationsFactory {
  public:
-  explicit FileOperationsFactory(boost::filesystem::perms perms);
+  /// @param use_mmap whether to read dumps with MmapFileReader
+  explicit FileOperationsFactory(boost::filesystem::perms perms,
+                                 bool use_mmap = false);
 
   std::unique_ptr<Reader> CreateReader(std::string full_path) override;
 
@@ -63,6 +93,7 @@ class FileOperationsFactory final : public OperationsFactory {
 
  private:
   const boost::filesystem::perms perms_;
+  const bool use_mmap_;
 };
 
 }  // namespace dump
@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file userver/dump/parts.hpp
+/// @brief Helpers for dumps written as independent parts, see
+/// dump::Writer::BeginPart
+///
+/// @ingroup userver_dump_read_write
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <userver/utils/meta.hpp>
+
+#include <userver/dump/meta_containers.hpp>
+#include <userver/dump/operations.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+namespace impl {
+
+template <typename T>
+using NodeMergeResult = std::enable_if_t<
+    meta::kIsDetected<meta::impl::KeyType, T>,
+    decltype(std::declval<T&>().merge(std::declval<T&>()))>;
+
+}  // namespace impl
+
+/// @brief Writes the container as `parts_count` parts of about the same size
+/// @details Each part is written in the same format as the container itself,
+/// so a part can be read with `reader.Read<T>()` into a partial container.
+/// `<userver/dump/common_containers.hpp>` must be included.
+template <typename T>
+void WriteContainerParts(Writer& writer, const T& container,
+                         std::size_t parts_count) {
+  static_assert(kIsContainer<T>);
+  const auto size = std::size(container);
+  auto it = std::begin(container);
+  for (std::size_t part = 0; part < parts_count; ++part) {
+    const auto part_size =
+        size / parts_count + (part < size % parts_count ? 1 : 0);
+    writer.BeginPart();
+    writer.Write(part_size);
+    for (std::size_t i = 0; i < part_size; ++i, ++it) {
+      // explicit cast for vector<bool> shenanigans
+      writer.Write(static_cast<const meta::RangeValueType<T>&>(*it));
+    }
+  }
+}
+
+/// @brief Moves the elements of a partial container into `to`
+/// @details Nodes of associative containers are relinked without copying.
+template <typename T>
+void MergeContainers(T& to, T&& from) {
+  static_assert(kIsContainer<T>);
+  if (std::size(to) == 0) {
+    to = std::move(from);
+  } else if constexpr (meta::kIsDetected<impl::NodeMergeResult, T>) {
+    to.merge(from);
+  } else {
+    if constexpr (meta::kIsReservable<T>) {
+      to.reserve(std::size(to) + std::size(from));
+    }
+    for (auto&& item : from) {
+      dump::Insert(to, static_cast<meta::RangeValueType<T>&&>(item));
+    }
+  }
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
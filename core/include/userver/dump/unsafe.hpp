@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string_view>
 
 #include <userver/dump/operations.hpp>
@@ -27,6 +28,16 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size);
 /// @warning The `string_view` will be invalidated on the next `Read` operation
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size);
 
+/// @brief Reads a string written by `writer.Write(str)` as a view of the
+/// backing storage of the reader, without copying it
+/// @details The view stays valid while `storage` is alive. If `storage` is
+/// empty, it is set to `reader.GetBackingStorage()`, so a single storage may
+/// be shared by many views. Storing both the views and the storage in the
+/// cache value allows it to borrow the data from the dump file.
+/// @throws Error if the reader has no backing storage
+std::string_view ReadBorrowedStringView(Reader& reader,
+                                        std::shared_ptr<const void>& storage);
+
 }  // namespace dump
 
 USERVER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -12,6 +13,7 @@
 
 #include <userver/dynamic_config/fwd.hpp>
 #include <userver/formats/json_fwd.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -45,6 +47,8 @@ struct ConfigIdGetter final {
   }
 };
 
+struct ParsedConfig;
+
 class SnapshotData final {
  public:
   SnapshotData() = default;
@@ -56,6 +60,11 @@ class SnapshotData final {
   SnapshotData(const SnapshotData& defaults,
                const std::vector<KeyValue>& overrides);
 
+  // Parses only the configs that read any of the `changed_names` docs, the
+  // other configs are shared with `previous`
+  SnapshotData(const DocsMap& docs_map, const SnapshotData& previous,
+               const utils::impl::TransparentSet<std::string>& changed_names);
+
   SnapshotData(SnapshotData&&) noexcept = default;
   SnapshotData& operator=(SnapshotData&&) noexcept = default;
 
@@ -70,10 +79,13 @@ class SnapshotData final {
 
   bool IsEmpty() const noexcept;
 
+  // Whether the config was neither parsed nor overridden since `other`
+  bool IsSharedWith(const SnapshotData& other, ConfigId id) const noexcept;
+
  private:
   const std::any& DoGet(ConfigId id) const;
 
-  std::vector<std::any> user_configs_;
+  std::vector<std::shared_ptr<const ParsedConfig>> user_configs_;
 };
 
 class StorageData;
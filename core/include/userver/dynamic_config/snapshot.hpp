@@ -120,7 +120,9 @@ class Key final {
 ///
 /// When a config update comes in via new `DocsMap`, configs of all
 /// the registered types are constructed and stored in `Config`. After that
-/// the `DocsMap` is dropped.
+/// the `DocsMap` is dropped. On subsequent updates only the configs that read
+/// the changed docs are constructed again, the rest are shared with the
+/// previous snapshot.
 ///
 /// Config types are automatically registered if they are used
 /// somewhere in the program.
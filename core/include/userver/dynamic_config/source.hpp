@@ -11,6 +11,7 @@
 #include <userver/concurrent/async_event_source.hpp>
 #include <userver/dynamic_config/snapshot.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/meta.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -183,7 +184,9 @@ class Source final {
   /// @note Сallbacks occur only if one of the passed config is changed. This is
   /// true under any components::DynamicConfigClientUpdater options.
   ///
-  /// @warning To use this function, configs must have the `operator==`.
+  /// Configs that were not reparsed since the previous invocation are
+  /// considered unchanged. Reparsed configs are compared with `operator==` if
+  /// it is available, otherwise they are considered changed.
   ///
   /// @param obj the subscriber, which is the owner of the listener method, and
   /// is also used as the unique identifier of the subscription
@@ -210,6 +213,29 @@ class Source final {
                              std::move(wrapper));
   }
 
+  /// @brief Subscribes to updates of a subset of all configs with information
+  /// about the current and previous states.
+  ///
+  /// Same as the overload above, but the listener receives the
+  /// dynamic_config::Diff. The passed configs are the same in `diff.previous`
+  /// and in the snapshot of the previous invocation of the listener.
+  ///
+  /// @see dynamic_config::Diff
+  template <typename Class, typename... Keys>
+  concurrent::AsyncEventSubscriberScope UpdateAndListen(
+      Class* obj, std::string_view name,
+      void (Class::*func)(const dynamic_config::Diff& diff),
+      const Keys&... keys) {
+    auto wrapper = [obj, func, keys = std::make_tuple(std::cref(keys)...)](
+                       const Diff& diff) {
+      const auto args = std::tuple_cat(std::tie(diff), keys);
+      if (!std::apply(HasChanged<Keys...>, args)) return;
+      (obj->*func)(diff);
+    };
+    return DoUpdateAndListen(concurrent::FunctionId(obj), name,
+                             std::move(wrapper));
+  }
+
   SnapshotEventSource& GetEventChannel();
 
  private:
@@ -223,8 +249,20 @@ class Source final {
     UASSERT(!current.GetData().IsEmpty());
     UASSERT(!previous.GetData().IsEmpty());
 
-    const bool is_equal = (true && ... && (previous[keys] == current[keys]));
-    return !is_equal;
+    return (false || ... || HasKeyChanged(previous, current, keys));
+  }
+
+  template <typename VariableType>
+  static bool HasKeyChanged(const Snapshot& previous, const Snapshot& current,
+                            const Key<VariableType>& key) {
+    const auto id = impl::ConfigIdGetter::Get(key);
+    if (current.GetData().IsSharedWith(previous.GetData(), id)) return false;
+
+    if constexpr (meta::kIsEqualityComparable<VariableType>) {
+      return !(previous[key] == current[key]);
+    } else {
+      return true;
+    }
   }
 
   concurrent::AsyncEventSubscriberScope DoUpdateAndListen(
@@ -3,6 +3,7 @@
 #include <optional>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <userver/formats/json/value.hpp>
 #include <userver/formats/parse/common_containers.hpp>
@@ -42,11 +43,26 @@ class DocsMap final {
 
   const utils::impl::TransparentSet<std::string>& GetConfigsExpectedToBeUsed(
       utils::InternalTag) const;
+
+  // Names passed to 'Get' and 'Has' are recorded between these calls.
+  // std::nullopt is returned if the whole map was read, e.g. via 'AsJson'.
+  void StartRecordingNames(utils::InternalTag) const;
+  std::optional<std::vector<std::string>> StopRecordingNames(
+      utils::InternalTag) const;
+
+  // Names of the configs that were added, removed or changed since `previous`
+  utils::impl::TransparentSet<std::string> GetChangedNames(
+      const DocsMap& previous, utils::InternalTag) const;
   /// @endcond
 
  private:
+  void RecordName(std::string_view name) const;
+  void RecordAllNames() const;
+
   utils::impl::TransparentMap<std::string, formats::json::Value> docs_;
   mutable utils::impl::TransparentSet<std::string> configs_to_be_used_;
+  mutable std::optional<std::vector<std::string>> recorded_names_;
+  mutable bool recorded_all_names_{false};
 };
 
 template <typename T>
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 
 /// @file userver/engine/task/task_processor_fwd.hpp
@@ -24,6 +25,9 @@ class TaskProcessor;
 /// @note It is a low-level function. You might not want to use it.
 void RegisterThreadStartedHook(std::function<void()>);
 
+/// @brief Returns the count of worker threads of the task processor
+std::size_t GetWorkerCount(const TaskProcessor& task_processor) noexcept;
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -19,6 +19,9 @@ namespace fs {
 struct FileInfoWithData {
   std::string data;
   std::string extension;
+  /// Hex encoded SHA-1 of `data`, the same across restarts and builds, e.g.
+  /// for HTTP ETag
+  std::string hash;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
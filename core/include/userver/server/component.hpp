@@ -76,6 +76,7 @@ namespace components {
 /// connection.requests_queue_size_threshold | drop requests from handlers that allow throttling if there's more pending requests than allowed by this value | 100
 /// connection.keepalive_timeout | timeout in seconds to drop connection if there's not data received from it | 600
 /// shards | how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing | -
+/// reuseport-cpu-steering | each shard listens on its own SO_REUSEPORT socket, pass a new connection to the shard #(CPU % shards), where CPU is the one that received the connection; TCP on Linux only | false
 ///
 /// @see @ref scripts/docs/en/userver/http_server.md
 
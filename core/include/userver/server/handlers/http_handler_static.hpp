@@ -19,6 +19,14 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// Responses carry an ETag, so `If-None-Match` requests get HTTP 304.
+/// A single `Range: bytes=...` is answered with HTTP 206 (HTTP 416 if not
+/// satisfiable), multiple ranges are ignored and the whole file is returned.
+///
+/// With `serve-precompressed: true` the handler looks up 'file.br' and
+/// 'file.gz' in the cache for a request to 'file' and returns the first
+/// one that the client accepts according to `Accept-Encoding`.
+///
 /// ## Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
@@ -28,9 +36,10 @@ namespace server::handlers {
 /// Inherits all the options from server::handlers::HttpHandlerBase and adds the
 /// following ones:
 ///
-/// Name               | Description                   | Default value
-/// ------------------ | ----------------------------- | -------------
-/// fs-cache-component | Name of the FsCache component | fs-cache-component
+/// Name                | Description                                            | Default value
+/// ------------------- | ------------------------------------------------------ | -------------
+/// fs-cache-component  | Name of the FsCache component                          | fs-cache-component
+/// serve-precompressed | serve 'file.br' or 'file.gz' if the client accepts it  | false
 ///
 /// ## Example usage:
 ///
@@ -57,6 +66,7 @@ class HttpHandlerStatic final : public HttpHandlerBase {
  private:
   dynamic_config::Source config_;
   const fs::FsCacheClient& storage_;
+  const bool serve_precompressed_;
 };
 
 }  // namespace server::handlers
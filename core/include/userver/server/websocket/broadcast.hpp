@@ -0,0 +1,115 @@
+#pragma once
+
+/// @file userver/server/websocket/broadcast.hpp
+/// @brief @copybrief server::websocket::BroadcastGroup
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/statistics/relaxed_counter.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+/// @brief What to do with a group member whose send queue is full
+enum class SlowConsumerPolicy {
+  /// Skip the new message for this member
+  kDropMessage,
+  /// Close the connection with CloseStatus::kPolicyViolation
+  kClose,
+};
+
+struct BroadcastGroupConfig final {
+  /// Max number of messages waiting to be sent to a single member
+  std::size_t max_queue_size{64};
+  SlowConsumerPolicy slow_consumer_policy{SlowConsumerPolicy::kDropMessage};
+};
+
+/// @brief Group of websocket connections that receive the same messages.
+///
+/// A message is encoded once into server::websocket::PreparedMessage and its
+/// frames are shared by all the members. Each member has its own bounded
+/// queue and a task that writes the queue to the connection, so Broadcast()
+/// never waits for I/O and a slow peer does not delay the others.
+///
+/// ## Example:
+/// @code
+/// void Handle(WebSocketConnection& ws, server::request::RequestContext&) {
+///   const auto membership = group_.Join(ws);
+///   Message message;
+///   while (!message.close_status) ws.Recv(message);
+/// }
+///
+/// void Publish(std::string update) {
+///   group_.Broadcast(PreparedMessage{std::move(update), true, config_});
+/// }
+/// @endcode
+class BroadcastGroup final {
+ public:
+  struct Statistics final {
+    /// Messages queued for sending to members
+    utils::statistics::RelaxedCounter<std::uint64_t> enqueued{0};
+    /// Messages dropped because of SlowConsumerPolicy::kDropMessage
+    utils::statistics::RelaxedCounter<std::uint64_t> dropped{0};
+    /// Connections closed because of SlowConsumerPolicy::kClose
+    utils::statistics::RelaxedCounter<std::uint64_t> closed{0};
+  };
+
+  class Membership;
+
+  explicit BroadcastGroup(BroadcastGroupConfig config = {});
+  ~BroadcastGroup();
+
+  BroadcastGroup(const BroadcastGroup&) = delete;
+  BroadcastGroup& operator=(const BroadcastGroup&) = delete;
+
+  /// @brief Adds the connection to the group until the returned Membership
+  /// is destroyed.
+  /// @warning The connection must outlive the returned Membership.
+  [[nodiscard]] Membership Join(WebSocketConnection& connection);
+
+  /// @brief Queues the message for sending to every member.
+  void Broadcast(const PreparedMessage& message);
+
+  /// @brief Returns the current number of members.
+  std::size_t GetSize() const;
+
+  const Statistics& GetStatistics() const;
+
+ private:
+  class Impl;
+  class Member;
+
+  std::shared_ptr<Impl> impl_;
+};
+
+/// @brief Group membership of a connection, stops sending and leaves the
+/// group on destruction.
+class BroadcastGroup::Membership final {
+ public:
+  Membership(Membership&&) noexcept;
+  Membership& operator=(Membership&&) noexcept;
+  ~Membership();
+
+  /// @brief Leaves the group and waits for the current write to finish, the
+  /// queued messages are dropped. If the calling task is cancelled, the
+  /// write is cancelled too and the connection must not be used any more.
+  void Leave();
+
+ private:
+  friend class BroadcastGroup;
+
+  Membership(std::shared_ptr<Impl> group, std::shared_ptr<Member> member);
+
+  std::shared_ptr<Impl> group_;
+  std::shared_ptr<Member> member_;
+  engine::TaskWithResult<void> writer_;
+};
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
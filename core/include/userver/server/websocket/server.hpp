@@ -48,10 +48,39 @@ class WebSocketConnectionImpl;
 struct Config final {
   unsigned max_remote_payload = 65536;
   unsigned fragment_size = 65536;  // 0 - do not fragment
+
+  /// Negotiate RFC 7692 permessage-deflate extension if offered by client
+  bool permessage_deflate = false;
+  /// Do not keep the compression context between outgoing messages,
+  /// trades compression ratio for less CPU and memory per connection
+  bool deflate_no_context_takeover = false;
+  /// Outgoing messages smaller than this are sent uncompressed
+  unsigned deflate_min_size = 64;
 };
 
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
 
+/// @brief Message that is encoded into websocket frames (and compressed if
+/// permessage-deflate is enabled in Config) only once, so that it could be
+/// cheaply sent to many connections.
+///
+/// Copies share the encoded frames.
+class PreparedMessage final {
+ public:
+  PreparedMessage(std::string data, bool is_text, const Config& config);
+
+  /// Original payload
+  const std::string& GetData() const noexcept;
+
+  bool IsText() const noexcept;
+
+ private:
+  friend class WebSocketConnectionImpl;
+
+  struct Frames;
+  std::shared_ptr<const Frames> frames_;
+};
+
 struct Statistics final {
   std::atomic<int64_t> msg_sent{0};
   std::atomic<int64_t> msg_recv{0};
@@ -91,6 +120,11 @@ class WebSocketConnection {
   virtual void Send(const Message& message) = 0;
   virtual void SendText(std::string_view message) = 0;
 
+  /// @brief Send a message that was encoded beforehand.
+  /// @throws engine::io::IoException in case of socket errors
+  /// @note Thread-safety is the same as for Send().
+  virtual void SendPrepared(const PreparedMessage& message);
+
   template <typename ContiguousContainer>
   void SendBinary(const ContiguousContainer& message) {
     static_assert(sizeof(typename ContiguousContainer::value_type) == 1,
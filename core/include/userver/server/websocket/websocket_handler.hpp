@@ -28,6 +28,9 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate | negotiate permessage-deflate compression (RFC 7692) | false
+/// deflate-no-context-takeover | reset compression context after each outgoing message | false
+/// deflate-min-size | outgoing messages smaller than this are not compressed | 64
 ///
 /// ## Example usage:
 ///
@@ -26,6 +26,7 @@ namespace components {
 /// ---- | ----------- | -------------
 /// service-name | name of the service to write in traces | ''
 /// tracer | type of the tracer to trace, currently supported only 'native' | 'native'
+/// sampling | sampling of the traces, see tracing::SamplingSettings for the options | all traces are sampled
 ///
 /// ## Static configuration example:
 ///
@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file userver/tracing/otlp_exporter_component.hpp
+/// @brief @copybrief components::OtlpExporter
+
+#include <memory>
+
+#include <userver/components/loggable_component_base.hpp>
+#include <userver/utils/statistics/entry.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+class Exporter;
+}  // namespace tracing::otlp
+
+namespace components {
+
+// clang-format off
+
+/// @ingroup userver_components
+///
+/// @brief Component that exports the finished spans and, optionally, the
+/// metrics to an OpenTelemetry collector in the binary protobuf OTLP/HTTP
+/// format.
+///
+/// The spans are queued and sent in batches to `<endpoint>/v1/traces`, the
+/// metrics are sent to `<endpoint>/v1/metrics`. The spans that are not logged
+/// due to the log level or the sampling are not exported. The spans of the
+/// exporter itself are neither logged nor exported.
+///
+/// The component writes its own metrics into the `otlp-exporter` path.
+///
+/// ## Static options:
+/// Name | Description | Default value
+/// ---- | ----------- | -------------
+/// endpoint | base URL of the OTLP/HTTP receiver | http://localhost:4318
+/// unix-socket-path | connect to the receiver via this Unix socket | -
+/// http-client | name of the components::HttpClient to send the data with | http-client
+/// service-name | 'service.name' resource attribute | service name of the components::Tracer
+/// resource-attributes | extra string attributes of the resource | {}
+/// max-queue-size | max count of spans waiting to be sent | 65536
+/// queue-overflow-behavior | 'discard-new' or 'discard-old' spans if the queue is full | discard-new
+/// max-batch-size | max count of spans in a single request, full batches are sent without waiting for the flush-interval | 512
+/// flush-interval | how often to send the queued spans | 1s
+/// timeout | timeout of a request to the receiver | 1s
+/// log-spans | whether to also write the exported spans to the logs | true
+/// metrics | whether to export the utils::statistics metrics | false
+/// metrics-interval | how often to export the metrics | 15s
+///
+/// ## Static configuration example:
+///
+/// @code
+/// # yaml
+/// otlp-exporter:
+///     endpoint: http://localhost:4318
+///     max-batch-size: 1024
+///     log-spans: false
+///     metrics: true
+/// @endcode
+
+// clang-format on
+class OtlpExporter final : public LoggableComponentBase {
+ public:
+  /// @ingroup userver_component_names
+  /// @brief The default name of components::OtlpExporter
+  static constexpr std::string_view kName = "otlp-exporter";
+
+  OtlpExporter(const ComponentConfig& config, const ComponentContext& context);
+
+  ~OtlpExporter() override;
+
+  static yaml_config::Schema GetStaticConfigSchema();
+
+ private:
+  std::shared_ptr<tracing::otlp::Exporter> exporter_;
+  utils::statistics::Entry statistics_holder_;
+};
+
+template <>
+inline constexpr bool kHasValidate<OtlpExporter> = true;
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,58 @@
+#pragma once
+
+/// @file userver/tracing/sampling.hpp
+/// @brief @copybrief tracing::SamplingSettings
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+
+#include <userver/formats/parse/to.hpp>
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+// clang-format off
+
+/// @brief Settings of the tracing::Span sampling, see
+/// tracing::Tracer::SetSamplingSettings
+///
+/// The sampling decision is made once per trace, when a Span without a parent
+/// is created (for tracing::SpanBuilder - when it is built), and is inherited by all the child spans. Only the span records
+/// are affected, other logs are written as usual.
+///
+/// A trace is sampled with `probability`, but no more than
+/// `max-traces-per-second` traces are sampled each second. With
+/// `tail-sampling` enabled the spans of a trace that was not sampled are
+/// buffered in memory and are logged only if the root span turns out to be
+/// slower than `tail-slow-threshold` or any of the spans has the
+/// tracing::kErrorFlag tag. The buffered spans are kept as the rendered log
+/// records.
+///
+/// ## Static options:
+/// Name                    | Description                                                   | Default value
+/// ----------------------- | ------------------------------------------------------------- | -------------
+/// probability             | probability of a new trace to be sampled, from 0 to 1         | 1
+/// max-traces-per-second   | max count of new traces sampled each second                   | unlimited
+/// tail-sampling           | buffer the spans of not sampled traces to log slow and failed | false
+/// tail-slow-threshold     | duration of the root span that makes the trace logged         | 1s
+/// tail-max-buffered-spans | max spans of a trace to buffer, the rest are dropped          | 100
+
+// clang-format on
+struct SamplingSettings final {
+  double probability{1.0};
+  std::optional<std::size_t> max_traces_per_second;
+
+  bool tail_sampling{false};
+  std::chrono::milliseconds tail_slow_threshold{1000};
+  std::size_t tail_max_buffered_spans{100};
+};
+
+SamplingSettings Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<SamplingSettings>);
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
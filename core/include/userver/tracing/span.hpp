@@ -174,6 +174,9 @@ class Span final {
   const std::string& GetTraceId() const;
 
   /// Identifies a specific span. It does not propagate
+  ///
+  /// The IDs are kept in binary and are hex-encoded on the first call of the
+  /// getter. The getters are safe to call concurrently.
   const std::string& GetSpanId() const;
   const std::string& GetParentId() const;
 
@@ -181,6 +184,12 @@ class Span final {
   /// global log levels to the default logger.
   bool ShouldLogDefault() const noexcept;
 
+  /// @returns false if the spans of the trace are not logged or are logged
+  /// only if the trace turns out to be slow or failed, see
+  /// tracing::SamplingSettings. Propagated to other services by the
+  /// tracing::TracingManagerBase.
+  bool IsSampled() const noexcept;
+
   /// Detach the Span from current engine::Task so it is not
   /// returned by CurrentSpan() any more.
   void DetachFromCoroStack();
@@ -217,6 +226,7 @@ class Span final {
   };
 
   friend class SpanBuilder;
+  friend class Tracer;
 
   explicit Span(std::unique_ptr<Impl, OptionalDeleter>&& pimpl);
 
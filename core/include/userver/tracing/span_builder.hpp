@@ -26,6 +26,10 @@ class SpanBuilder final {
   void SetParentLink(std::string parent_link);
   void AddTagFrozen(std::string key, logging::LogExtra::Value value);
   void AddNonInheritableTag(std::string key, logging::LogExtra::Value value);
+
+  /// Overrides the local sampling decision with the one of the caller, see
+  /// tracing::SamplingSettings
+  void SetSampled(bool sampled);
   Span Build() &&;
 
  private:
@@ -16,12 +16,16 @@ class TagWriter;
 namespace tracing {
 
 struct NoLogSpans;
+struct SamplingSettings;
 
 class Tracer : public std::enable_shared_from_this<Tracer> {
  public:
   static void SetNoLogSpans(NoLogSpans&& spans);
   static bool IsNoLogSpan(const std::string& name);
 
+  /// Sets the sampling of new traces, see tracing::SamplingSettings
+  static void SetSamplingSettings(const SamplingSettings& settings);
+
   static void SetTracer(TracerPtr tracer);
 
   static TracerPtr GetTracer();
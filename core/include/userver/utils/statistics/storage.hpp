@@ -3,10 +3,14 @@
 /// @file userver/utils/statistics/storage.hpp
 /// @brief @copybrief utils::statistics::Storage
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <initializer_list>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -86,8 +90,94 @@ using ExtenderFunc =
 
 using WriterFunc = std::function<void(Writer&)>;
 
+/// @brief Reads the current value of a series registered via
+/// Storage::RegisterSeries
+using SeriesReaderFunc = std::function<MetricValue()>;
+
 namespace impl {
 
+/// Label set shared by all the series registered with equal labels
+struct InternedLabels final {
+  explicit InternedLabels(std::vector<Label>&& labels_in);
+
+  InternedLabels(const InternedLabels&) = delete;
+  InternedLabels& operator=(const InternedLabels&) = delete;
+
+  const std::vector<Label> labels;
+  const std::vector<LabelView> views;
+};
+
+struct InternedLabelsLess final {
+  using is_transparent = void;
+
+  bool operator()(const std::shared_ptr<const InternedLabels>& x,
+                  const std::shared_ptr<const InternedLabels>& y) const {
+    return x->labels < y->labels;
+  }
+  bool operator()(const std::shared_ptr<const InternedLabels>& x,
+                  const std::vector<Label>& y) const {
+    return x->labels < y;
+  }
+  bool operator()(const std::vector<Label>& x,
+                  const std::shared_ptr<const InternedLabels>& y) const {
+    return x < y->labels;
+  }
+};
+
+using InternedLabelsSet =
+    std::set<std::shared_ptr<const InternedLabels>, InternedLabelsLess>;
+
+/// Formats that cache text fragments of the registered series
+enum class SeriesFormat {
+  kPrometheus,
+  kSolomon,
+};
+
+inline constexpr std::size_t kSeriesFormatsCount = 2;
+
+/// @brief Series registered via Storage::RegisterSeries.
+///
+/// Path and labels of a series never change, so the format builders render
+/// them once and reuse the text on every subsequent scrape.
+class RegisteredSeries final {
+ public:
+  RegisteredSeries(std::string path,
+                   std::shared_ptr<const InternedLabels> labels,
+                   SeriesReaderFunc reader);
+
+  std::string_view GetPath() const noexcept { return path_; }
+
+  LabelsSpan GetLabels() const noexcept { return LabelsSpan{labels_->views}; }
+
+  MetricValue Read() const { return reader_(); }
+
+  /// Returns the text fragment for `format`, calls `render` to build it on
+  /// the first call. Thread-safe.
+  template <typename Render>
+  std::string_view GetFragment(SeriesFormat format, Render&& render) const {
+    auto& fragment = fragments_[static_cast<std::size_t>(format)];
+    std::call_once(fragment.once, [&] { fragment.text = render(); });
+    return fragment.text;
+  }
+
+  /// @cond
+  const std::shared_ptr<const InternedLabels>& GetInternedLabels() const {
+    return labels_;
+  }
+  /// @endcond
+
+ private:
+  struct Fragment final {
+    std::once_flag once;
+    std::string text;
+  };
+
+  const std::string path_;
+  const std::shared_ptr<const InternedLabels> labels_;
+  const SeriesReaderFunc reader_;
+  mutable std::array<Fragment, kSeriesFormatsCount> fragments_;
+};
+
 struct MetricsSource final {
   std::string prefix_path;
   std::vector<std::string> path_segments;
@@ -95,6 +185,8 @@ struct MetricsSource final {
 
   WriterFunc writer;
   std::vector<Label> writer_labels;
+
+  std::unique_ptr<const RegisteredSeries> series;
 };
 
 using StorageData = std::list<MetricsSource>;
@@ -110,6 +202,14 @@ class BaseFormatBuilder {
 
   virtual void HandleMetric(std::string_view path, LabelsSpan labels,
                             const MetricValue& value) = 0;
+
+  /// Called for the series registered via Storage::RegisterSeries.
+  /// `add_labels` come from the Request and are the same for all the series
+  /// of a single VisitMetrics call. Builders may override it to reuse the
+  /// fragments cached in `series`, the default implementation calls
+  /// HandleMetric.
+  virtual void HandleSeries(const impl::RegisteredSeries& series,
+                            LabelsSpan add_labels, const MetricValue& value);
 };
 
 /// @ingroup userver_clients
@@ -143,6 +243,18 @@ class Storage final {
   Entry RegisterWriter(std::string common_prefix, WriterFunc func,
                        std::vector<Label> add_labels = {});
 
+  /// @brief Add a single series with a fixed path and labels.
+  ///
+  /// Unlike writers, series are not walked through Writer on scrape: `reader`
+  /// is called directly and the rendered path and labels are cached by the
+  /// Prometheus and Solomon formats. Prefer it for services with a large and
+  /// mostly static set of labelled series. Equal label sets are interned.
+  ///
+  /// Note that `reader` is called concurrently with other code, so it should
+  /// be thread\coroutine safe.
+  Entry RegisterSeries(std::string path, std::vector<Label> labels,
+                       SeriesReaderFunc reader);
+
   /// @deprecated Use RegisterWriter instead.
   Entry RegisterExtender(std::string prefix, ExtenderFunc func);
 
@@ -154,6 +266,7 @@ class Storage final {
 
   std::atomic<bool> may_register_extenders_;
   impl::StorageData metrics_sources_;
+  impl::InternedLabelsSet interned_labels_;
   mutable engine::SharedMutex mutex_;
 };
 
@@ -39,6 +39,9 @@ ResolverConfig ParseResolverConfig(
   config.cache_failure_ttl =
       component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(
           config.cache_failure_ttl);
+  config.cache_update_margin =
+      component_config["cache-update-margin"]
+          .As<std::optional<std::chrono::milliseconds>>();
   return config;
 }
 
@@ -119,6 +122,12 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-update-margin:
+        type: string
+        description: |
+            time before network reply expiration during which accessed
+            entries are refreshed in background
+        defaultDescription: network-timeout
 )");
 }
 
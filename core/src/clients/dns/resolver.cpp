@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <string_view>
@@ -201,7 +202,9 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor,
                      config.file_update_interval},
       net_resolver_{fs_task_processor, config.network_timeout,
                     config.network_attempts, config.network_custom_servers},
-      net_cache_update_margin_{config.network_timeout},
+      net_cache_update_margin_{
+          std::max(config.cache_update_margin.value_or(config.network_timeout),
+                   config.network_timeout)},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
       net_cache_{config.cache_ways, config.cache_size_per_way},
@@ -1,3 +1,4 @@
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -58,7 +59,9 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
   using ServerMock = utest::DnsServerMock;
 
-  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+  MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way,
+                 std::optional<std::chrono::milliseconds>
+                     cache_update_margin = {})
       : hosts_file{[] {
           auto file = fs::blocking::TempFile::Create();
           fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -87,6 +90,7 @@ struct MockedResolver {
               config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl},
               config.cache_ways = 1;
               config.cache_size_per_way = cache_size_per_way;
+              config.cache_update_margin = cache_update_margin;
               config.network_custom_servers = {server_mock.GetServerAddress()};
               return config;
             }()} {}
@@ -399,6 +403,40 @@ UTEST(Resolver, CacheStale) {
   EXPECT_EQ(counters.network_failure, 0);
 }
 
+UTEST(Resolver, CacheUpdatesBeforeExpiration) {
+  const auto test_deadline =
+      engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+  MockedResolver resolver{10, 1, std::chrono::seconds{8}};
+
+  utils::datetime::MockNowSet({});
+
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  const auto& counters = resolver->GetLookupSourceCounters();
+
+  // within update margin, background update is started
+  utils::datetime::MockSleep(std::chrono::seconds{3});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+  while (counters.network < 2 && !test_deadline.IsReached()) {
+    engine::SleepFor(std::chrono::milliseconds{1});
+  }
+
+  // the original reply has expired, but the record is already updated
+  utils::datetime::MockSleep(std::chrono::seconds{8});
+  EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline),
+                      (Expected{kNetV6String, kNetV4String}));
+
+  EXPECT_EQ(counters.file, 0);
+  EXPECT_EQ(counters.cached, 2);
+  EXPECT_EQ(counters.cached_stale, 0);
+  EXPECT_EQ(counters.cached_failure, 0);
+  EXPECT_GE(counters.network, 2);
+  EXPECT_EQ(counters.network_failure, 0);
+}
+
 UTEST(Resolver, CacheFailures) {
   const auto test_deadline =
       engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
@@ -162,6 +162,9 @@ components_manager:
     tracer:
         service-name: config-service
         tracer: native
+        sampling:
+            probability: 1
+            tail-sampling: false
 # /// [Sample tracer component config]
 # /// [Sample statistics storage component config]
 # yaml
@@ -166,6 +166,13 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                coarse-cancellation-timers:
+                    type: boolean
+                    description: |
+                        keep task cancellation deadlines in a timer wheel
+                        ticking once in a few milliseconds instead of
+                        arming a precise ev timer for each task
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
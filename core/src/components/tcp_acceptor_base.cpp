@@ -9,6 +9,8 @@
 
 #include <netinet/tcp.h>
 
+#include <functional>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace components {
@@ -62,6 +64,19 @@ properties:
       type: string
       description: task processor to process accepted sockets
       defaultDescription: value of `task_processor`
+  shards:
+      type: integer
+      description: |
+          how many SO_REUSEPORT sockets to listen on, each one is served by
+          its own accepting task; must be 1 for `unix-socket`
+      defaultDescription: 1
+      minimum: 1
+  reuseport-cpu-steering:
+      type: boolean
+      description: |
+          pass a new connection to the socket #(CPU % shards), where CPU is
+          the one that received the connection; Linux only
+      defaultDescription: false
 )");
 }
 
@@ -74,11 +89,11 @@ TcpAcceptorBase::TcpAcceptorBase(const ComponentConfig& config,
           context.GetTaskProcessor(acceptor_config.task_processor)),
       sockets_task_processor_(context.GetTaskProcessor(
           SocketsTaskProcessorName(config, acceptor_config))),
-      listen_sock_(server::net::CreateSocket(acceptor_config)) {}
+      listen_socks_(server::net::CreateShardedSockets(acceptor_config)) {}
 
-void TcpAcceptorBase::KeepAccepting() {
+void TcpAcceptorBase::KeepAccepting(engine::io::Socket& listen_sock) {
   while (!engine::current_task::ShouldCancel()) {
-    engine::io::Socket sock = listen_sock_.Accept({});
+    engine::io::Socket sock = listen_sock.Accept({});
 
     tasks_.Detach(engine::AsyncNoSpan(
         sockets_task_processor_,
@@ -95,14 +110,18 @@ void TcpAcceptorBase::KeepAccepting() {
 void TcpAcceptorBase::OnAllComponentsLoaded() {
   // Start handling after the derived object was fully constructed
 
-  // NOLINTNEXTLINE(cppcoreguidelines-slicing)
-  acceptor_ = engine::AsyncNoSpan(acceptor_task_processor_,
-                                  &TcpAcceptorBase::KeepAccepting, this);
+  acceptors_.reserve(listen_socks_.size());
+  for (auto& listen_sock : listen_socks_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-slicing)
+    acceptors_.push_back(engine::AsyncNoSpan(
+        acceptor_task_processor_, &TcpAcceptorBase::KeepAccepting, this,
+        std::ref(listen_sock)));
+  }
 }
 
 void TcpAcceptorBase::OnAllComponentsAreStopping() {
-  acceptor_ = {};  // Cancel and wait for finish
-  listen_sock_.Close();
+  acceptors_.clear();  // Cancel and wait for finish
+  for (auto& listen_sock : listen_socks_) listen_sock.Close();
   tasks_.CancelAndWait();
 }
 
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <userver/drivers/impl/connection_pool_base.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/wait_all_checked.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kPoolSize = 16;
+
+class FakeConnection final {
+ public:
+  static bool IsBroken() { return false; }
+};
+
+class FakePool final
+    : public drivers::impl::ConnectionPoolBase<FakeConnection, FakePool> {
+ public:
+  using Base = drivers::impl::ConnectionPoolBase<FakeConnection, FakePool>;
+
+  explicit FakePool(std::size_t max_pool_size)
+      : Base{max_pool_size, max_pool_size} {}
+
+  ~FakePool() { Reset(); }
+
+  void InitPool(std::size_t initial_size) {
+    Init(initial_size, std::chrono::seconds{1});
+  }
+
+  void AcquireAndRelease(bool yield_while_holding) {
+    auto holder = AcquireConnection({});
+    benchmark::DoNotOptimize(holder.connection_ptr.get());
+    if (yield_while_holding) engine::Yield();
+    ReleaseConnection(std::move(holder.connection_ptr));
+  }
+
+ private:
+  friend class drivers::impl::ConnectionPoolBase<FakeConnection, FakePool>;
+
+  static ConnectionUniquePtr DoCreateConnection(engine::Deadline) {
+    return std::make_unique<FakeConnection>();
+  }
+
+  static void AccountConnectionCreated() {}
+  static void AccountConnectionDestroyed() noexcept {}
+  static void AccountConnectionAcquired() {}
+  static void AccountConnectionReleased() {}
+  static void AccountOverload() {}
+};
+
+std::shared_ptr<FakePool> MakePool() {
+  auto pool = std::make_shared<FakePool>(kPoolSize);
+  pool->InitPool(kPoolSize);
+  return pool;
+}
+
+}  // namespace
+
+void connection_pool_acquire_release(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto pool = MakePool();
+    for ([[maybe_unused]] auto _ : state) {
+      pool->AcquireAndRelease(false);
+    }
+  });
+}
+BENCHMARK(connection_pool_acquire_release);
+
+// state.range(0) tasks compete for kPoolSize connections, holding each of
+// them across a context switch
+void connection_pool_contended(benchmark::State& state) {
+  const auto tasks_count = static_cast<std::size_t>(state.range(0));
+
+  engine::RunStandalone(4, [&] {
+    const auto pool = MakePool();
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(tasks_count);
+
+    for ([[maybe_unused]] auto _ : state) {
+      for (std::size_t i = 0; i < tasks_count; ++i) {
+        tasks.push_back(
+            engine::AsyncNoSpan([&pool] { pool->AcquireAndRelease(true); }));
+      }
+      engine::WaitAllChecked(tasks);
+      tasks.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * tasks_count);
+  });
+}
+BENCHMARK(connection_pool_contended)
+    ->RangeMultiplier(8)
+    ->Range(kPoolSize, 16 * 1024)
+    ->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
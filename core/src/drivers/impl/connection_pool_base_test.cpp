@@ -92,6 +92,8 @@ class BasicPool final : public DummyBasePool<BasicPool> {
 
   std::size_t GetOverloadCount() const { return overloaded_; }
 
+  std::size_t GetWaitersCount() const { return WaitersCountApprox(); }
+
   void ForceNewConnectionsToTimeout() { force_connection_timeout_ = true; }
 
  private:
@@ -331,6 +333,49 @@ UTEST(ConnectionPoolBase, Metrics) {
   EXPECT_EQ(pool->GetReleasedMetric(), total_iterations);
 }
 
+UTEST(ConnectionPoolBase, ReusesLastReleased) {
+  auto pool = CreatePool<BasicPool>(2, 2);
+
+  auto first = pool->Acquire({});
+  auto second = pool->Acquire({});
+  auto* const second_raw = second.connection.get();
+  {
+    [[maybe_unused]] const auto released_first = std::move(first);
+  }
+  {
+    [[maybe_unused]] const auto released_second = std::move(second);
+  }
+
+  // the most recently used connection is the warmest one
+  const auto connection = pool->Acquire({});
+  EXPECT_EQ(connection.connection.get(), second_raw);
+}
+
+UTEST(ConnectionPoolBase, WaitersAreServedInOrder) {
+  constexpr std::size_t kWaiters = 5;
+  auto pool = CreatePool<BasicPool>(1, 1);
+
+  std::vector<std::size_t> order;
+  std::vector<engine::TaskWithResult<void>> tasks;
+  {
+    const auto busy = pool->Acquire({});
+
+    for (std::size_t i = 0; i < kWaiters; ++i) {
+      tasks.push_back(engine::AsyncNoSpan([&, i] {
+        const auto connection = pool->Acquire(
+            engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+        order.push_back(i);
+      }));
+      // let the task enqueue itself before the next one starts
+      while (pool->GetWaitersCount() != i + 1) engine::Yield();
+    }
+  }
+
+  engine::WaitAllChecked(tasks);
+  const std::vector<std::size_t> expected{0, 1, 2, 3, 4};
+  EXPECT_EQ(order, expected);
+}
+
 }  // namespace drivers::impl
 
 USERVER_NAMESPACE_END
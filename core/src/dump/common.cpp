@@ -1,6 +1,8 @@
 #include <userver/dump/common.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 #include <boost/endian/conversion.hpp>
 #include <boost/uuid/uuid.hpp>
@@ -78,6 +80,18 @@ std::uint64_t ReadInteger(Reader& reader) {
   }
 }
 
+void ReadBytes(Reader& reader, char* data, std::size_t size) {
+  // bounds the intermediate buffer of readers that copy the data
+  constexpr std::size_t kBlockSize = 1024 * 1024;  // 1 MiB
+
+  while (size != 0) {
+    const auto block = ReadStringViewUnsafe(reader, std::min(size, kBlockSize));
+    std::memcpy(data, block.data(), block.size());
+    data += block.size();
+    size -= block.size();
+  }
+}
+
 }  // namespace impl
 
 std::string ReadEntire(Reader& reader) {
@@ -1,6 +1,8 @@
 #include <userver/dump/common_containers.hpp>
 
 #include <atomic>
+#include <cstdint>
+#include <numeric>
 
 #include <boost/bimap.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -67,8 +69,20 @@ Dummy Read(dump::Reader& reader, dump::To<Dummy>) {
   return dummy;
 }
 
+struct TrivialPoint {
+  int x;
+  int y;
+};
+
+bool operator==(const TrivialPoint& lhs, const TrivialPoint& rhs) {
+  return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
 }  // namespace
 
+template <>
+struct dump::IsDumpedTrivially<TrivialPoint>;
+
 using dump::FromBinary;
 using dump::TestWriteReadCycle;
 using dump::ToBinary;
@@ -79,6 +93,30 @@ TEST(DumpCommonContainers, Vector) {
   TestWriteReadCycle(std::vector<std::string>{});
 }
 
+TEST(DumpCommonContainers, VectorOfBytes) {
+  TestWriteReadCycle(std::vector<double>{1.5, -2, 1e300});
+  TestWriteReadCycle(std::vector<std::uint8_t>{0, 1, 255});
+  TestWriteReadCycle(std::vector<TrivialPoint>{{1, 2}, {-3, 4}});
+  TestWriteReadCycle(std::vector<double>{});
+  TestWriteReadCycle(TrivialPoint{5, 6});
+}
+
+TEST(DumpCommonContainers, VectorOfBytesFormat) {
+  // the items are copied at once in the same format as one by one
+  const std::vector<double> data{1.5, -2, 1e300};
+  dump::MockWriter writer;
+  writer.Write(data.size());
+  for (const auto item : data) writer.Write(item);
+  EXPECT_EQ(ToBinary(data), std::move(writer).Extract());
+}
+
+TEST(DumpCommonContainers, LargeVectorOfBytes) {
+  // larger than the read block
+  std::vector<float> data(3 * 1024 * 1024 / sizeof(float) + 1);
+  std::iota(data.begin(), data.end(), 0.0f);
+  TestWriteReadCycle(data);
+}
+
 TEST(DumpCommonContainers, Pair) {
   TestWriteReadCycle(std::pair<int, int>{1, 2});
   TestWriteReadCycle(std::pair<const int, int>{1, 2});
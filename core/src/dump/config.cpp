@@ -18,9 +18,26 @@ constexpr std::string_view kDumpFormatVersion = "format-version";
 constexpr std::string_view kMaxDumpCount = "max-count";
 constexpr std::string_view kWorldReadable = "world-readable";
 constexpr std::string_view kEncrypted = "encrypted";
+constexpr std::string_view kCompression = "compression";
+constexpr std::string_view kCompressionLevel = "compression-level";
+constexpr std::string_view kChunkSize = "chunk-size";
+constexpr std::string_view kParallelism = "parallelism";
+constexpr std::string_view kMmap = "mmap";
 
 constexpr auto kDefaultFsTaskProcessor = std::string_view{"fs-task-processor"};
 constexpr auto kDefaultMaxDumpCount = uint64_t{1};
+constexpr auto kDefaultCompressionLevel = int{1};
+constexpr auto kDefaultChunkSize = std::size_t{4 * 1024 * 1024};
+constexpr auto kDefaultParallelism = std::size_t{4};
+
+bool ParseIsCompressed(const yaml_config::YamlConfig& value) {
+  const auto compression = value.As<std::string>("none");
+  if (compression == "none") return false;
+  if (compression == "zlib") return true;
+  throw std::logic_error(
+      fmt::format("{}: unknown compression '{}', expected 'none' or 'zlib'",
+                  value.GetPath(), compression));
+}
 
 }  // namespace
 
@@ -67,6 +84,12 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
           config[kMaxDumpAge].As<std::optional<std::chrono::milliseconds>>()),
       max_dump_age_set(config.HasMember(kMaxDumpAge)),
       dump_is_encrypted(config[kEncrypted].As<bool>(false)),
+      dump_is_compressed(ParseIsCompressed(config[kCompression])),
+      compression_level(
+          config[kCompressionLevel].As<int>(kDefaultCompressionLevel)),
+      chunk_size(config[kChunkSize].As<std::size_t>(kDefaultChunkSize)),
+      parallelism(config[kParallelism].As<std::size_t>(kDefaultParallelism)),
+      use_mmap(config[kMmap].As<bool>(false)),
       static_dumps_enabled(config[kDumpsEnabled].As<bool>()),
       static_min_dump_interval(
           config[kMinDumpInterval].As<std::chrono::milliseconds>(0)) {
@@ -78,6 +101,25 @@ Config::Config(std::string name, const yaml_config::YamlConfig& config,
     throw std::logic_error(
         fmt::format("{}: {} must not be 0", this->name, kMaxDumpCount));
   }
+  if (dump_is_compressed && dump_is_encrypted) {
+    throw std::logic_error(
+        fmt::format("{}: {} is not supported for {} dumps", this->name,
+                    kCompression, kEncrypted));
+  }
+  if (use_mmap && (dump_is_compressed || dump_is_encrypted)) {
+    throw std::logic_error(fmt::format(
+        "{}: {} is only supported for dumps that are neither compressed nor "
+        "encrypted",
+        this->name, kMmap));
+  }
+  if (compression_level < 0 || compression_level > 9) {
+    throw std::logic_error(fmt::format("{}: {} must be in [0, 9]", this->name,
+                                       kCompressionLevel));
+  }
+  if (chunk_size == 0 || parallelism == 0) {
+    throw std::logic_error(fmt::format("{}: {} and {} must not be 0",
+                                       this->name, kChunkSize, kParallelism));
+  }
 }
 
 DynamicConfig::DynamicConfig(const Config& config, ConfigPatch&& patch)
@@ -574,6 +574,40 @@ properties:
                 type: boolean
                 description: Whether to encrypt the dump
                 defaultDescription: false
+            compression:
+                type: string
+                description: |
+                    Whether to write the dump as independently compressed
+                    chunks, which are compressed and decompressed in parallel
+                defaultDescription: none
+                enum:
+                  - none
+                  - zlib
+            compression-level:
+                type: integer
+                description: zlib compression level of the chunks, 0 to store them as is
+                defaultDescription: 1
+                minimum: 0
+                maximum: 9
+            chunk-size:
+                type: integer
+                description: Size of the uncompressed data of a chunk in bytes
+                defaultDescription: 4194304
+                minimum: 1
+            parallelism:
+                type: integer
+                description: |
+                    Max number of chunks compressed or decompressed at once,
+                    also the number of parts caches may split the dump into
+                    to read them in parallel
+                defaultDescription: 4
+                minimum: 1
+            mmap:
+                type: boolean
+                description: |
+                    Whether to read the dump from a memory mapping of the file,
+                    which avoids copying the data and allows caches to borrow it
+                defaultDescription: false
 )");
 }
 
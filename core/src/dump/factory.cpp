@@ -1,6 +1,7 @@
 #include <userver/dump/factory.hpp>
 
 #include <dump/secdist.hpp>
+#include <userver/dump/operations_chunked.hpp>
 #include <userver/dump/operations_encrypted.hpp>
 #include <userver/dump/operations_file.hpp>
 #include <userver/storages/secdist/component.hpp>
@@ -19,6 +20,14 @@ boost::filesystem::perms GetPerms(const Config& config) {
     return perms::owner_read;
 }
 
+ChunkedSettings GetChunkedSettings(const Config& config) {
+  ChunkedSettings settings;
+  settings.compression_level = config.compression_level;
+  settings.chunk_size = config.chunk_size;
+  settings.parallelism = config.parallelism;
+  return settings;
+}
+
 }  // namespace
 
 std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
@@ -30,15 +39,24 @@ std::unique_ptr<dump::OperationsFactory> CreateOperationsFactory(
     auto secret_key = secdist.Get<dump::Secdist>().GetSecretKey(config.name);
     return std::make_unique<dump::EncryptedOperationsFactory>(
         std::move(secret_key), dump_perms);
+  } else if (config.dump_is_compressed) {
+    return std::make_unique<dump::ChunkedOperationsFactory>(
+        GetChunkedSettings(config), dump_perms);
   } else {
-    return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+    return std::make_unique<dump::FileOperationsFactory>(dump_perms,
+                                                         config.use_mmap);
   }
 }
 
 std::unique_ptr<dump::OperationsFactory> CreateDefaultOperationsFactory(
     const Config& config) {
   auto dump_perms = GetPerms(config);
-  return std::make_unique<dump::FileOperationsFactory>(dump_perms);
+  if (config.dump_is_compressed) {
+    return std::make_unique<dump::ChunkedOperationsFactory>(
+        GetChunkedSettings(config), dump_perms);
+  }
+  return std::make_unique<dump::FileOperationsFactory>(dump_perms,
+                                                       config.use_mmap);
 }
 
 }  // namespace dump
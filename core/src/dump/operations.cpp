@@ -0,0 +1,23 @@
+#include <userver/dump/operations.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+std::size_t Writer::GetPartsCountHint() const noexcept { return 0; }
+
+void Writer::BeginPart() {
+  UINVARIANT(false, "The dump format does not support parts");
+}
+
+std::vector<std::unique_ptr<Reader>> Reader::SplitParts() { return {}; }
+
+std::shared_ptr<const void> Reader::GetBackingStorage() const {
+  return nullptr;
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
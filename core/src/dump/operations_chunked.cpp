@@ -0,0 +1,526 @@
+#include <userver/dump/operations_chunked.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <utility>
+
+#include <fmt/format.h>
+#include <zlib.h>
+#include <boost/endian/conversion.hpp>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/task/task_with_result.hpp>
+#include <userver/fs/blocking/c_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/cpu_relax.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace dump {
+
+// File layout, all the integers are 64-bit little-endian:
+//
+//   chunk...
+//   (compressed-size, raw-size) of every chunk
+//   first chunk of every part
+//   chunks-count, parts-count, magic
+//
+// A chunk is stored uncompressed iff its compressed-size equals its raw-size.
+
+namespace {
+
+constexpr std::size_t kCheckTimeAfterBytes{1 << 15};
+
+// "UDMPCHNK"
+constexpr std::uint64_t kMagic{0x4b4e4843504d4455};
+constexpr std::size_t kFooterSize{3 * sizeof(std::uint64_t)};
+constexpr std::size_t kChunkInfoSize{2 * sizeof(std::uint64_t)};
+
+struct ChunkInfo final {
+  std::uint64_t offset;
+  std::uint64_t compressed_size;
+  std::uint64_t raw_size;
+};
+
+struct Index final {
+  std::vector<ChunkInfo> chunks;
+  std::vector<std::size_t> part_starts;
+};
+
+void AppendUInt64(std::string& buffer, std::uint64_t value) {
+  value = boost::endian::native_to_little(value);
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::uint64_t ParseUInt64(std::string_view& data) {
+  UASSERT(data.size() >= sizeof(std::uint64_t));
+  std::uint64_t value = 0;
+  std::memcpy(&value, data.data(), sizeof(value));
+  data.remove_prefix(sizeof(value));
+  return boost::endian::little_to_native(value);
+}
+
+std::string Compress(std::string&& raw, int level) {
+  if (level == 0) return std::move(raw);
+
+  std::string compressed(compressBound(raw.size()), '\0');
+  auto size = static_cast<uLongf>(compressed.size());
+  const auto ret =
+      compress2(reinterpret_cast<Bytef*>(compressed.data()), &size,
+                reinterpret_cast<const Bytef*>(raw.data()), raw.size(), level);
+  if (ret != Z_OK) {
+    throw Error(fmt::format("Failed to compress a dump chunk: zlib error {}",
+                            ret));
+  }
+
+  // incompressible data is stored as is
+  if (size >= raw.size()) return std::move(raw);
+  compressed.resize(size);
+  return compressed;
+}
+
+std::string Decompress(std::string&& compressed, std::size_t raw_size) {
+  if (compressed.size() == raw_size) return std::move(compressed);
+
+  std::string raw(raw_size, '\0');
+  auto size = static_cast<uLongf>(raw.size());
+  const auto ret = uncompress(
+      reinterpret_cast<Bytef*>(raw.data()), &size,
+      reinterpret_cast<const Bytef*>(compressed.data()), compressed.size());
+  if (ret != Z_OK || size != raw_size) {
+    throw Error(fmt::format(
+        "Failed to decompress a dump chunk: zlib error {}, raw-size={}, "
+        "expected-raw-size={}",
+        ret, size, raw_size));
+  }
+  return raw;
+}
+
+void Seek(fs::blocking::CFile& file, std::uint64_t offset,
+          const std::string& path) {
+  if (::fseeko(file.GetNative(), static_cast<off_t>(offset), SEEK_SET) != 0) {
+    throw Error(fmt::format("Failed to seek in the dump file \"{}\" to {}",
+                            path, offset));
+  }
+}
+
+std::string ReadExactly(fs::blocking::CFile& file, std::size_t size,
+                        const std::string& path) {
+  std::string result(size, '\0');
+  std::size_t bytes_read = 0;
+  try {
+    bytes_read = file.Read(result.data(), size);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to read from the dump file \"{}\": {}",
+                            path, ex.what()));
+  }
+  if (bytes_read != size) {
+    throw Error(fmt::format(
+        "Unexpected end-of-file in the dump file \"{}\": requested-size={}, "
+        "read-size={}",
+        path, size, bytes_read));
+  }
+  return result;
+}
+
+Index ReadIndex(fs::blocking::CFile& file, const std::string& path) {
+  const auto file_size = file.GetSize();
+  if (file_size < kFooterSize) {
+    throw Error(fmt::format("The dump file \"{}\" is too small: file-size={}",
+                            path, file_size));
+  }
+
+  Seek(file, file_size - kFooterSize, path);
+  const auto footer = ReadExactly(file, kFooterSize, path);
+  std::string_view footer_data = footer;
+  const auto chunks_count = ParseUInt64(footer_data);
+  const auto parts_count = ParseUInt64(footer_data);
+  const auto magic = ParseUInt64(footer_data);
+  if (magic != kMagic) {
+    throw Error(
+        fmt::format("The dump file \"{}\" is not a chunked dump", path));
+  }
+
+  const auto index_size =
+      chunks_count * kChunkInfoSize + parts_count * sizeof(std::uint64_t);
+  if (chunks_count > file_size || parts_count > file_size ||
+      file_size - kFooterSize < index_size) {
+    throw Error(fmt::format(
+        "Malformed index of the dump file \"{}\": file-size={}, "
+        "chunks-count={}, parts-count={}",
+        path, file_size, chunks_count, parts_count));
+  }
+
+  const auto data_size = file_size - kFooterSize - index_size;
+  Seek(file, data_size, path);
+  const auto index_data = ReadExactly(file, index_size, path);
+  std::string_view index_view = index_data;
+
+  Index index;
+  index.chunks.reserve(chunks_count);
+  std::uint64_t offset = 0;
+  for (std::uint64_t i = 0; i < chunks_count; ++i) {
+    const auto compressed_size = ParseUInt64(index_view);
+    const auto raw_size = ParseUInt64(index_view);
+    index.chunks.push_back({offset, compressed_size, raw_size});
+    offset += compressed_size;
+  }
+
+  index.part_starts.reserve(parts_count);
+  for (std::uint64_t i = 0; i < parts_count; ++i) {
+    const auto part_start = ParseUInt64(index_view);
+    if (part_start > chunks_count ||
+        (!index.part_starts.empty() && part_start < index.part_starts.back())) {
+      throw Error(fmt::format(
+          "Malformed parts of the dump file \"{}\": part-start={}", path,
+          part_start));
+    }
+    index.part_starts.push_back(part_start);
+  }
+
+  if (offset != data_size) {
+    throw Error(fmt::format(
+        "Malformed index of the dump file \"{}\": data-size={}, "
+        "chunks-size={}",
+        path, data_size, offset));
+  }
+
+  Seek(file, 0, path);
+  return index;
+}
+
+}  // namespace
+
+struct ChunkedFileWriter::Impl final {
+  struct PendingChunk final {
+    engine::TaskWithResult<std::string> task;
+    std::uint64_t raw_size;
+  };
+
+  Impl(std::string&& path, boost::filesystem::perms perms,
+       const ChunkedSettings& settings, tracing::ScopeTime& scope)
+      : final_path(std::move(path)),
+        path(final_path + ".tmp"),
+        perms(perms),
+        settings(settings),
+        cpu_relax(kCheckTimeAfterBytes, &scope),
+        task_processor(engine::current_task::GetTaskProcessor()) {
+    UINVARIANT(settings.chunk_size > 0, "chunk_size must be positive");
+    UINVARIANT(settings.parallelism > 0, "parallelism must be positive");
+  }
+
+  void FlushChunk();
+  void WriteFrontChunk();
+  void Write(std::string_view data);
+
+  fs::blocking::CFile file;
+  std::string final_path;
+  std::string path;
+  boost::filesystem::perms perms;
+  const ChunkedSettings settings;
+  utils::StreamingCpuRelax cpu_relax;
+  engine::TaskProcessor& task_processor;
+
+  std::string chunk;
+  std::deque<PendingChunk> pending;
+  std::size_t chunks_count{0};
+  std::string index;
+  std::vector<std::size_t> part_starts;
+};
+
+void ChunkedFileWriter::Impl::FlushChunk() {
+  if (chunk.empty()) return;
+
+  const auto raw_size = chunk.size();
+  pending.push_back(
+      {engine::AsyncNoSpan(task_processor,
+                           [raw = std::move(chunk),
+                            level = settings.compression_level]() mutable {
+                             return Compress(std::move(raw), level);
+                           }),
+       raw_size});
+  ++chunks_count;
+  chunk = std::string{};
+
+  while (pending.size() > settings.parallelism) WriteFrontChunk();
+}
+
+void ChunkedFileWriter::Impl::WriteFrontChunk() {
+  UASSERT(!pending.empty());
+  auto& front = pending.front();
+  const auto compressed = front.task.Get();
+  Write(compressed);
+  AppendUInt64(index, compressed.size());
+  AppendUInt64(index, front.raw_size);
+  pending.pop_front();
+}
+
+void ChunkedFileWriter::Impl::Write(std::string_view data) {
+  try {
+    file.Write(data);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to write to the dump file \"{}\": {}",
+                            path, ex.what()));
+  }
+}
+
+ChunkedFileWriter::ChunkedFileWriter(std::string path,
+                                     boost::filesystem::perms perms,
+                                     const ChunkedSettings& settings,
+                                     tracing::ScopeTime& scope)
+    : impl_(std::make_unique<Impl>(std::move(path), perms, settings, scope)) {
+  constexpr fs::blocking::OpenMode mode{
+      fs::blocking::OpenFlag::kWrite, fs::blocking::OpenFlag::kExclusiveCreate};
+  const auto tmp_perms = impl_->perms | boost::filesystem::perms::owner_write;
+
+  try {
+    impl_->file = fs::blocking::CFile{impl_->path, mode, tmp_perms};
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to open the dump file for write \"{}\": {}",
+                            impl_->path, ex.what()));
+  }
+}
+
+ChunkedFileWriter::~ChunkedFileWriter() = default;
+
+void ChunkedFileWriter::WriteRaw(std::string_view data) {
+  const auto data_size = data.size();
+  while (!data.empty()) {
+    if (impl_->chunk.empty()) impl_->chunk.reserve(impl_->settings.chunk_size);
+
+    const auto size =
+        std::min(data.size(), impl_->settings.chunk_size - impl_->chunk.size());
+    impl_->chunk.append(data.substr(0, size));
+    data.remove_prefix(size);
+    if (impl_->chunk.size() == impl_->settings.chunk_size) impl_->FlushChunk();
+  }
+  impl_->cpu_relax.Relax(data_size);
+}
+
+std::size_t ChunkedFileWriter::GetPartsCountHint() const noexcept {
+  return impl_->settings.parallelism;
+}
+
+void ChunkedFileWriter::BeginPart() {
+  impl_->FlushChunk();
+  impl_->part_starts.push_back(impl_->chunks_count);
+}
+
+void ChunkedFileWriter::Finish() {
+  impl_->FlushChunk();
+  while (!impl_->pending.empty()) impl_->WriteFrontChunk();
+
+  auto tail = std::move(impl_->index);
+  for (const auto part_start : impl_->part_starts) {
+    AppendUInt64(tail, part_start);
+  }
+  AppendUInt64(tail, impl_->chunks_count);
+  AppendUInt64(tail, impl_->part_starts.size());
+  AppendUInt64(tail, kMagic);
+  impl_->Write(tail);
+
+  try {
+    // See FileWriter::Finish
+    impl_->file.Flush();
+    std::move(impl_->file).Close();
+    fs::blocking::Chmod(impl_->path, impl_->perms);
+    fs::blocking::Rename(impl_->path, impl_->final_path);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to finalize dump \"{}\". Reason: {}",
+                            impl_->path, ex.what()));
+  }
+}
+
+struct ChunkedFileReader::Impl final {
+  // Opens the whole file
+  Impl(std::string&& path, const ChunkedSettings& settings)
+      : path(std::move(path)),
+        prefetch(settings.parallelism),
+        task_processor(engine::current_task::GetTaskProcessor()) {
+    Open();
+    index = std::make_shared<const Index>(ReadIndex(file, this->path));
+    end_chunk = index->chunks.size();
+  }
+
+  // Opens a part of the file, its chunks are decompressed in place
+  Impl(std::string path, std::shared_ptr<const Index> index,
+       std::size_t first_chunk, std::size_t end_chunk)
+      : path(std::move(path)),
+        index(std::move(index)),
+        next_chunk(first_chunk),
+        end_chunk(end_chunk),
+        prefetch(0),
+        task_processor(engine::current_task::GetTaskProcessor()) {
+    Open();
+    if (next_chunk != end_chunk) {
+      Seek(file, this->index->chunks[next_chunk].offset, this->path);
+    }
+  }
+
+  void Open() {
+    try {
+      file = fs::blocking::CFile(path, fs::blocking::OpenFlag::kRead);
+    } catch (const std::exception& ex) {
+      throw Error(fmt::format(
+          "Failed to open the dump file for reading \"{}\". Reason: {}", path,
+          ex.what()));
+    }
+  }
+
+  std::string ReadCompressed(const ChunkInfo& info) {
+    return ReadExactly(file, info.compressed_size, path);
+  }
+
+  void Prefetch() {
+    while (next_chunk != end_chunk && decompressing.size() < prefetch) {
+      const auto& info = index->chunks[next_chunk++];
+      decompressing.push_back(engine::AsyncNoSpan(
+          task_processor, [compressed = ReadCompressed(info),
+                           raw_size = info.raw_size]() mutable {
+            return Decompress(std::move(compressed), raw_size);
+          }));
+    }
+  }
+
+  bool LoadNextChunk() {
+    if (prefetch == 0) {
+      if (next_chunk == end_chunk) return false;
+      const auto& info = index->chunks[next_chunk++];
+      current = Decompress(ReadCompressed(info), info.raw_size);
+    } else {
+      Prefetch();
+      if (decompressing.empty()) return false;
+      current = decompressing.front().Get();
+      decompressing.pop_front();
+      Prefetch();
+    }
+    position = 0;
+    return true;
+  }
+
+  // The first chunk that has not been loaded into `current` yet
+  std::size_t GetUnloadedChunk() const noexcept {
+    return next_chunk - decompressing.size();
+  }
+
+  std::uint64_t GetUnreadSize() const noexcept {
+    std::uint64_t result = current.size() - position;
+    for (auto i = GetUnloadedChunk(); i < end_chunk; ++i) {
+      result += index->chunks[i].raw_size;
+    }
+    return result;
+  }
+
+  fs::blocking::CFile file;
+  std::string path;
+  std::shared_ptr<const Index> index;
+  std::size_t next_chunk{0};
+  std::size_t end_chunk{0};
+  const std::size_t prefetch;
+  engine::TaskProcessor& task_processor;
+
+  std::deque<engine::TaskWithResult<std::string>> decompressing;
+  std::string current;
+  std::size_t position{0};
+  std::string buffer;
+};
+
+ChunkedFileReader::ChunkedFileReader(std::string path,
+                                     const ChunkedSettings& settings)
+    : impl_(std::make_unique<Impl>(std::move(path), settings)) {}
+
+ChunkedFileReader::ChunkedFileReader(std::unique_ptr<Impl>&& impl)
+    : impl_(std::move(impl)) {}
+
+ChunkedFileReader::~ChunkedFileReader() = default;
+
+std::string_view ChunkedFileReader::ReadRaw(std::size_t max_size) {
+  auto& impl = *impl_;
+  if (impl.current.size() - impl.position >= max_size) {
+    const auto result =
+        std::string_view{impl.current}.substr(impl.position, max_size);
+    impl.position += max_size;
+    return result;
+  }
+
+  // the data spans several chunks
+  impl.buffer.clear();
+  while (impl.buffer.size() < max_size) {
+    if (impl.position == impl.current.size() && !impl.LoadNextChunk()) break;
+
+    const auto size = std::min(max_size - impl.buffer.size(),
+                               impl.current.size() - impl.position);
+    impl.buffer.append(impl.current, impl.position, size);
+    impl.position += size;
+  }
+  return impl.buffer;
+}
+
+std::vector<std::unique_ptr<Reader>> ChunkedFileReader::SplitParts() {
+  auto& impl = *impl_;
+  // parts of parts are not supported
+  if (impl.prefetch == 0 || impl.index->part_starts.empty()) return {};
+
+  const auto& part_starts = impl.index->part_starts;
+  if (impl.position != impl.current.size() ||
+      impl.GetUnloadedChunk() != part_starts.front()) {
+    throw Error(fmt::format(
+        "Unexpected data before the parts of the dump file \"{}\"", impl.path));
+  }
+
+  std::vector<std::unique_ptr<Reader>> parts;
+  parts.reserve(part_starts.size());
+  for (std::size_t i = 0; i < part_starts.size(); ++i) {
+    const auto part_end = i + 1 < part_starts.size()
+                              ? part_starts[i + 1]
+                              : impl.index->chunks.size();
+    parts.push_back(std::unique_ptr<Reader>{
+        new ChunkedFileReader(std::make_unique<Impl>(
+            impl.path, impl.index, part_starts[i], part_end))});
+  }
+
+  // all the data belongs to the parts now
+  impl.decompressing.clear();
+  impl.next_chunk = impl.end_chunk;
+  return parts;
+}
+
+void ChunkedFileReader::Finish() {
+  const auto unread_size = impl_->GetUnreadSize();
+  if (unread_size != 0) {
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "unread-size={}",
+                    impl_->path, unread_size));
+  }
+
+  try {
+    std::move(impl_->file).Close();
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format("Failed to finalize dump file \"{}\". Reason: {}",
+                            impl_->path, ex.what()));
+  }
+}
+
+ChunkedOperationsFactory::ChunkedOperationsFactory(
+    const ChunkedSettings& settings, boost::filesystem::perms perms)
+    : settings_(settings), perms_(perms) {}
+
+std::unique_ptr<Reader> ChunkedOperationsFactory::CreateReader(
+    std::string full_path) {
+  return std::make_unique<ChunkedFileReader>(std::move(full_path), settings_);
+}
+
+std::unique_ptr<Writer> ChunkedOperationsFactory::CreateWriter(
+    std::string full_path, tracing::ScopeTime& scope) {
+  return std::make_unique<ChunkedFileWriter>(std::move(full_path), perms_,
+                                             settings_, scope);
+}
+
+}  // namespace dump
+
+USERVER_NAMESPACE_END
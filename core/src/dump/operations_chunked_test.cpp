@@ -0,0 +1,175 @@
+#include <userver/dump/operations_chunked.hpp>
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include <userver/dump/common_containers.hpp>
+#include <userver/dump/parts.hpp>
+#include <userver/dump/unsafe.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/fs/blocking/read.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+std::string DumpFilePath(const fs::blocking::TempDirectory& dir) {
+  return dir.GetPath() + "/dump";
+}
+
+dump::ChunkedSettings MakeSettings(int compression_level = 1) {
+  dump::ChunkedSettings settings;
+  settings.compression_level = compression_level;
+  // many chunks for a small dump
+  settings.chunk_size = 7;
+  settings.parallelism = 3;
+  return settings;
+}
+
+void WriteDump(const std::string& path, const dump::ChunkedSettings& settings,
+               const std::function<void(dump::Writer&)>& write) {
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::ChunkedFileWriter writer(path, boost::filesystem::perms::owner_read,
+                                 settings, scope_time);
+  write(writer);
+  writer.Finish();
+}
+
+}  // namespace
+
+UTEST(DumpOperationsChunked, WriteReadRaw) {
+  for (const auto compression_level : {0, 1, 9}) {
+    const auto dir = fs::blocking::TempDirectory::Create();
+    const auto path = DumpFilePath(dir);
+    const auto settings = MakeSettings(compression_level);
+
+    constexpr std::size_t kMaxLength = 30;
+    WriteDump(path, settings, [&](dump::Writer& writer) {
+      for (std::size_t i = 0; i <= kMaxLength; ++i) {
+        WriteStringViewUnsafe(writer, std::string(i, 'a' + i % 26));
+      }
+    });
+
+    dump::ChunkedFileReader reader(path, settings);
+    EXPECT_TRUE(reader.SplitParts().empty());
+    for (std::size_t i = 0; i <= kMaxLength; ++i) {
+      EXPECT_EQ(ReadStringViewUnsafe(reader, i), std::string(i, 'a' + i % 26));
+    }
+    reader.Finish();
+  }
+}
+
+UTEST(DumpOperationsChunked, Compresses) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  auto settings = MakeSettings();
+  settings.chunk_size = 1024 * 1024;
+
+  const std::string data(1024 * 1024, 'a');
+  WriteDump(path, settings, [&](dump::Writer& writer) {
+    WriteStringViewUnsafe(writer, data);
+  });
+  EXPECT_LT(fs::blocking::ReadFileContents(path).size(), data.size() / 100);
+
+  dump::ChunkedFileReader reader(path, settings);
+  EXPECT_EQ(ReadStringViewUnsafe(reader, data.size()), data);
+  reader.Finish();
+}
+
+UTEST(DumpOperationsChunked, EmptyDump) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  const auto settings = MakeSettings();
+
+  WriteDump(path, settings, [](dump::Writer&) {});
+
+  dump::ChunkedFileReader reader(path, settings);
+  EXPECT_EQ(ReadUnsafeAtMost(reader, 1), "");
+  reader.Finish();
+}
+
+UTEST(DumpOperationsChunked, Parts) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  const auto settings = MakeSettings();
+
+  std::map<int, std::string> data;
+  for (int i = 0; i < 100; ++i) data.emplace(i, std::to_string(i));
+
+  WriteDump(path, settings, [&](dump::Writer& writer) {
+    writer.Write(std::string{"header"});
+    ASSERT_EQ(writer.GetPartsCountHint(), settings.parallelism);
+    dump::WriteContainerParts(writer, data, writer.GetPartsCountHint());
+  });
+
+  dump::ChunkedFileReader reader(path, settings);
+  EXPECT_EQ(reader.Read<std::string>(), "header");
+  auto parts = reader.SplitParts();
+  ASSERT_EQ(parts.size(), settings.parallelism);
+  reader.Finish();
+
+  std::vector<engine::TaskWithResult<std::map<int, std::string>>> tasks;
+  for (auto& part : parts) {
+    tasks.push_back(engine::AsyncNoSpan([&part] {
+      auto result = part->Read<std::map<int, std::string>>();
+      part->Finish();
+      return result;
+    }));
+  }
+
+  std::map<int, std::string> result;
+  for (auto& task : tasks) dump::MergeContainers(result, task.Get());
+  EXPECT_EQ(result, data);
+}
+
+UTEST(DumpOperationsChunked, DataBeforeParts) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  const auto settings = MakeSettings();
+
+  WriteDump(path, settings, [](dump::Writer& writer) {
+    writer.Write(std::string{"header"});
+    writer.BeginPart();
+    writer.Write(1);
+  });
+
+  dump::ChunkedFileReader reader(path, settings);
+  UEXPECT_THROW(reader.SplitParts(), dump::Error);
+}
+
+UTEST(DumpOperationsChunked, Underread) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+  const auto settings = MakeSettings();
+
+  WriteDump(path, settings, [](dump::Writer& writer) {
+    WriteStringViewUnsafe(writer, std::string(10, 'a'));
+  });
+
+  dump::ChunkedFileReader reader(path, settings);
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  try {
+    reader.Finish();
+  } catch (const dump::Error& ex) {
+    EXPECT_NE(std::string{ex.what()}.find("unread-size=1"), std::string::npos)
+        << ex.what();
+    return;
+  }
+  FAIL();
+}
+
+UTEST(DumpOperationsChunked, NotChunked) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(100, 'a'));
+
+  UEXPECT_THROW(dump::ChunkedFileReader(file.GetPath(), MakeSettings()),
+                dump::Error);
+}
+
+USERVER_NAMESPACE_END
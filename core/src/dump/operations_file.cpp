@@ -1,11 +1,16 @@
 #include <userver/dump/operations_file.hpp>
 
 #include <algorithm>
+#include <cerrno>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
+#include <sys/mman.h>
+
 #include <fmt/format.h>
 
+#include <userver/fs/blocking/file_descriptor.hpp>
 #include <userver/fs/blocking/write.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -116,11 +121,82 @@ void FileReader::Finish() {
   }
 }
 
-FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms)
-    : perms_(perms) {}
+class MmapFileReader::Mapping final {
+ public:
+  explicit Mapping(const std::string& path) {
+    auto file = fs::blocking::FileDescriptor::Open(
+        path, fs::blocking::OpenFlag::kRead);
+    size_ = file.GetSize();
+    // an empty file can not be mapped
+    if (size_ == 0) return;
+
+    data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.GetNative(), 0);
+    if (data_ == MAP_FAILED) {
+      throw std::system_error(errno, std::generic_category(), "mmap");
+    }
+    // the dump is deserialized from the beginning to the end
+    ::madvise(data_, size_, MADV_SEQUENTIAL);
+  }
+
+  Mapping(const Mapping&) = delete;
+  Mapping& operator=(const Mapping&) = delete;
+
+  ~Mapping() {
+    if (data_) ::munmap(data_, size_);
+  }
+
+  std::string_view GetData() const noexcept {
+    return {static_cast<const char*>(data_), size_};
+  }
+
+ private:
+  void* data_{nullptr};
+  std::size_t size_{0};
+};
+
+MmapFileReader::MmapFileReader(std::string path) : path_(std::move(path)) {
+  try {
+    mapping_ = std::make_shared<const Mapping>(path_);
+  } catch (const std::exception& ex) {
+    throw Error(fmt::format(
+        "Failed to map the dump file for reading \"{}\". Reason: {}", path_,
+        ex.what()));
+  }
+  unread_ = mapping_->GetData();
+}
+
+MmapFileReader::~MmapFileReader() = default;
+
+std::string_view MmapFileReader::ReadRaw(std::size_t max_size) {
+  const auto result = unread_.substr(0, max_size);
+  unread_.remove_prefix(result.size());
+  return result;
+}
+
+void MmapFileReader::Finish() {
+  if (!unread_.empty()) {
+    const auto file_size = mapping_->GetData().size();
+    throw Error(
+        fmt::format("Unexpected extra data at the end of the dump file \"{}\": "
+                    "file-size={}, position={}, unread-size={}",
+                    path_, file_size, file_size - unread_.size(),
+                    unread_.size()));
+  }
+}
+
+std::shared_ptr<const void> MmapFileReader::GetBackingStorage() const {
+  return mapping_;
+}
+
+FileOperationsFactory::FileOperationsFactory(boost::filesystem::perms perms,
+                                             bool use_mmap)
+    : perms_(perms), use_mmap_(use_mmap) {}
 
 std::unique_ptr<Reader> FileOperationsFactory::CreateReader(
     std::string full_path) {
+  if (use_mmap_) {
+    return std::make_unique<MmapFileReader>(std::move(full_path));
+  }
   return std::make_unique<FileReader>(std::move(full_path));
 }
 
@@ -2,6 +2,7 @@
 
 #include <boost/regex.hpp>
 
+#include <userver/dump/common.hpp>
 #include <userver/dump/unsafe.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/temp_directory.hpp>
@@ -113,4 +114,74 @@ TEST(DumpOperationsFile, Underread) {
   FAIL();
 }
 
+TEST(DumpOperationsFile, MmapReadRaw) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), "abcdef");
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 2), "ab");
+  EXPECT_EQ(ReadUnsafeAtMost(reader, 10), "cdef");
+  EXPECT_EQ(ReadUnsafeAtMost(reader, 10), "");
+  reader.Finish();
+}
+
+TEST(DumpOperationsFile, MmapEmptyDump) {
+  const auto file = fs::blocking::TempFile::Create();
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadUnsafeAtMost(reader, 1), "");
+  reader.Finish();
+}
+
+TEST(DumpOperationsFile, MmapUnderread) {
+  const auto file = fs::blocking::TempFile::Create();
+  fs::blocking::RewriteFileContents(file.GetPath(), std::string(10, 'a'));
+
+  dump::MmapFileReader reader(file.GetPath());
+  EXPECT_EQ(ReadStringViewUnsafe(reader, 9), std::string(9, 'a'));
+  try {
+    reader.Finish();
+  } catch (const dump::Error& ex) {
+    EXPECT_TRUE(boost::regex_match(
+        ex.what(),
+        boost::regex{"Unexpected extra data at the end of the dump file "
+                     "\".+\": file-size=10, position=9, unread-size=1"}))
+        << ex.what();
+    return;
+  }
+  FAIL();
+}
+
+UTEST(DumpOperationsFile, MmapBorrowedStrings) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  const auto path = DumpFilePath(dir);
+
+  auto scope_time = tracing::Span::CurrentSpan().CreateScopeTime("dump");
+  dump::FileWriter writer(path, boost::filesystem::perms::owner_read,
+                          scope_time);
+  writer.Write(std::string{"first"});
+  writer.Write(std::string{"second"});
+  writer.Finish();
+
+  {
+    dump::FileReader reader(path);
+    std::shared_ptr<const void> storage;
+    UEXPECT_THROW(ReadBorrowedStringView(reader, storage), dump::Error);
+  }
+
+  std::shared_ptr<const void> storage;
+  std::string_view first;
+  std::string_view second;
+  {
+    dump::MmapFileReader reader(path);
+    first = ReadBorrowedStringView(reader, storage);
+    second = ReadBorrowedStringView(reader, storage);
+    reader.Finish();
+  }
+  // the views outlive the reader and the file
+  fs::blocking::RemoveSingleFile(path);
+  EXPECT_EQ(first, "first");
+  EXPECT_EQ(second, "second");
+}
+
 USERVER_NAMESPACE_END
@@ -31,6 +31,20 @@ std::string_view ReadStringViewUnsafe(Reader& reader, std::size_t size) {
   return result;
 }
 
+std::string_view ReadBorrowedStringView(Reader& reader,
+                                        std::shared_ptr<const void>& storage) {
+  if (!storage) {
+    storage = reader.GetBackingStorage();
+    if (!storage) {
+      throw Error(
+          "The dump reader does not support borrowing the data, enable "
+          "'mmap' for the dump");
+    }
+  }
+  UASSERT(storage == reader.GetBackingStorage());
+  return ReadStringViewUnsafe(reader);
+}
+
 std::string_view ReadUnsafeAtMost(Reader& reader, std::size_t max_size) {
   const auto result = reader.ReadRaw(max_size);
   UASSERT(result.size() <= max_size);
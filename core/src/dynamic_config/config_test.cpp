@@ -7,6 +7,8 @@
 #include <userver/dynamic_config/storage_mock.hpp>
 #include <userver/dynamic_config/test_helpers.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/formats/json/value_builder.hpp>
+#include <utils/internal_tag.hpp>
 
 using namespace std::chrono_literals;
 
@@ -492,6 +494,92 @@ UTEST(DynamicConfigSubscription, Snippet) {
   EXPECT_EQ(subscriber.GetFooInterestingEventCounter(), 1);
 }
 
+struct NotComparableConfig final {
+  int value;
+};
+
+const dynamic_config::Key kNotComparableConfig{
+    dynamic_config::ConstantConfig{}, NotComparableConfig{0}};
+
+UTEST(DynamicConfigSubscription, SubsetDiff) {
+  dynamic_config::StorageMock storage{{kIntConfig, 1},
+                                      {kNotComparableConfig, {1}}};
+  auto source = storage.GetSource();
+  CustomSubscriber subscriber;
+
+  auto scope =
+      source.UpdateAndListen(&subscriber, "", &CustomSubscriber::OnConfigUpdate,
+                             kNotComparableConfig);
+  EXPECT_EQ(subscriber.GetCounter(), 1);
+
+  // kNotComparableConfig is shared with the previous snapshot
+  storage.Extend({{kIntConfig, 2}});
+  EXPECT_EQ(subscriber.GetCounter(), 1);
+
+  // Can not be compared, so considered changed
+  storage.Extend({{kNotComparableConfig, {1}}});
+  EXPECT_EQ(subscriber.GetCounter(), 2);
+}
+
+const dynamic_config::Key<int> kDeltaIntConfig{"DELTA_INT_CONFIG", 1};
+
+const dynamic_config::Key<std::string> kDeltaStringConfig{
+    "DELTA_STRING_CONFIG", std::string{"foo"}};
+
+UTEST(DynamicConfig, DeltaParse) {
+  const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+  const dynamic_config::impl::SnapshotData first{docs_map, {}};
+
+  auto new_docs_map = docs_map;
+  new_docs_map.Set("DELTA_INT_CONFIG",
+                   formats::json::ValueBuilder{2}.ExtractValue());
+  const auto changed_names =
+      new_docs_map.GetChangedNames(docs_map, utils::InternalTag{});
+  EXPECT_EQ(changed_names,
+            utils::impl::TransparentSet<std::string>{"DELTA_INT_CONFIG"});
+
+  const dynamic_config::impl::SnapshotData second{new_docs_map, first,
+                                                  changed_names};
+  const auto int_id =
+      dynamic_config::impl::ConfigIdGetter::Get(kDeltaIntConfig);
+  const auto string_id =
+      dynamic_config::impl::ConfigIdGetter::Get(kDeltaStringConfig);
+
+  EXPECT_EQ(first.Get<int>(int_id), 1);
+  EXPECT_EQ(second.Get<int>(int_id), 2);
+  EXPECT_FALSE(second.IsSharedWith(first, int_id));
+
+  EXPECT_EQ(second.Get<std::string>(string_id), "foo");
+  EXPECT_TRUE(second.IsSharedWith(first, string_id));
+  EXPECT_EQ(&second.Get<std::string>(string_id),
+            &first.Get<std::string>(string_id));
+}
+
+int ParseDeltaIntViaAsJson(const dynamic_config::DocsMap& docs_map) {
+  // reads DELTA_INT_CONFIG without a DocsMap::Get call
+  return docs_map.AsJson()["DELTA_INT_CONFIG"].As<int>(0);
+}
+
+const dynamic_config::Key<int> kDeltaAsJsonConfig{
+    ParseDeltaIntViaAsJson, {{"DELTA_AS_JSON_CONFIG", 0}}};
+
+UTEST(DynamicConfig, DeltaParseWholeDocsMap) {
+  const auto docs_map = dynamic_config::impl::MakeDefaultDocsMap();
+  const dynamic_config::impl::SnapshotData first{docs_map, {}};
+
+  auto new_docs_map = docs_map;
+  new_docs_map.Set("DELTA_INT_CONFIG",
+                   formats::json::ValueBuilder{2}.ExtractValue());
+  const dynamic_config::impl::SnapshotData second{
+      new_docs_map, first,
+      new_docs_map.GetChangedNames(docs_map, utils::InternalTag{})};
+
+  const auto id = dynamic_config::impl::ConfigIdGetter::Get(kDeltaAsJsonConfig);
+  EXPECT_EQ(first.Get<int>(id), 1);
+  EXPECT_EQ(second.Get<int>(id), 2);
+  EXPECT_FALSE(second.IsSharedWith(first, id));
+}
+
 const dynamic_config::Key<formats::json::Value> kJsonConfig{
     dynamic_config::ConstantConfig{}, {}};
 
@@ -8,10 +8,19 @@
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/utils/enumerate.hpp>
 #include <userver/utils/impl/static_registration.hpp>
+#include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace dynamic_config::impl {
+
+struct ParsedConfig final {
+  std::any value;
+  // Names of the docs read by the parser, std::nullopt for the overrides and
+  // for the parsers that read the whole DocsMap
+  std::optional<std::vector<std::string>> docs_names;
+};
+
 namespace {
 
 struct VariableMetadata final {
@@ -34,6 +43,32 @@ bool IsValidJson(std::string_view json_string) {
   }
 }
 
+std::shared_ptr<const ParsedConfig> Parse(const VariableMetadata& metadata,
+                                          const DocsMap& docs_map) {
+  std::any value;
+  docs_map.StartRecordingNames(utils::InternalTag{});
+  try {
+    value = metadata.factory(docs_map);
+  } catch (const std::exception& ex) {
+    docs_map.StopRecordingNames(utils::InternalTag{});
+    throw ConfigParseError(
+        fmt::format("{} while parsing dynamic config values. {}",
+                    compiler::GetTypeName(typeid(ex)), ex.what()));
+  }
+  auto docs_names = docs_map.StopRecordingNames(utils::InternalTag{});
+  return std::make_shared<const ParsedConfig>(
+      ParsedConfig{std::move(value), std::move(docs_names)});
+}
+
+bool DependsOn(const ParsedConfig& config,
+               const utils::impl::TransparentSet<std::string>& names) {
+  if (!config.docs_names) return true;
+  for (const auto& name : *config.docs_names) {
+    if (names.count(name) != 0) return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 [[noreturn]] void WrapGetError(const std::exception& ex, std::type_index type) {
@@ -112,7 +147,8 @@ SnapshotData::SnapshotData(const std::vector<KeyValue>& config_variables) {
   user_configs_.resize(Registry().size());
 
   for (const auto& config_variable : config_variables) {
-    user_configs_[config_variable.GetId()] = config_variable.GetValue();
+    user_configs_[config_variable.GetId()] = std::make_shared<
+        const ParsedConfig>(ParsedConfig{config_variable.GetValue(), {}});
   }
 }
 
@@ -121,15 +157,9 @@ SnapshotData::SnapshotData(const DocsMap& defaults,
     : SnapshotData(overrides) {
   utils::StreamingCpuRelax relax(1, nullptr);
   for (const auto [id, metadata] : utils::enumerate(Registry())) {
-    if (!user_configs_[id].has_value()) {
+    if (!user_configs_[id]) {
       relax.Relax(1);
-      try {
-        user_configs_[id] = metadata.factory(defaults);
-      } catch (const std::exception& ex) {
-        throw ConfigParseError(
-            fmt::format("{} while parsing dynamic config values. {}",
-                        compiler::GetTypeName(typeid(ex)), ex.what()));
-      }
+      user_configs_[id] = Parse(metadata, defaults);
     }
   }
 }
@@ -140,20 +170,53 @@ SnapshotData::SnapshotData(const SnapshotData& defaults,
   if (defaults.IsEmpty()) return;
 
   for (const auto [id, factory] : utils::enumerate(Registry())) {
-    if (user_configs_[id].has_value()) continue;
+    if (user_configs_[id]) continue;
     user_configs_[id] = defaults.user_configs_[id];
   }
 }
 
+SnapshotData::SnapshotData(
+    const DocsMap& docs_map, const SnapshotData& previous,
+    const utils::impl::TransparentSet<std::string>& changed_names) {
+  utils::impl::AssertStaticRegistrationFinished();
+  const auto& registry = Registry();
+  UASSERT(previous.IsEmpty() ||
+          previous.user_configs_.size() == registry.size());
+  user_configs_.resize(registry.size());
+
+  utils::StreamingCpuRelax relax(1, nullptr);
+  for (const auto [id, metadata] : utils::enumerate(registry)) {
+    const auto* previous_config =
+        previous.IsEmpty() ? nullptr : previous.user_configs_[id].get();
+    if (previous_config && !DependsOn(*previous_config, changed_names)) {
+      user_configs_[id] = previous.user_configs_[id];
+      // Keeps the detection of the unused configs of DocsMap working
+      for (const auto& name : *previous_config->docs_names) {
+        if (docs_map.Has(name)) docs_map.Get(name);
+      }
+      continue;
+    }
+
+    relax.Relax(1);
+    user_configs_[id] = Parse(metadata, docs_map);
+  }
+}
+
 bool SnapshotData::IsEmpty() const noexcept { return user_configs_.empty(); }
 
+bool SnapshotData::IsSharedWith(const SnapshotData& other,
+                                ConfigId id) const noexcept {
+  return id < user_configs_.size() && id < other.user_configs_.size() &&
+         user_configs_[id] && user_configs_[id] == other.user_configs_[id];
+}
+
 const std::any& SnapshotData::DoGet(ConfigId id) const {
   UASSERT_MSG(id < user_configs_.size(), "SnapshotData is in an empty state.");
   const auto& config = user_configs_[id];
-  if (!config.has_value()) {
+  if (!config || !config->value.has_value()) {
     throw std::logic_error("This type is not registered as config");
   }
-  return config;
+  return config->value;
 }
 
 }  // namespace dynamic_config::impl
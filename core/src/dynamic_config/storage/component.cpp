@@ -69,6 +69,8 @@ class DynamicConfig::Impl final {
  private:
   dynamic_config::impl::SnapshotData ParseConfig(
       const dynamic_config::DocsMap& value);
+  dynamic_config::impl::SnapshotData DoParseConfig(
+      const dynamic_config::DocsMap& value);
 
   void DoSetConfig(const dynamic_config::DocsMap& value);
 
@@ -87,6 +89,9 @@ class DynamicConfig::Impl final {
   engine::TaskProcessor* fs_task_processor_;
 
   dynamic_config::impl::StorageData cache_;
+  // Docs of the current config, to parse only the changed configs
+  dynamic_config::DocsMap docs_map_;
+  engine::Mutex set_config_mutex_;
   std::string fs_loading_error_msg_;
   dynamic_config::DocsMap fallback_config_;
 
@@ -181,7 +186,7 @@ void DynamicConfig::Impl::NotifyLoadingFailed(std::string_view updater,
 dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
     const dynamic_config::DocsMap& value) {
   try {
-    dynamic_config::impl::SnapshotData config(value, {});
+    auto config = DoParseConfig(value);
     stats_.was_last_parse_successful = true;
     alert_storage_.StopAlertNow("config_parse_error");
     return config;
@@ -196,7 +201,18 @@ dynamic_config::impl::SnapshotData DynamicConfig::Impl::ParseConfig(
   }
 }
 
+dynamic_config::impl::SnapshotData DynamicConfig::Impl::DoParseConfig(
+    const dynamic_config::DocsMap& value) {
+  if (!Has()) return dynamic_config::impl::SnapshotData(value, {});
+
+  const auto changed_names =
+      value.GetChangedNames(docs_map_, utils::InternalTag{});
+  const auto previous = cache_.Read();
+  return dynamic_config::impl::SnapshotData(value, *previous, changed_names);
+}
+
 void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
+  const std::lock_guard lock(set_config_mutex_);
   auto config = ParseConfig(value);
 
   if (!value.GetConfigsExpectedToBeUsed(utils::InternalTag{}).empty()) {
@@ -212,6 +228,7 @@ void DynamicConfig::Impl::DoSetConfig(const dynamic_config::DocsMap& value) {
     loaded_cv_.NotifyAll();
   };
   cache_.Update(std::move(config), std::move(after_assign_hook));
+  docs_map_ = value;
 }
 
 void DynamicConfig::Impl::SetConfig(std::string_view updater,
@@ -1,11 +1,13 @@
 #include <userver/dynamic_config/value.hpp>
 
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 
 #include <userver/formats/json/serialize.hpp>
 #include <userver/formats/json/value_builder.hpp>
+#include <userver/utils/assert.hpp>
 #include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -13,6 +15,7 @@ USERVER_NAMESPACE_BEGIN
 namespace dynamic_config {
 
 formats::json::Value DocsMap::Get(std::string_view name) const {
+  RecordName(name);
   const auto it = utils::impl::FindTransparent(docs_, name);
   if (it == docs_.end()) {
     throw std::runtime_error(fmt::format("Can't find doc for '{}'", name));
@@ -28,6 +31,7 @@ formats::json::Value DocsMap::Get(std::string_view name) const {
 }
 
 bool DocsMap::Has(std::string_view name) const {
+  RecordName(name);
   return utils::impl::FindTransparent(docs_, name) != docs_.end();
 }
 
@@ -56,7 +60,10 @@ void DocsMap::Parse(formats::json::Value json, bool empty_ok) {
   }
 }
 
-size_t DocsMap::Size() const { return docs_.size(); }
+size_t DocsMap::Size() const {
+  RecordAllNames();
+  return docs_.size();
+}
 
 void DocsMap::MergeOrAssign(DocsMap&& source) {
   auto new_docs = std::move(source.docs_);
@@ -65,20 +72,25 @@ void DocsMap::MergeOrAssign(DocsMap&& source) {
 }
 
 void DocsMap::MergeMissing(const DocsMap& source) {
+  source.RecordAllNames();
   docs_.insert(source.docs_.begin(), source.docs_.end());
 }
 
 std::unordered_set<std::string> DocsMap::GetNames() const {
+  RecordAllNames();
   std::unordered_set<std::string> names;
   for (const auto& [k, v] : docs_) names.insert(k);
   return names;
 }
 
 formats::json::Value DocsMap::AsJson() const {
+  RecordAllNames();
   return formats::json::ValueBuilder{docs_}.ExtractValue();
 }
 
 bool DocsMap::AreContentsEqual(const DocsMap& other) const {
+  RecordAllNames();
+  other.RecordAllNames();
   return docs_ == other.docs_;
 }
 
@@ -92,6 +104,44 @@ DocsMap::GetConfigsExpectedToBeUsed(utils::InternalTag) const {
   return configs_to_be_used_;
 }
 
+void DocsMap::StartRecordingNames(utils::InternalTag) const {
+  recorded_names_.emplace();
+  recorded_all_names_ = false;
+}
+
+std::optional<std::vector<std::string>> DocsMap::StopRecordingNames(
+    utils::InternalTag) const {
+  UASSERT(recorded_names_);
+  auto result = std::exchange(recorded_names_, std::nullopt);
+  if (std::exchange(recorded_all_names_, false)) return std::nullopt;
+  return result;
+}
+
+utils::impl::TransparentSet<std::string> DocsMap::GetChangedNames(
+    const DocsMap& previous, utils::InternalTag) const {
+  utils::impl::TransparentSet<std::string> result;
+  for (const auto& [name, value] : docs_) {
+    const auto it = utils::impl::FindTransparent(previous.docs_, name);
+    if (it == previous.docs_.end() || it->second != value) {
+      result.insert(name);
+    }
+  }
+  for (const auto& [name, value] : previous.docs_) {
+    if (utils::impl::FindTransparent(docs_, name) == docs_.end()) {
+      result.insert(name);
+    }
+  }
+  return result;
+}
+
+void DocsMap::RecordName(std::string_view name) const {
+  if (recorded_names_) recorded_names_->emplace_back(name);
+}
+
+void DocsMap::RecordAllNames() const {
+  if (recorded_names_) recorded_all_names_ = true;
+}
+
 namespace impl {
 
 [[noreturn]] void ThrowNoValueException(std::string_view dict_name,
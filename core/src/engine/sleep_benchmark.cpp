@@ -1,6 +1,9 @@
 #include <benchmark/benchmark.h>
 
 #include <engine/ev/thread_control.hpp>
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
@@ -45,15 +48,36 @@ BENCHMARK(run_in_ev_loop_benchmark);
 }
 BENCHMARK(successful_wait_for_benchmark);
 
+namespace {
+
+enum class TaskDeadline { kNone, kEvTimer, kTimerWheel };
+
+void RunWithTaskDeadlines(TaskDeadline task_deadline,
+                          utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = 1;
+  config.thread_name = "bench-worker";
+  config.coarse_cancellation_timers =
+      task_deadline == TaskDeadline::kTimerWheel;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+}  // namespace
+
 void unreached_task_deadline_benchmark(benchmark::State& state,
-                                       bool has_task_deadline) {
-  engine::RunStandalone([&] {
+                                       TaskDeadline task_deadline_type) {
+  RunWithTaskDeadlines(task_deadline_type, [&] {
     for ([[maybe_unused]] auto _ : state) {
       const auto sleep_deadline = engine::Deadline::FromDuration(20s);
       const auto task_deadline_raw = engine::Deadline::FromDuration(40s);
       benchmark::DoNotOptimize(task_deadline_raw);
-      const auto task_deadline =
-          has_task_deadline ? task_deadline_raw : engine::Deadline{};
+      const auto task_deadline = task_deadline_type != TaskDeadline::kNone
+                                     ? task_deadline_raw
+                                     : engine::Deadline{};
 
       auto task = engine::AsyncNoSpan(task_deadline, [&] {
         engine::InterruptibleSleepUntil(sleep_deadline);
@@ -63,8 +87,32 @@ void unreached_task_deadline_benchmark(benchmark::State& state,
     }
   });
 }
-BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline, false);
+BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, no_task_deadline,
+                  TaskDeadline::kNone);
 BENCHMARK_CAPTURE(unreached_task_deadline_benchmark, unreached_task_deadline,
-                  true);
+                  TaskDeadline::kEvTimer);
+BENCHMARK_CAPTURE(unreached_task_deadline_benchmark,
+                  unreached_task_deadline_timer_wheel,
+                  TaskDeadline::kTimerWheel);
+
+// Request-like tasks: a cancellation deadline that is never reached and
+// no sleeps, so only the cost of arming and disarming the timer is measured.
+void short_task_with_deadline_benchmark(benchmark::State& state,
+                                        TaskDeadline task_deadline_type) {
+  RunWithTaskDeadlines(task_deadline_type, [&] {
+    for ([[maybe_unused]] auto _ : state) {
+      const auto task_deadline = task_deadline_type != TaskDeadline::kNone
+                                     ? engine::Deadline::FromDuration(10s)
+                                     : engine::Deadline{};
+      engine::AsyncNoSpan(task_deadline, [] {}).Wait();
+    }
+  });
+}
+BENCHMARK_CAPTURE(short_task_with_deadline_benchmark, no_task_deadline,
+                  TaskDeadline::kNone);
+BENCHMARK_CAPTURE(short_task_with_deadline_benchmark, ev_timer,
+                  TaskDeadline::kEvTimer);
+BENCHMARK_CAPTURE(short_task_with_deadline_benchmark, timer_wheel,
+                  TaskDeadline::kTimerWheel);
 
 USERVER_NAMESPACE_END
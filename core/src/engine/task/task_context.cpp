@@ -257,6 +257,9 @@ void TaskContext::DoStep() {
       }
       SetState(new_state);
       deadline_timer_.Finalize();
+      if (auto* wheel = task_processor_.GetCancellationTimerWheel()) {
+        wheel->Cancel(cancel_timer_);
+      }
       finish_waiters_->WakeupAll();
       TraceStateTransition(new_state);
     } break;
@@ -351,7 +354,10 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy) {
   UASSERT(context == this);
   UASSERT(state_ == Task::State::kRunning);
 
-  if (has_deadline) ArmCancellationTimer();
+  // the wheel timer is not replaced by the deadline timer
+  if (has_deadline && !task_processor_.GetCancellationTimerWheel()) {
+    ArmCancellationTimer();
+  }
   wait_strategy.DisableWakeups();
 
   const auto old_sleep_state = sleep_state_.Exchange<std::memory_order_acq_rel>(
@@ -374,7 +380,14 @@ void TaskContext::ArmDeadlineTimer(Deadline deadline,
 }
 
 void TaskContext::ArmCancellationTimer() {
+  auto* wheel = task_processor_.GetCancellationTimerWheel();
   if (!cancel_deadline_.IsReachable()) {
+    if (wheel) wheel->Cancel(cancel_timer_);
+    return;
+  }
+
+  if (wheel) {
+    wheel->Schedule(cancel_timer_, cancel_deadline_);
     return;
   }
 
@@ -16,6 +16,7 @@
 #include <engine/task/cxxabi_eh_globals.hpp>
 #include <engine/task/sleep_state.hpp>
 #include <engine/task/task_counter.hpp>
+#include <engine/task/timer_wheel.hpp>
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/impl/context_accessor.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
@@ -228,6 +229,7 @@ class TaskContext final : public ContextAccessor {
   mutable FastPimplGenericWaitList finish_waiters_;
 
   ContextTimer deadline_timer_;
+  TimerWheel::Timer cancel_timer_{*this};
   engine::Deadline cancel_deadline_;
 
   // {} if not defined
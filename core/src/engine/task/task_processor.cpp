@@ -17,6 +17,7 @@
 #include <engine/task/counted_coroutine_ptr.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
+#include <engine/task/timer_wheel.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -72,6 +73,10 @@ TaskProcessor::TaskProcessor(TaskProcessorConfig config,
       config_(std::move(config)),
       pools_(std::move(pools)) {
   utils::impl::FinishStaticRegistration();
+  if (config_.coarse_cancellation_timers) {
+    cancellation_timer_wheel_ = std::make_unique<impl::TimerWheel>(
+        pools_->EventThreadPool().NextTimerThread());
+  }
   try {
     LOG_INFO() << "creating task_processor " << Name() << " "
                << "worker_threads=" << config_.worker_threads
@@ -228,6 +233,10 @@ void RegisterThreadStartedHook(std::function<void()> func) {
   ThreadStartedHooks().push_back(std::move(func));
 }
 
+std::size_t GetWorkerCount(const TaskProcessor& task_processor) noexcept {
+  return task_processor.GetWorkerCount();
+}
+
 void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
   switch (config_.os_scheduling) {
     case OsScheduling::kNormal:
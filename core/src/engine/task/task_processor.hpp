@@ -26,6 +26,7 @@ namespace impl {
 class TaskContext;
 class TaskProcessorPools;
 class CountedCoroutinePtr;
+class TimerWheel;
 }  // namespace impl
 
 namespace ev {
@@ -47,6 +48,12 @@ class TaskProcessor final {
 
   ev::ThreadPool& EventThreadPool();
 
+  /// Returns the wheel for task cancellation deadlines or nullptr if
+  /// the precise ev timers are used for them.
+  impl::TimerWheel* GetCancellationTimerWheel() noexcept {
+    return cancellation_timer_wheel_.get();
+  }
+
   std::shared_ptr<impl::TaskProcessorPools> GetTaskProcessorPools() {
     return pools_;
   }
@@ -99,6 +106,7 @@ class TaskProcessor final {
 
   const TaskProcessorConfig config_;
   const std::shared_ptr<impl::TaskProcessorPools> pools_;
+  std::unique_ptr<impl::TimerWheel> cancellation_timer_wheel_;
   std::vector<std::thread> workers_;
   logging::LoggerPtr task_trace_logger_{nullptr};
 
@@ -56,6 +56,9 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value,
       value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
   config.spinning_iterations =
       value["spinning-iterations"].As<int>(config.spinning_iterations);
+  config.coarse_cancellation_timers =
+      value["coarse-cancellation-timers"].As<bool>(
+          config.coarse_cancellation_timers);
 
   const auto task_trace = value["task-trace"];
   if (!task_trace.IsMissing()) {
@@ -0,0 +1,193 @@
+#include <engine/task/timer_wheel.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <boost/intrusive/list.hpp>
+
+#include <engine/ev/thread_control.hpp>
+#include <engine/task/task_context.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+using CoarseClock = utils::datetime::SteadyCoarseClock;
+
+constexpr bool kAdopt = false;
+
+std::int64_t GetCurrentTick() noexcept {
+  return CoarseClock::now().time_since_epoch() / TimerWheel::kTick;
+}
+
+std::int64_t GetExpirationTick(Deadline deadline) noexcept {
+  const auto time_point =
+      Deadline::Clock::now().time_since_epoch() + deadline.TimeLeft();
+  const auto ticks = time_point / TimerWheel::kTick;
+  return time_point % TimerWheel::kTick == Deadline::Duration::zero()
+             ? ticks
+             : ticks + 1;
+}
+
+double GetTickerInterval() noexcept {
+  using LibEvDuration = std::chrono::duration<double>;
+  const auto interval = std::max<CoarseClock::duration>(
+      TimerWheel::kTick, CoarseClock::resolution());
+  return std::chrono::duration_cast<LibEvDuration>(interval).count();
+}
+
+}  // namespace
+
+struct TimerWheel::Slot final {
+  using List = boost::intrusive::list<
+      Timer,
+      boost::intrusive::member_hook<Timer, Timer::Hook, &Timer::hook_>,
+      boost::intrusive::constant_time_size<false>>;
+
+  std::mutex mutex;
+  List timers;
+  // timers of the slot that expire not later than this tick have fired
+  std::int64_t processed_tick{std::numeric_limits<std::int64_t>::min()};
+};
+
+TimerWheel::Timer::~Timer() {
+  UASSERT_MSG(slot_.load(std::memory_order_relaxed) == kNoSlot,
+              "Destroying a scheduled timer");
+}
+
+TimerWheel::TimerWheel(ev::TimerThreadControl& thread_control)
+    : thread_control_(thread_control), slots_(new Slot[kSlots]) {
+  const auto interval = GetTickerInterval();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  ev_timer_init(&ticker_, OnTick, interval, interval);
+  ticker_.data = this;
+}
+
+TimerWheel::~TimerWheel() {
+  UASSERT_MSG(size_.load() == 0, "Destroying a timer wheel with timers");
+  thread_control_.RunInEvLoopBlocking(
+      [this] { thread_control_.Stop(ticker_); });
+}
+
+void TimerWheel::Schedule(Timer& timer, Deadline deadline) {
+  UASSERT(deadline.IsReachable());
+  Cancel(timer);
+
+  bool is_scheduled = false;
+  if (!deadline.IsReached()) {
+    const auto expiration_tick = GetExpirationTick(deadline);
+    const auto slot_index = static_cast<std::size_t>(expiration_tick) % kSlots;
+    auto& slot = slots_[slot_index];
+
+    const std::lock_guard lock(slot.mutex);
+    if (expiration_tick > slot.processed_tick) {
+      timer.expiration_tick_ = expiration_tick;
+      timer.slot_.store(slot_index, std::memory_order_relaxed);
+      slot.timers.push_back(timer);
+      boost::intrusive_ptr<TaskContext>{&timer.context_}.detach();
+      ++size_;
+      is_scheduled = true;
+    }
+  }
+
+  if (!is_scheduled) {
+    timer.context_.RequestCancel(TaskCancellationReason::kDeadline);
+    return;
+  }
+
+  if (!ticker_armed_.load(std::memory_order_relaxed) &&
+      !ticker_armed_.exchange(true)) {
+    thread_control_.RunInEvLoopAsync([this] { StartTicker(); });
+  }
+}
+
+void TimerWheel::Cancel(Timer& timer) noexcept {
+  const auto slot_index = timer.slot_.load(std::memory_order_relaxed);
+  if (slot_index == Timer::kNoSlot) return;
+
+  auto& slot = slots_[slot_index];
+  {
+    const std::lock_guard lock(slot.mutex);
+    // could have fired concurrently
+    if (timer.slot_.load(std::memory_order_relaxed) != slot_index) return;
+    Unlink(slot, timer);
+  }
+  // may not be the last reference, the owner of the timer is alive
+  boost::intrusive_ptr<TaskContext>{&timer.context_, kAdopt}.reset();
+}
+
+void TimerWheel::OnTick(struct ev_loop*, ev_timer* w, int) noexcept {
+  UASSERT(!engine::current_task::IsTaskProcessorThread());
+
+  auto* wheel = static_cast<TimerWheel*>(w->data);
+  UASSERT(wheel != nullptr);
+  try {
+    wheel->Tick();
+  } catch (const std::exception& ex) {
+    LOG_ERROR() << "exception in TimerWheel::Tick(): " << ex;
+  }
+}
+
+void TimerWheel::StartTicker() {
+  UASSERT(!engine::current_task::IsTaskProcessorThread());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+  if (ev_is_active(&ticker_)) return;
+  thread_control_.Start(ticker_);
+}
+
+void TimerWheel::Tick() {
+  const auto now_tick = GetCurrentTick();
+  // a full turn of the wheel visits every slot
+  const auto first_tick = std::max(
+      last_tick_ + 1, now_tick - static_cast<std::int64_t>(kSlots) + 1);
+  for (auto tick = first_tick; tick <= now_tick; ++tick) {
+    ProcessSlot(slots_[static_cast<std::size_t>(tick) % kSlots], now_tick);
+  }
+  last_tick_ = std::max(last_tick_, now_tick);
+
+  if (size_.load() != 0) return;
+
+  // Schedule() re-arms the ticker if it observes ticker_armed_ == false
+  ticker_armed_.store(false);
+  if (size_.load() == 0 || ticker_armed_.exchange(true)) {
+    thread_control_.Stop(ticker_);
+  }
+}
+
+void TimerWheel::ProcessSlot(Slot& slot, std::int64_t now_tick) {
+  {
+    const std::lock_guard lock(slot.mutex);
+    slot.processed_tick = now_tick;
+    for (auto it = slot.timers.begin(); it != slot.timers.end();) {
+      auto& timer = *it++;
+      if (timer.expiration_tick_ > now_tick) continue;
+
+      Unlink(slot, timer);
+      fired_.emplace_back(&timer.context_, kAdopt);
+    }
+  }
+
+  // may destroy the contexts
+  const utils::FastScopeGuard clear_guard{[this]() noexcept {
+    fired_.clear();
+  }};
+  for (const auto& context : fired_) {
+    context->RequestCancel(TaskCancellationReason::kDeadline);
+  }
+}
+
+void TimerWheel::Unlink(Slot& slot, Timer& timer) noexcept {
+  slot.timers.erase(Slot::List::s_iterator_to(timer));
+  timer.slot_.store(Timer::kNoSlot, std::memory_order_relaxed);
+  --size_;
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <ev.h>
+#include <boost/intrusive/list_hook.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+class TimerThreadControl;
+}  // namespace engine::ev
+
+namespace engine::impl {
+
+class TaskContext;
+
+// Hashed timer wheel for task cancellation deadlines.
+//
+// Most of the cancellation deadlines never fire, so unlike ContextTimer the
+// wheel does not post anything to an ev thread on Schedule() and Cancel():
+// timers are linked into a wheel slot under the slot mutex right in the
+// calling thread. A single ev_timer advances the wheel every kTick while
+// there are scheduled timers, using utils::datetime::SteadyCoarseClock.
+// Timers fire up to kTick plus the coarse clock resolution late.
+class TimerWheel final {
+ public:
+  static constexpr std::chrono::milliseconds kTick{1};
+  static constexpr std::size_t kSlots = 1024;
+
+  // A timer bound to a specific TaskContext, keeps the context alive while
+  // scheduled. Schedule() and Cancel() of a single timer must not be called
+  // concurrently.
+  class Timer final {
+   public:
+    explicit Timer(TaskContext& context) noexcept : context_(context) {}
+
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+    ~Timer();
+
+   private:
+    friend class TimerWheel;
+
+    static constexpr std::size_t kNoSlot =
+        std::numeric_limits<std::size_t>::max();
+
+    using Hook = boost::intrusive::list_member_hook<
+        boost::intrusive::link_mode<boost::intrusive::normal_link>>;
+
+    TaskContext& context_;
+    Hook hook_;
+    std::int64_t expiration_tick_{0};
+    std::atomic<std::size_t> slot_{kNoSlot};
+  };
+
+  explicit TimerWheel(ev::TimerThreadControl& thread_control);
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+  ~TimerWheel();
+
+  /// Schedules the cancellation of the timer context at the reachable
+  /// `deadline`, reschedules an already scheduled timer. Cancels the context
+  /// in place if the deadline is already reached.
+  void Schedule(Timer& timer, Deadline deadline);
+
+  /// Removes the timer from the wheel. Does nothing if the timer is not
+  /// scheduled or has already fired.
+  void Cancel(Timer& timer) noexcept;
+
+ private:
+  struct Slot;
+
+  static void OnTick(struct ev_loop*, ev_timer* w, int) noexcept;
+
+  void StartTicker();
+  void Tick();
+  void ProcessSlot(Slot& slot, std::int64_t now_tick);
+  void Unlink(Slot& slot, Timer& timer) noexcept;
+
+  ev::TimerThreadControl& thread_control_;
+  const std::unique_ptr<Slot[]> slots_;
+
+  std::atomic<std::size_t> size_{0};
+  std::atomic<bool> ticker_armed_{false};
+
+  // accessed only from the ev thread
+  ev_timer ticker_{};
+  std::int64_t last_tick_{0};
+  std::vector<boost::intrusive_ptr<TaskContext>> fired_;
+};
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,105 @@
+#include <engine/task/timer_wheel.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <engine/impl/standalone.hpp>
+#include <engine/task/task_processor.hpp>
+#include <engine/task/task_processor_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+void RunWithTimerWheel(std::size_t worker_threads,
+                       utils::function_ref<void()> payload) {
+  engine::TaskProcessorConfig config;
+  config.worker_threads = worker_threads;
+  config.thread_name = "wheel-worker";
+  config.coarse_cancellation_timers = true;
+
+  engine::impl::TaskProcessorHolder task_processor{
+      std::make_unique<engine::TaskProcessor>(
+          std::move(config), engine::impl::MakeTaskProcessorPools({}))};
+  ASSERT_TRUE(task_processor->GetCancellationTimerWheel());
+  engine::impl::RunOnTaskProcessorSync(*task_processor, payload);
+}
+
+}  // namespace
+
+TEST(TimerWheel, CancelsByDeadline) {
+  RunWithTimerWheel(1, [] {
+    const auto deadline = engine::Deadline::FromDuration(20ms);
+    auto task = engine::AsyncNoSpan(deadline, [deadline] {
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+      EXPECT_TRUE(deadline.IsReached());
+    });
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    ASSERT_TRUE(task.IsFinished());
+    EXPECT_EQ(task.CancellationReason(),
+              engine::TaskCancellationReason::kDeadline);
+  });
+}
+
+TEST(TimerWheel, SetDeadline) {
+  RunWithTimerWheel(1, [] {
+    auto task = engine::AsyncNoSpan(engine::Deadline::FromDuration(1h), [] {
+      engine::current_task::SetDeadline(engine::Deadline::FromDuration(10ms));
+      engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+    });
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_EQ(task.CancellationReason(),
+              engine::TaskCancellationReason::kDeadline);
+  });
+}
+
+TEST(TimerWheel, SleepStaysPrecise) {
+  RunWithTimerWheel(1, [] {
+    auto task = engine::AsyncNoSpan(engine::Deadline::FromDuration(1h), [] {
+      engine::SleepFor(5ms);
+      engine::SleepFor(5ms);
+    });
+
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_EQ(task.GetState(), engine::Task::State::kCompleted);
+  });
+}
+
+TEST(TimerWheel, ManyTimers) {
+  constexpr std::size_t kTasks = 1000;
+
+  RunWithTimerWheel(4, [] {
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasks);
+    for (std::size_t i = 0; i < kTasks; ++i) {
+      // half of the deadlines are never reached
+      const auto duration = i % 2 ? std::chrono::milliseconds{i % 50} : 1h;
+      const auto deadline = engine::Deadline::FromDuration(duration);
+      tasks.push_back(engine::AsyncNoSpan(deadline, [deadline, i] {
+        if (i % 2) {
+          engine::InterruptibleSleepFor(utest::kMaxTestWaitTime);
+          // never fires early
+          EXPECT_TRUE(deadline.IsReached());
+        }
+      }));
+    }
+
+    for (std::size_t i = 0; i < kTasks; ++i) {
+      tasks[i].WaitFor(utest::kMaxTestWaitTime);
+      ASSERT_TRUE(tasks[i].IsFinished());
+      EXPECT_EQ(tasks[i].CancellationReason(),
+                i % 2 ? engine::TaskCancellationReason::kDeadline
+                      : engine::TaskCancellationReason::kNone);
+    }
+  });
+}
+
+USERVER_NAMESPACE_END
@@ -3,6 +3,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/fs/read.hpp>
 #include <userver/rcu/rcu_map.hpp>
@@ -115,6 +116,7 @@ void FsCacheClient::HandleCreate(const std::string& path) {
   FileInfoWithData info{};
   info.extension = boost::filesystem::path(path).extension().string();
   info.data = ReadFileContents(tp_, path);
+  info.hash = crypto::hash::Sha1(info.data);
   data_.InsertOrAssign(
       GetLexicallyRelative(path, dir_),
       std::make_shared<const FileInfoWithData>(std::move(info)));
@@ -1,5 +1,6 @@
 #include <userver/fs/read.hpp>
 
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
@@ -51,6 +52,7 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
     FileInfoWithData info{};
     info.extension = it->path().extension().string();
     info.data = ReadFileContents(async_tp, it->path().string());
+    info.hash = crypto::hash::Sha1(info.data);
     data[GetLexicallyRelative(it->path().string(), path)] =
         std::make_shared<const FileInfoWithData>(std::move(info));
   }
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <userver/engine/task/task_base.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
 #include <userver/fs/read.hpp>
+#include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -9,4 +13,18 @@ TEST(Fs, GetLexicallyRelative) {
   EXPECT_EQ(fs::GetLexicallyRelative("/path/to/file", "/path"), "/to/file");
 }
 
+UTEST(Fs, ReadRecursiveFilesInfoWithDataHash) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  fs::blocking::RewriteFileContents(dir.GetPath() + "/file.txt", "hello");
+
+  const auto files = fs::ReadRecursiveFilesInfoWithData(
+      engine::current_task::GetTaskProcessor(), dir.GetPath());
+  ASSERT_EQ(files.size(), 1);
+  const auto& info = *files.at("/file.txt");
+  EXPECT_EQ(info.data, "hello");
+  EXPECT_EQ(info.extension, ".txt");
+  // SHA-1, does not depend on the build
+  EXPECT_EQ(info.hash, "aaf4c61ddcc5e8a2dabede0f3b482cd9aea9434d");
+}
+
 USERVER_NAMESPACE_END
@@ -183,6 +183,10 @@ properties:
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            reuseport-cpu-steering:
+                type: boolean
+                description: pass a new connection to the shard #(CPU % shards), where CPU is the one that received the connection; TCP on Linux only
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -1,9 +1,16 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <charconv>
+#include <optional>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +40,102 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>>
 )"},
     };
 
+struct Precompressed {
+  std::string_view encoding;
+  std::string_view suffix;
+};
+
+// in order of preference
+constexpr Precompressed kPrecompressed[] = {
+    {"br", ".br"},
+    {"gzip", ".gz"},
+};
+
+struct ByteRange {
+  std::size_t begin;
+  std::size_t end;  // exclusive
+};
+
+std::string_view TrimSpaces(std::string_view str) {
+  while (!str.empty() && utils::text::IsAsciiSpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && utils::text::IsAsciiSpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+std::optional<std::size_t> ParseSize(std::string_view str) {
+  std::size_t result = 0;
+  const auto* const end = str.data() + str.size();
+  const auto [ptr, ec] = std::from_chars(str.data(), end, result);
+  if (str.empty() || ec != std::errc{} || ptr != end) return std::nullopt;
+  return result;
+}
+
+bool IsEncodingAccepted(std::string_view accept_encoding,
+                        std::string_view encoding) {
+  for (const auto item :
+       utils::text::SplitIntoStringViewVector(accept_encoding, ",")) {
+    const auto params_pos = item.find(';');
+    if (TrimSpaces(item.substr(0, params_pos)) != encoding) continue;
+    if (params_pos == std::string_view::npos) return true;
+
+    // "q=0", "q=0.0", ... disable the encoding
+    const auto params = TrimSpaces(item.substr(params_pos + 1));
+    return !utils::text::StartsWith(params, "q=0") ||
+           params.find_first_not_of("0.", 2) != std::string_view::npos;
+  }
+  return false;
+}
+
+bool IsETagMatched(std::string_view if_none_match, std::string_view etag) {
+  for (auto item :
+       utils::text::SplitIntoStringViewVector(if_none_match, ",")) {
+    item = TrimSpaces(item);
+    if (item == "*") return true;
+    // weak comparison, see RFC 9110 13.1.2
+    if (utils::text::StartsWith(item, "W/")) item.remove_prefix(2);
+    if (item == etag) return true;
+  }
+  return false;
+}
+
+/// Returns std::nullopt for ranges that should be ignored: anything except
+/// a single "bytes" range. Returns an empty range if it is not satisfiable.
+std::optional<ByteRange> ParseRange(std::string_view header,
+                                    std::size_t size) {
+  constexpr std::string_view kBytesUnit = "bytes=";
+  if (!utils::text::StartsWith(header, kBytesUnit)) return std::nullopt;
+  header = TrimSpaces(header.substr(kBytesUnit.size()));
+  if (header.find(',') != std::string_view::npos) return std::nullopt;
+
+  const auto dash_pos = header.find('-');
+  if (dash_pos == std::string_view::npos) return std::nullopt;
+  const auto first = TrimSpaces(header.substr(0, dash_pos));
+  const auto last = TrimSpaces(header.substr(dash_pos + 1));
+
+  if (first.empty()) {
+    // suffix range: the last N bytes
+    const auto suffix_length = ParseSize(last);
+    if (!suffix_length) return std::nullopt;
+    if (*suffix_length == 0 || size == 0) return ByteRange{0, 0};
+    return ByteRange{size - std::min(*suffix_length, size), size};
+  }
+
+  const auto begin = ParseSize(first);
+  if (!begin) return std::nullopt;
+  auto end = size;
+  if (!last.empty()) {
+    const auto last_pos = ParseSize(last);
+    if (!last_pos || *last_pos < *begin) return std::nullopt;
+    end = std::min(*last_pos + 1, size);
+  }
+  if (*begin >= size) return ByteRange{0, 0};
+  return ByteRange{*begin, end};
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -44,20 +147,79 @@ HttpHandlerStatic::HttpHandlerStatic(
                    .FindComponent<components::FsCache>(
                        config["fs-cache-component"].As<std::string>(
                            "fs-cache-component"))
-                   .GetClient()) {}
+                   .GetClient()),
+      serve_precompressed_(config["serve-precompressed"].As<bool>(false)) {}
 
 std::string HttpHandlerStatic::HandleRequestThrow(
     const http::HttpRequest& request, request::RequestContext&) const {
   LOG_DEBUG() << "Handler: " << request.GetRequestPath();
-  const auto file = storage_.TryGetFile(request.GetRequestPath());
-  if (file) {
-    const auto config = config_.GetSnapshot();
-    request.GetHttpResponse().SetContentType(
-        config[kContentTypeMap][file->extension]);
-    return file->data;
+  const auto& path = request.GetRequestPath();
+  const auto file = storage_.TryGetFile(path);
+  if (!file) {
+    request.GetResponse().SetStatusNotFound();
+    return "File not found";
+  }
+
+  auto& response = request.GetHttpResponse();
+  const auto config = config_.GetSnapshot();
+  response.SetContentType(config[kContentTypeMap][file->extension]);
+
+  auto representation = file;
+  if (serve_precompressed_) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kVary,
+                       std::string{"Accept-Encoding"});
+    const auto& accept_encoding =
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kAcceptEncoding);
+    for (const auto& variant : kPrecompressed) {
+      if (!IsEncodingAccepted(accept_encoding, variant.encoding)) continue;
+      auto compressed =
+          storage_.TryGetFile(path + std::string{variant.suffix});
+      if (!compressed) continue;
+
+      response.SetContentEncoding(std::string{variant.encoding});
+      representation = std::move(compressed);
+      break;
+    }
+  }
+
+  const auto& data = representation->data;
+  auto etag = fmt::format(FMT_STRING("\"{:x}-{}\""), data.size(),
+                          representation->hash);
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptRanges,
+                     std::string{"bytes"});
+
+  const auto& if_none_match =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+  if (!if_none_match.empty() && IsETagMatched(if_none_match, etag)) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag,
+                       std::move(etag));
+    response.SetStatus(http::HttpStatus::kNotModified);
+    return {};
   }
-  request.GetResponse().SetStatusNotFound();
-  return "File not found";
+
+  const auto& range_header =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kRange);
+  const auto& if_range =
+      request.GetHeader(USERVER_NAMESPACE::http::headers::kIfRange);
+  const auto range =
+      range_header.empty() || (!if_range.empty() && if_range != etag)
+          ? std::nullopt
+          : ParseRange(range_header, data.size());
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, std::move(etag));
+  if (!range) return data;
+
+  if (range->begin == range->end) {
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                       fmt::format(FMT_STRING("bytes */{}"), data.size()));
+    response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+    return {};
+  }
+
+  response.SetHeader(USERVER_NAMESPACE::http::headers::kContentRange,
+                     fmt::format(FMT_STRING("bytes {}-{}/{}"), range->begin,
+                                 range->end - 1, data.size()));
+  response.SetStatus(http::HttpStatus::kPartialContent);
+  return data.substr(range->begin, range->end - range->begin);
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -72,6 +234,12 @@ properties:
         type: string
         description: Name of the FsCache component
         defaultDescription: fs-cache-component
+    serve-precompressed:
+        type: boolean
+        description: |
+            serve 'file.br' or 'file.gz' from the cache instead of 'file'
+            if the client accepts the encoding
+        defaultDescription: false
 )");
 }
 
@@ -7,6 +7,11 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -22,6 +27,9 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/fs/blocking/write.hpp>
+#include <userver/logging/log.hpp>
+
+#include <utils/check_syscall.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -63,13 +71,62 @@ engine::io::Socket CreateIpv6Socket(uint16_t port, int backlog) {
   return socket;
 }
 
+void AttachCpuSteering(engine::io::Socket& socket, std::size_t shards) {
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+  // A = current CPU; A %= shards; return A
+  std::array<sock_filter, 3> code{{
+      {BPF_LD | BPF_W | BPF_ABS, 0, 0,
+       static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+      {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(shards)},
+      {BPF_RET | BPF_A, 0, 0, 0},
+  }};
+  const sock_fprog program{static_cast<unsigned short>(code.size()),
+                           code.data()};
+
+  utils::CheckSyscallCustomException<engine::io::IoSystemError>(
+      ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+                   &program, sizeof(program)),
+      "attaching reuseport CPU steering program, fd={}", socket.Fd());
+#else
+  (void)socket;
+  (void)shards;
+  LOG_WARNING() << "SO_ATTACH_REUSEPORT_CBPF is not supported on this "
+                   "platform, connections are distributed by the kernel hash";
+#endif
+}
+
 }  // namespace
 
-engine::io::Socket CreateSocket(const ListenerConfig& config) {
-  if (config.unix_socket_path.empty())
-    return CreateIpv6Socket(config.port, config.backlog);
-  else
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t shards) {
+  if (!config.unix_socket_path.empty()) {
     return CreateUnixSocket(config.unix_socket_path, config.backlog);
+  }
+
+  auto socket = CreateIpv6Socket(config.port, config.backlog);
+  if (config.reuseport_cpu_steering && shards > 1) {
+    AttachCpuSteering(socket, shards);
+  }
+  return socket;
+}
+
+std::vector<engine::io::Socket> CreateShardedSockets(ListenerConfig config) {
+  const auto shards = config.shards.value_or(1);
+  if (shards > 1 && !config.unix_socket_path.empty()) {
+    throw std::runtime_error(fmt::format(
+        "Only a single shard is supported for the unix socket '{}', got {}",
+        config.unix_socket_path, shards));
+  }
+
+  std::vector<engine::io::Socket> sockets;
+  sockets.reserve(shards);
+  for (std::size_t i = 0; i < shards; ++i) {
+    sockets.push_back(CreateSocket(config, shards));
+    if (config.port == 0 && config.unix_socket_path.empty()) {
+      config.port = sockets.back().Getsockname().Port();
+    }
+  }
+  return sockets;
 }
 
 }  // namespace server::net
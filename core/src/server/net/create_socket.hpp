@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <server/net/listener_config.hpp>
 #include <userver/engine/io/socket.hpp>
 
@@ -7,7 +10,18 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
-engine::io::Socket CreateSocket(const ListenerConfig& config);
+/// Creates a listening socket. If `config.reuseport_cpu_steering` is set,
+/// attaches a program to the SO_REUSEPORT group of the port that passes a new
+/// connection to the socket #(CPU % shards), sockets are numbered in order of
+/// creation.
+engine::io::Socket CreateSocket(const ListenerConfig& config,
+                                std::size_t shards = 1);
+
+/// Creates `config.shards` listening sockets bound to the same port with
+/// SO_REUSEPORT. If `config.port` is 0, all the sockets get the port picked
+/// for the first one. Throws if several shards are set for a Unix socket, as
+/// every new socket would steal the path of the previous one.
+std::vector<engine::io::Socket> CreateShardedSockets(ListenerConfig config);
 
 }  // namespace server::net
 
@@ -0,0 +1,128 @@
+#include <server/net/create_socket.hpp>
+
+#include <netinet/in.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace net = server::net;
+
+namespace {
+
+constexpr std::size_t kShards = 2;
+
+engine::io::Sockaddr MakeLoopbackAddress(std::uint16_t port) {
+  engine::io::Sockaddr addr;
+  auto* sa = addr.As<struct sockaddr_in6>();
+  sa->sin6_family = AF_INET6;
+  sa->sin6_addr = in6addr_loopback;
+  addr.SetPort(port);
+  return addr;
+}
+
+// Returns the index of the socket that accepted a connection
+std::optional<std::size_t> AcceptAny(std::vector<engine::io::Socket>& sockets) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (!deadline.IsReached()) {
+    for (std::size_t i = 0; i < sockets.size(); ++i) {
+      try {
+        sockets[i].Accept(
+            engine::Deadline::FromDuration(std::chrono::milliseconds{10}));
+        return i;
+      } catch (const engine::io::IoTimeout&) {
+      }
+    }
+  }
+  return std::nullopt;
+}
+
+// The connection is made from a separate thread running on `cpu`, so that the
+// kernel receives it on that CPU
+void ConnectFromCpu(const engine::io::Sockaddr& addr, int cpu) {
+  std::thread([&addr, cpu] {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    ASSERT_EQ(::sched_setaffinity(0, sizeof(cpus), &cpus), 0);
+
+    const int fd = ::socket(AF_INET6, SOCK_STREAM, 0);
+    ASSERT_NE(fd, -1);
+    EXPECT_EQ(::connect(fd, addr.Data(), addr.Size()), 0);
+    // the connection stays in the accept queue after the close
+    ::close(fd);
+  }).join();
+}
+
+}  // namespace
+
+UTEST(ServerNetCreateSocket, ShardedSocketsShareConnections) {
+  net::ListenerConfig config;
+  config.shards = kShards;
+  auto sockets = net::CreateShardedSockets(config);
+  ASSERT_EQ(sockets.size(), kShards);
+  const auto addr = MakeLoopbackAddress(sockets.front().Getsockname().Port());
+
+  // SO_REUSEPORT spreads the connections by the hash of the client address,
+  // 64 connections miss a shard with a negligible probability
+  std::vector<std::size_t> accepted(kShards);
+  std::vector<engine::io::Socket> clients;
+  for (int i = 0; i < 64; ++i) {
+    auto& client =
+        clients.emplace_back(addr.Domain(), engine::io::SocketType::kStream);
+    client.Connect(addr,
+                   engine::Deadline::FromDuration(utest::kMaxTestWaitTime));
+    const auto shard = AcceptAny(sockets);
+    ASSERT_TRUE(shard);
+    ++accepted[*shard];
+  }
+  for (const auto count : accepted) {
+    EXPECT_GT(count, 0);
+  }
+}
+
+UTEST(ServerNetCreateSocket, ReuseportCpuSteering) {
+  if (std::thread::hardware_concurrency() < kShards) {
+    GTEST_SKIP() << "Steering to " << kShards << " shards needs more CPUs";
+  }
+
+  net::ListenerConfig config;
+  config.shards = kShards;
+  config.reuseport_cpu_steering = true;
+  auto sockets = net::CreateShardedSockets(config);
+  const auto addr = MakeLoopbackAddress(sockets.front().Getsockname().Port());
+
+  // every shard gets exactly the connections received on its CPU
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    for (std::size_t cpu = 0; cpu < kShards; ++cpu) {
+      ConnectFromCpu(addr, static_cast<int>(cpu));
+      const auto shard = AcceptAny(sockets);
+      ASSERT_TRUE(shard);
+      EXPECT_EQ(*shard, cpu);
+    }
+  }
+}
+
+UTEST(ServerNetCreateSocket, UnixSocketShards) {
+  const auto dir = fs::blocking::TempDirectory::Create();
+  net::ListenerConfig config;
+  config.unix_socket_path = dir.GetPath() + "/listener.sock";
+
+  config.shards = kShards;
+  UEXPECT_THROW(net::CreateShardedSockets(config), std::runtime_error);
+
+  config.shards = 1;
+  EXPECT_EQ(net::CreateShardedSockets(config).size(), 1);
+}
+
+USERVER_NAMESPACE_END
@@ -18,6 +18,7 @@ struct EndpointInfo {
   const ListenerConfig& listener_config;
   http::HttpRequestHandler& request_handler;
   Connection::Type connection_type{Connection::Type::kRequest};
+  std::size_t listener_shards{1};
 
   std::atomic<size_t> connection_count{0};
 };
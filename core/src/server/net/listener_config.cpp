@@ -22,6 +22,8 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
   config.max_connections =
       value["max_connections"].As<size_t>(config.max_connections);
   config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+  config.reuseport_cpu_steering = value["reuseport-cpu-steering"].As<bool>(
+      config.reuseport_cpu_steering);
   config.task_processor = value["task_processor"].As<std::string>();
   config.backlog = value["backlog"].As<int>(config.backlog);
 
@@ -33,6 +35,10 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value,
     throw std::runtime_error(
         "Either non-zero 'port' or non-empty 'unix-socket' fields must be set");
 
+  if (config.shards && *config.shards == 0) {
+    throw std::runtime_error("Invalid shards value in " + value.GetPath());
+  }
+
   if (config.backlog <= 0) {
     throw std::runtime_error("Invalid backlog value in " + value.GetPath());
   }
@@ -22,6 +22,7 @@ struct ListenerConfig {
   int backlog = 1024;  // truncated to net.core.somaxconn
   size_t max_connections = 32768;
   std::optional<size_t> shards;
+  bool reuseport_cpu_steering{false};
   std::string task_processor;
 
   bool tls{false};
@@ -48,7 +48,8 @@ ListenerImpl::ListenerImpl(engine::TaskProcessor& task_processor,
               }
             }
           },
-          CreateSocket(endpoint_info_->listener_config))) {}
+          CreateSocket(endpoint_info_->listener_config,
+                       endpoint_info_->listener_shards))) {}
 
 ListenerImpl::~ListenerImpl() {
   LOG_TRACE() << "Stopping socket listener task";
@@ -63,6 +63,7 @@ void PortInfo::Init(const ServerConfig& config,
   const auto& event_thread_pool = task_processor.EventThreadPool();
   size_t listener_shards = listener_config.shards ? *listener_config.shards
                                                   : event_thread_pool.GetSize();
+  endpoint_info_->listener_shards = listener_shards;
 
   listeners_.reserve(listener_shards);
   while (listener_shards--) {
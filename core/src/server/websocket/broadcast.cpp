@@ -0,0 +1,217 @@
+#include <userver/server/websocket/broadcast.hpp>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/exception.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/mutex.hpp>
+#include <userver/engine/shared_mutex.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/logging/log.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket {
+
+class BroadcastGroup::Member final {
+ public:
+  Member(WebSocketConnection& connection, const BroadcastGroupConfig& config,
+         Statistics& stats)
+      : connection_(connection), config_(config), stats_(stats) {}
+
+  void Push(const PreparedMessage& message) {
+    {
+      const std::lock_guard lock(mutex_);
+      if (close_requested_ || stopped_) return;
+
+      if (queue_.size() >= config_.max_queue_size) {
+        if (config_.slow_consumer_policy == SlowConsumerPolicy::kDropMessage) {
+          ++stats_.dropped;
+          return;
+        }
+        close_requested_ = true;
+        queue_.clear();
+        ++stats_.closed;
+      } else {
+        queue_.push_back(message);
+        ++stats_.enqueued;
+      }
+    }
+    event_.Send();
+  }
+
+  // Makes Run return after the current write
+  void Stop() {
+    {
+      const std::lock_guard lock(mutex_);
+      stopped_ = true;
+      queue_.clear();
+    }
+    event_.Send();
+  }
+
+  // Returns when the member should leave the group
+  void Run() {
+    RunLoop();
+    const std::lock_guard lock(mutex_);
+    stopped_ = true;
+    queue_.clear();
+  }
+
+ private:
+  void RunLoop() {
+    std::deque<PreparedMessage> batch;
+    while (event_.WaitForEvent()) {
+      bool close_requested = false;
+      {
+        const std::lock_guard lock(mutex_);
+        if (stopped_) return;
+        batch.swap(queue_);
+        close_requested = close_requested_;
+      }
+
+      try {
+        for (const auto& message : batch) {
+          // frames are never interrupted, the member stops between them
+          if (IsStopped()) return;
+          connection_.SendPrepared(message);
+        }
+        batch.clear();
+
+        if (close_requested) {
+          LOG_INFO() << "Closing slow broadcast consumer "
+                     << connection_.RemoteAddr().PrimaryAddressString();
+          connection_.Close(CloseStatus::kPolicyViolation);
+          return;
+        }
+      } catch (const engine::io::IoException& e) {
+        LOG_INFO() << "Stopping broadcast to "
+                   << connection_.RemoteAddr().PrimaryAddressString() << ": "
+                   << e;
+        return;
+      }
+    }
+  }
+
+  bool IsStopped() {
+    const std::lock_guard lock(mutex_);
+    return stopped_;
+  }
+
+  WebSocketConnection& connection_;
+  const BroadcastGroupConfig& config_;
+  Statistics& stats_;
+
+  engine::Mutex mutex_;
+  std::deque<PreparedMessage> queue_;
+  bool close_requested_{false};
+  // the writer has stopped, the messages are neither queued nor counted
+  bool stopped_{false};
+  engine::SingleConsumerEvent event_;
+};
+
+class BroadcastGroup::Impl final {
+ public:
+  explicit Impl(BroadcastGroupConfig config) : config_(config) {}
+
+  std::shared_ptr<Member> Add(WebSocketConnection& connection) {
+    auto member = std::make_shared<Member>(connection, config_, stats_);
+    const std::lock_guard lock(members_mutex_);
+    members_.insert(member);
+    return member;
+  }
+
+  void Remove(const std::shared_ptr<Member>& member) {
+    const std::lock_guard lock(members_mutex_);
+    members_.erase(member);
+  }
+
+  void Broadcast(const PreparedMessage& message) {
+    const std::shared_lock lock(members_mutex_);
+    for (const auto& member : members_) member->Push(message);
+  }
+
+  std::size_t GetSize() const {
+    const std::shared_lock lock(members_mutex_);
+    return members_.size();
+  }
+
+  const Statistics& GetStatistics() const { return stats_; }
+
+ private:
+  const BroadcastGroupConfig config_;
+  Statistics stats_;
+
+  mutable engine::SharedMutex members_mutex_;
+  std::unordered_set<std::shared_ptr<Member>> members_;
+};
+
+BroadcastGroup::BroadcastGroup(BroadcastGroupConfig config)
+    : impl_(std::make_shared<Impl>(config)) {}
+
+BroadcastGroup::~BroadcastGroup() = default;
+
+BroadcastGroup::Membership BroadcastGroup::Join(
+    WebSocketConnection& connection) {
+  return Membership{impl_, impl_->Add(connection)};
+}
+
+void BroadcastGroup::Broadcast(const PreparedMessage& message) {
+  impl_->Broadcast(message);
+}
+
+std::size_t BroadcastGroup::GetSize() const { return impl_->GetSize(); }
+
+const BroadcastGroup::Statistics& BroadcastGroup::GetStatistics() const {
+  return impl_->GetStatistics();
+}
+
+BroadcastGroup::Membership::Membership(std::shared_ptr<Impl> group,
+                                       std::shared_ptr<Member> member)
+    : group_(std::move(group)),
+      member_(std::move(member)),
+      writer_(engine::AsyncNoSpan([group = group_, member = member_] {
+        member->Run();
+        // a closed or failed connection leaves the group right away
+        group->Remove(member);
+      })) {}
+
+BroadcastGroup::Membership::Membership(Membership&&) noexcept = default;
+
+BroadcastGroup::Membership& BroadcastGroup::Membership::operator=(
+    Membership&& other) noexcept {
+  if (this != &other) {
+    Leave();
+    group_ = std::move(other.group_);
+    member_ = std::move(other.member_);
+    writer_ = std::move(other.writer_);
+  }
+  return *this;
+}
+
+BroadcastGroup::Membership::~Membership() { Leave(); }
+
+void BroadcastGroup::Membership::Leave() {
+  if (!member_) return;
+
+  group_->Remove(member_);
+  member_->Stop();
+  if (writer_.IsValid()) {
+    try {
+      writer_.Wait();
+    } catch (const engine::WaitInterruptedException&) {
+      // the leaving task is cancelled, its connection is torn down anyway
+      writer_.SyncCancel();
+    }
+  }
+  member_.reset();
+  group_.reset();
+}
+
+}  // namespace server::websocket
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <vector>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/server/websocket/broadcast.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+class NullSocket final : public engine::io::RwBase {
+ public:
+  explicit NullSocket(std::atomic<std::size_t>& writes) : writes_(writes) {}
+
+  bool IsValid() const override { return true; }
+
+  bool WaitReadable(engine::Deadline) override { return false; }
+
+  size_t ReadSome(void*, size_t, engine::Deadline) override { return 0; }
+
+  size_t ReadAll(void*, size_t, engine::Deadline) override { return 0; }
+
+  bool WaitWriteable(engine::Deadline) override { return true; }
+
+  size_t WriteAll(const void*, size_t len, engine::Deadline) override {
+    writes_.fetch_add(1, std::memory_order_relaxed);
+    return len;
+  }
+
+  size_t WriteAll(std::initializer_list<engine::io::IoData> list,
+                  engine::Deadline) override {
+    std::size_t result = 0;
+    for (const auto& io_data : list) result += io_data.len;
+    writes_.fetch_add(1, std::memory_order_relaxed);
+    return result;
+  }
+
+ private:
+  std::atomic<std::size_t>& writes_;
+};
+
+std::vector<std::shared_ptr<ws::WebSocketConnection>> MakeConnections(
+    std::size_t count, const ws::Config& config,
+    std::atomic<std::size_t>& writes) {
+  std::vector<std::shared_ptr<ws::WebSocketConnection>> connections;
+  connections.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    connections.push_back(ws::MakeWebSocket(
+        std::make_unique<NullSocket>(writes), engine::io::Sockaddr{}, config));
+  }
+  return connections;
+}
+
+const std::string kMessage = [] {
+  std::string message;
+  while (message.size() < 4096) {
+    message += R"({"ticker":"ABC","price":123.45,"volume":1000},)";
+  }
+  return message;
+}();
+
+}  // namespace
+
+void websocket_send_per_connection(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    std::atomic<std::size_t> writes{0};
+    const auto connections = MakeConnections(state.range(0), {}, writes);
+
+    for ([[maybe_unused]] auto _ : state) {
+      for (const auto& connection : connections) connection->SendText(kMessage);
+    }
+    state.SetItemsProcessed(state.iterations() * connections.size());
+  });
+}
+BENCHMARK(websocket_send_per_connection)->Range(1024, 64 * 1024);
+
+void websocket_send_prepared(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    std::atomic<std::size_t> writes{0};
+    const auto connections = MakeConnections(state.range(0), {}, writes);
+
+    for ([[maybe_unused]] auto _ : state) {
+      const ws::PreparedMessage message{kMessage, true, {}};
+      for (const auto& connection : connections) {
+        connection->SendPrepared(message);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * connections.size());
+  });
+}
+BENCHMARK(websocket_send_prepared)->Range(1024, 64 * 1024);
+
+void websocket_broadcast_group(benchmark::State& state) {
+  engine::RunStandalone(4, [&] {
+    std::atomic<std::size_t> writes{0};
+    const auto connections = MakeConnections(state.range(0), {}, writes);
+
+    ws::BroadcastGroup group{{1024, ws::SlowConsumerPolicy::kDropMessage}};
+    std::vector<ws::BroadcastGroup::Membership> memberships;
+    memberships.reserve(connections.size());
+    for (const auto& connection : connections) {
+      memberships.push_back(group.Join(*connection));
+    }
+
+    std::size_t expected_writes = 0;
+    for ([[maybe_unused]] auto _ : state) {
+      group.Broadcast(ws::PreparedMessage{kMessage, true, {}});
+      expected_writes += connections.size();
+      while (writes.load(std::memory_order_relaxed) < expected_writes) {
+        engine::Yield();
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * connections.size());
+  });
+}
+BENCHMARK(websocket_broadcast_group)
+    ->Range(1024, 64 * 1024)
+    ->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,203 @@
+#include <userver/server/websocket/broadcast.hpp>
+
+#include <vector>
+
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/exception.hpp>
+#include <userver/engine/single_consumer_event.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+class FakeConnection final : public ws::WebSocketConnection {
+ public:
+  void Recv(ws::Message&) override {}
+
+  void Send(const ws::Message& message) override {
+    if (fail_sends) {
+      throw engine::io::IoException("connection reset by peer");
+    }
+    if (block_sends) {
+      ASSERT_TRUE(unblock.WaitForEvent());
+    }
+    if (message.close_status) {
+      close_status = message.close_status;
+    } else {
+      received.push_back(message.data);
+    }
+  }
+
+  void SendText(std::string_view message) override {
+    Send({std::string{message}, {}, true});
+  }
+
+  void Close(ws::CloseStatus status_code) override {
+    Send({{}, status_code, false});
+  }
+
+  const engine::io::Sockaddr& RemoteAddr() const override { return addr_; }
+
+  void AddFinalTags(tracing::Span&) const override {}
+
+  void AddStatistics(ws::Statistics&) const override {}
+
+  void WaitForMessages(std::size_t count) const {
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (received.size() < count && !deadline.IsReached()) {
+      engine::Yield();
+    }
+  }
+
+  std::vector<std::string> received;
+  std::optional<ws::CloseStatus> close_status;
+  bool block_sends{false};
+  bool fail_sends{false};
+  engine::SingleConsumerEvent unblock;
+
+ protected:
+  void DoSendBinary(utils::span<const std::byte> message) override {
+    Send({std::string{reinterpret_cast<const char*>(message.data()),
+                      message.size()},
+          {},
+          false});
+  }
+
+ private:
+  engine::io::Sockaddr addr_;
+};
+
+void WaitForGroupSize(const ws::BroadcastGroup& group, std::size_t size) {
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (group.GetSize() != size && !deadline.IsReached()) engine::Yield();
+}
+
+}  // namespace
+
+UTEST(WebsocketBroadcast, Basic) {
+  ws::BroadcastGroup group;
+  FakeConnection first;
+  FakeConnection second;
+
+  {
+    const auto first_membership = group.Join(first);
+    const auto second_membership = group.Join(second);
+    EXPECT_EQ(group.GetSize(), 2);
+
+    group.Broadcast(ws::PreparedMessage{"one", true, {}});
+    group.Broadcast(ws::PreparedMessage{"two", true, {}});
+
+    first.WaitForMessages(2);
+    second.WaitForMessages(2);
+  }
+  EXPECT_EQ(group.GetSize(), 0);
+
+  group.Broadcast(ws::PreparedMessage{"three", true, {}});
+
+  const std::vector<std::string> expected{"one", "two"};
+  EXPECT_EQ(first.received, expected);
+  EXPECT_EQ(second.received, expected);
+  EXPECT_EQ(group.GetStatistics().enqueued, 4);
+  EXPECT_EQ(group.GetStatistics().dropped, 0);
+}
+
+UTEST(WebsocketBroadcast, SlowConsumerDrop) {
+  ws::BroadcastGroup group{{1, ws::SlowConsumerPolicy::kDropMessage}};
+  FakeConnection slow;
+  slow.block_sends = true;
+
+  const auto membership = group.Join(slow);
+  group.Broadcast(ws::PreparedMessage{"one", true, {}});
+  // let the writer take the first message and block on it
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  group.Broadcast(ws::PreparedMessage{"two", true, {}});
+  group.Broadcast(ws::PreparedMessage{"three", true, {}});
+  EXPECT_GE(group.GetStatistics().dropped, 1);
+
+  slow.block_sends = false;
+  slow.unblock.Send();
+  slow.WaitForMessages(2);
+  EXPECT_EQ(slow.received.front(), "one");
+  EXPECT_FALSE(slow.close_status);
+}
+
+UTEST(WebsocketBroadcast, SlowConsumerClose) {
+  ws::BroadcastGroup group{{1, ws::SlowConsumerPolicy::kClose}};
+  FakeConnection slow;
+  slow.block_sends = true;
+
+  auto membership = group.Join(slow);
+  for (int i = 0; i < 3; ++i) {
+    group.Broadcast(ws::PreparedMessage{"message", true, {}});
+  }
+  EXPECT_EQ(group.GetStatistics().closed, 1);
+
+  slow.block_sends = false;
+  slow.unblock.Send();
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (!slow.close_status && !deadline.IsReached()) engine::Yield();
+  EXPECT_EQ(slow.close_status, ws::CloseStatus::kPolicyViolation);
+
+  WaitForGroupSize(group, 0);
+  EXPECT_EQ(group.GetSize(), 0);
+
+  group.Broadcast(ws::PreparedMessage{"after close", true, {}});
+  EXPECT_EQ(group.GetStatistics().closed, 1);
+  EXPECT_EQ(group.GetStatistics().dropped, 0);
+}
+
+UTEST(WebsocketBroadcast, LeaveWaitsForCurrentWrite) {
+  ws::BroadcastGroup group;
+  FakeConnection slow;
+  slow.block_sends = true;
+
+  auto membership = group.Join(slow);
+  group.Broadcast(ws::PreparedMessage{"one", true, {}});
+  group.Broadcast(ws::PreparedMessage{"two", true, {}});
+  // let the writer take the first message and block on it
+  engine::SleepFor(std::chrono::milliseconds{10});
+
+  auto leaving = engine::AsyncNoSpan([&membership] { membership.Leave(); });
+  engine::SleepFor(std::chrono::milliseconds{10});
+  EXPECT_FALSE(leaving.IsFinished());
+
+  slow.unblock.Send();
+  UEXPECT_NO_THROW(leaving.Get());
+  // the started frame is complete, the rest is dropped
+  EXPECT_EQ(slow.received, std::vector<std::string>{"one"});
+  EXPECT_EQ(group.GetSize(), 0);
+}
+
+UTEST(WebsocketBroadcast, DisconnectedPeerLeaves) {
+  ws::BroadcastGroup group{{1, ws::SlowConsumerPolicy::kDropMessage}};
+  FakeConnection alive;
+  FakeConnection disconnected;
+  disconnected.fail_sends = true;
+
+  const auto alive_membership = group.Join(alive);
+  const auto disconnected_membership = group.Join(disconnected);
+  EXPECT_EQ(group.GetSize(), 2);
+
+  group.Broadcast(ws::PreparedMessage{"one", true, {}});
+  WaitForGroupSize(group, 1);
+  EXPECT_EQ(group.GetSize(), 1);
+
+  const auto enqueued = group.GetStatistics().enqueued.Load();
+  for (int i = 0; i < 10; ++i) {
+    alive.WaitForMessages(i + 1);
+    group.Broadcast(ws::PreparedMessage{"more", true, {}});
+  }
+  alive.WaitForMessages(11);
+  EXPECT_EQ(alive.received.size(), 11);
+  EXPECT_EQ(group.GetStatistics().enqueued, enqueued + 10);
+  EXPECT_EQ(group.GetStatistics().dropped, 0);
+  EXPECT_EQ(group.GetStatistics().closed, 0);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,220 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <charconv>
+
+#include <zlib.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+constexpr std::string_view kDeflateTail{"\x00\x00\xff\xff", 4};
+
+// zlib does not support raw deflate with 256-byte window
+constexpr int kMinWindowBits = 9;
+
+constexpr std::size_t kMinChunkSize = 1024;
+
+std::string_view Strip(std::string_view str) {
+  while (!str.empty() && utils::text::IsAsciiSpace(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && utils::text::IsAsciiSpace(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) {
+  if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+    value = value.substr(1, value.size() - 2);
+  }
+
+  int bits = 0;
+  const auto* end = value.data() + value.size();
+  const auto [ptr, ec] = std::from_chars(value.data(), end, bits);
+  if (ec != std::errc{} || ptr != end || value.empty()) return std::nullopt;
+  if (bits < kMinWindowBits || bits > kMaxDeflateWindowBits) {
+    return std::nullopt;
+  }
+  return bits;
+}
+
+std::optional<DeflateParams> ParseOffer(std::string_view offer,
+                                        const DeflateSettings& settings) {
+  const auto parts = utils::text::SplitIntoStringViewVector(offer, ";");
+  if (parts.empty() || Strip(parts.front()) != kExtensionName) return {};
+
+  DeflateParams params;
+  bool server_no_context_takeover = false;
+  bool has_client_max_window_bits = false;
+
+  for (std::size_t i = 1; i < parts.size(); ++i) {
+    const auto param = Strip(parts[i]);
+    const auto eq_pos = param.find('=');
+    const auto name = Strip(param.substr(0, eq_pos));
+    const std::optional<std::string_view> value =
+        eq_pos == std::string_view::npos
+            ? std::nullopt
+            : std::make_optional(Strip(param.substr(eq_pos + 1)));
+
+    // Each parameter is allowed once, unknown parameters decline the offer
+    if (name == "server_no_context_takeover") {
+      if (value || server_no_context_takeover) return {};
+      server_no_context_takeover = true;
+    } else if (name == "client_no_context_takeover") {
+      if (value || params.client_no_context_takeover) return {};
+      params.client_no_context_takeover = true;
+    } else if (name == "server_max_window_bits") {
+      if (!value || params.server_max_window_bits) return {};
+      params.server_max_window_bits = ParseWindowBits(*value);
+      if (!params.server_max_window_bits) return {};
+    } else if (name == "client_max_window_bits") {
+      if (has_client_max_window_bits) return {};
+      has_client_max_window_bits = true;
+      if (value) {
+        params.client_max_window_bits = ParseWindowBits(*value);
+        if (!params.client_max_window_bits) return {};
+      }
+    } else {
+      return {};
+    }
+  }
+
+  params.server_no_context_takeover =
+      server_no_context_takeover || settings.server_no_context_takeover;
+  return params;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(
+    std::string_view extensions_header, const DeflateSettings& settings) {
+  for (const auto offer :
+       utils::text::SplitIntoStringViewVector(extensions_header, ",")) {
+    auto params = ParseOffer(offer, settings);
+    if (params) return params;
+  }
+  return std::nullopt;
+}
+
+std::string FormatDeflateResponse(const DeflateParams& params) {
+  std::string result{kExtensionName};
+  if (params.server_no_context_takeover) {
+    result += "; server_no_context_takeover";
+  }
+  if (params.client_no_context_takeover) {
+    result += "; client_no_context_takeover";
+  }
+  if (params.server_max_window_bits) {
+    result += "; server_max_window_bits=";
+    result += std::to_string(*params.server_max_window_bits);
+  }
+  return result;
+}
+
+struct Deflater::Stream final {
+  z_stream zs{};
+};
+
+Deflater::Deflater(const DeflateParams& params)
+    : stream_(std::make_unique<Stream>()),
+      reset_after_message_(params.server_no_context_takeover) {
+  const auto res = deflateInit2(&stream_->zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                                -params.server_max_window_bits.value_or(
+                                    kMaxDeflateWindowBits),
+                                8,
+                                Z_DEFAULT_STRATEGY);
+  UINVARIANT(res == Z_OK, "deflateInit2 failed");
+}
+
+Deflater::~Deflater() { deflateEnd(&stream_->zs); }
+
+void Deflater::Compress(utils::span<const std::byte> data, std::string& out) {
+  auto& zs = stream_->zs;
+  // zlib API is not const-correct
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  zs.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(data.data()));
+  zs.avail_in = data.size();
+
+  out.clear();
+  auto chunk_size = std::max<std::size_t>(
+      deflateBound(&zs, data.size()) + kDeflateTail.size(), kMinChunkSize);
+  do {
+    const auto offset = out.size();
+    out.resize(offset + chunk_size);
+    zs.next_out = reinterpret_cast<Bytef*>(out.data() + offset);
+    zs.avail_out = chunk_size;
+
+    const auto res = deflate(&zs, Z_SYNC_FLUSH);
+    UINVARIANT(res == Z_OK || res == Z_BUF_ERROR, "deflate failed");
+    out.resize(out.size() - zs.avail_out);
+    chunk_size = std::max(chunk_size, out.size());
+  } while (zs.avail_out == 0);
+
+  UASSERT(std::string_view{out}.substr(out.size() - kDeflateTail.size()) ==
+          kDeflateTail);
+  out.resize(out.size() - kDeflateTail.size());
+
+  if (reset_after_message_) Reset();
+}
+
+void Deflater::Reset() { deflateReset(&stream_->zs); }
+
+struct Inflater::Stream final {
+  z_stream zs{};
+};
+
+Inflater::Inflater() : stream_(std::make_unique<Stream>()) {
+  // client may use any window up to the maximum one
+  const auto res = inflateInit2(&stream_->zs, -kMaxDeflateWindowBits);
+  UINVARIANT(res == Z_OK, "inflateInit2 failed");
+}
+
+Inflater::~Inflater() { inflateEnd(&stream_->zs); }
+
+CloseStatus Inflater::Decompress(std::string& payload, std::size_t max_size) {
+  auto& zs = stream_->zs;
+  payload.append(kDeflateTail);
+  zs.next_in = reinterpret_cast<Bytef*>(payload.data());
+  zs.avail_in = payload.size();
+
+  buffer_.clear();
+  auto chunk_size = std::max(payload.size() * 2, kMinChunkSize);
+  do {
+    const auto offset = buffer_.size();
+    if (offset > max_size) return CloseStatus::kTooBigData;
+    chunk_size = std::min(chunk_size, max_size + 1 - offset);
+    buffer_.resize(offset + chunk_size);
+    zs.next_out = reinterpret_cast<Bytef*>(buffer_.data() + offset);
+    zs.avail_out = chunk_size;
+
+    const auto res = inflate(&zs, Z_SYNC_FLUSH);
+    buffer_.resize(buffer_.size() - zs.avail_out);
+    if (res == Z_STREAM_END) {
+      // peer has finished the deflate stream, the next message starts anew
+      inflateReset(&zs);
+      break;
+    }
+    if (res != Z_OK && res != Z_BUF_ERROR) return CloseStatus::kBadMessageData;
+    if (res == Z_BUF_ERROR && zs.avail_out != 0) break;
+    chunk_size *= 2;
+  } while (zs.avail_in > 0 || zs.avail_out == 0);
+
+  if (buffer_.size() > max_size) return CloseStatus::kTooBigData;
+  payload.swap(buffer_);
+  return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
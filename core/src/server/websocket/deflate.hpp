@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+inline constexpr int kMaxDeflateWindowBits = 15;
+
+/// permessage-deflate extension parameters,
+/// see https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+struct DeflateParams final {
+  bool server_no_context_takeover = false;
+  bool client_no_context_takeover = false;
+  std::optional<int> server_max_window_bits;
+  std::optional<int> client_max_window_bits;
+};
+
+/// Server-side permessage-deflate preferences
+struct DeflateSettings final {
+  bool server_no_context_takeover = false;
+};
+
+/// Picks the first acceptable permessage-deflate offer from the
+/// Sec-WebSocket-Extensions request header value.
+std::optional<DeflateParams> NegotiateDeflate(
+    std::string_view extensions_header, const DeflateSettings& settings);
+
+/// Formats the Sec-WebSocket-Extensions response header value
+std::string FormatDeflateResponse(const DeflateParams& params);
+
+/// Compresses outgoing messages, keeping the LZ77 window between messages
+/// unless server_no_context_takeover is negotiated.
+class Deflater final {
+ public:
+  explicit Deflater(const DeflateParams& params);
+  ~Deflater();
+
+  Deflater(const Deflater&) = delete;
+  Deflater& operator=(const Deflater&) = delete;
+
+  /// Replaces `out` contents with the compressed message payload
+  /// (without the trailing 0x00 0x00 0xff 0xff).
+  void Compress(utils::span<const std::byte> data, std::string& out);
+
+  /// Drops the compression context, the next message is compressed
+  /// without references to the previous ones.
+  void Reset();
+
+ private:
+  struct Stream;
+  std::unique_ptr<Stream> stream_;
+  const bool reset_after_message_;
+};
+
+/// Decompresses incoming messages, keeping the LZ77 window between messages
+class Inflater final {
+ public:
+  Inflater();
+  ~Inflater();
+
+  Inflater(const Inflater&) = delete;
+  Inflater& operator=(const Inflater&) = delete;
+
+  /// Decompresses `payload` in place.
+  /// @returns close status for malformed data or data exceeding `max_size`,
+  /// CloseStatus::kNone otherwise.
+  CloseStatus Decompress(std::string& payload, std::size_t max_size);
+
+ private:
+  struct Stream;
+  std::unique_ptr<Stream> stream_;
+  std::string buffer_;
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,103 @@
+#include <userver/utest/utest.hpp>
+
+#include <server/websocket/deflate.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ws = server::websocket;
+
+TEST(WebsocketDeflate, Negotiate) {
+  const ws::impl::DeflateSettings settings;
+
+  EXPECT_FALSE(ws::impl::NegotiateDeflate("", settings));
+  EXPECT_FALSE(ws::impl::NegotiateDeflate("x-webkit-deflate-frame", settings));
+
+  auto params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; client_max_window_bits", settings);
+  ASSERT_TRUE(params);
+  EXPECT_FALSE(params->server_no_context_takeover);
+  EXPECT_FALSE(params->client_max_window_bits);
+  EXPECT_EQ(ws::impl::FormatDeflateResponse(*params), "permessage-deflate");
+
+  params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_max_window_bits=10; "
+      "client_no_context_takeover",
+      settings);
+  ASSERT_TRUE(params);
+  EXPECT_EQ(params->server_max_window_bits, 10);
+  EXPECT_EQ(ws::impl::FormatDeflateResponse(*params),
+            "permessage-deflate; client_no_context_takeover; "
+            "server_max_window_bits=10");
+
+  params = ws::impl::NegotiateDeflate("permessage-deflate",
+                                      {/*server_no_context_takeover=*/true});
+  ASSERT_TRUE(params);
+  EXPECT_EQ(ws::impl::FormatDeflateResponse(*params),
+            "permessage-deflate; server_no_context_takeover");
+}
+
+TEST(WebsocketDeflate, NegotiateFallback) {
+  const ws::impl::DeflateSettings settings;
+
+  // unsupported window, unknown parameter and duplicate parameter
+  EXPECT_FALSE(ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_max_window_bits=8", settings));
+  EXPECT_FALSE(
+      ws::impl::NegotiateDeflate("permessage-deflate; unknown", settings));
+  EXPECT_FALSE(ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_no_context_takeover; "
+      "server_no_context_takeover",
+      settings));
+
+  const auto params = ws::impl::NegotiateDeflate(
+      "permessage-deflate; server_max_window_bits=8, "
+      "permessage-deflate; client_max_window_bits=\"12\"",
+      settings);
+  ASSERT_TRUE(params);
+  EXPECT_EQ(params->client_max_window_bits, 12);
+  EXPECT_FALSE(params->server_max_window_bits);
+}
+
+TEST(WebsocketDeflate, RoundTrip) {
+  for (const bool no_context_takeover : {false, true}) {
+    ws::impl::DeflateParams params;
+    params.server_no_context_takeover = no_context_takeover;
+    ws::impl::Deflater deflater{params};
+    ws::impl::Inflater inflater;
+
+    std::string message;
+    for (int i = 0; i < 1000; ++i) message += "message " + std::to_string(i);
+
+    std::string compressed;
+    for (int i = 0; i < 3; ++i) {
+      deflater.Compress(utils::as_bytes(utils::span<const char>(message)),
+                        compressed);
+      EXPECT_LT(compressed.size(), message.size());
+
+      std::string payload = compressed;
+      EXPECT_EQ(inflater.Decompress(payload, message.size()),
+                ws::CloseStatus::kNone);
+      EXPECT_EQ(payload, message);
+    }
+
+    // without context takeover every message is decodable on its own
+    ws::impl::Inflater fresh_inflater;
+    std::string payload = compressed;
+    EXPECT_EQ(fresh_inflater.Decompress(payload, message.size()),
+              no_context_takeover ? ws::CloseStatus::kNone
+                                  : ws::CloseStatus::kBadMessageData);
+  }
+}
+
+TEST(WebsocketDeflate, TooBig) {
+  ws::impl::Deflater deflater{{}};
+  ws::impl::Inflater inflater;
+
+  const std::string message(10000, 'a');
+  std::string payload;
+  deflater.Compress(utils::as_bytes(utils::span<const char>(message)), payload);
+  EXPECT_EQ(inflater.Decompress(payload, message.size() - 1),
+            ws::CloseStatus::kTooBigData);
+}
+
+USERVER_NAMESPACE_END
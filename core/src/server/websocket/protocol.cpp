@@ -6,6 +6,12 @@
 #include <cryptopp/sha.h>
 #include <boost/endian/conversion.hpp>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <userver/crypto/base64.hpp>
 #include <userver/engine/io/exception.hpp>
 #include <userver/engine/task/cancel.hpp>
@@ -39,14 +45,34 @@ union Mask32 {
   uint8_t mask8[4];
 };
 
-void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-  auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-  while (len >= sizeof(uint32_t)) {
-    *(dest32++) ^= mask.mask32;
-    len -= sizeof(uint32_t);
+// Every block size is a multiple of the mask size, so the mask stays in phase
+// when switching from wider blocks to narrower ones.
+void XorMaskInplace(uint8_t* dest, std::size_t len, Mask32 mask) noexcept {
+  std::size_t i = 0;
+#ifdef __AVX2__
+  const auto mask256 = _mm256_set1_epi32(static_cast<int>(mask.mask32));
+  for (; i + sizeof(__m256i) <= len; i += sizeof(__m256i)) {
+    auto* block = reinterpret_cast<__m256i_u*>(dest + i);
+    _mm256_storeu_si256(block,
+                        _mm256_xor_si256(_mm256_loadu_si256(block), mask256));
+  }
+#endif
+#ifdef __SSE2__
+  const auto mask128 = _mm_set1_epi32(static_cast<int>(mask.mask32));
+  for (; i + sizeof(__m128i) <= len; i += sizeof(__m128i)) {
+    auto* block = reinterpret_cast<__m128i_u*>(dest + i);
+    _mm_storeu_si128(block, _mm_xor_si128(_mm_loadu_si128(block), mask128));
+  }
+#endif
+  const uint64_t mask64 =
+      (static_cast<uint64_t>(mask.mask32) << 32) | mask.mask32;
+  for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+    uint64_t block = 0;
+    std::memcpy(&block, dest + i, sizeof(block));
+    block ^= mask64;
+    std::memcpy(dest + i, &block, sizeof(block));
   }
-  auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-  for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
+  for (; i < len; ++i) dest[i] ^= mask.mask8[i % sizeof(mask)];
 }
 
 template <class T, class V>
@@ -61,7 +87,7 @@ namespace frames {
 
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final) {
+    Continuation is_continuation, Final is_final, Compressed is_compressed) {
   boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
 
   frame.resize(sizeof(WSHeader));
@@ -74,6 +100,7 @@ boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
   hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
   hdr->bits.opcode = is_text ? kText : kBinary;
   if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+  if (is_compressed == Compressed::kYes) hdr->bits.reserved = kRsv1;
 
   if (data.size() <= 125) {
     hdr->bits.payloadLen = data.size();
@@ -159,6 +186,13 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
 
   const bool isDataFrame =
       (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
+  if (hdr.bits.reserved & kRsv1) {
+    // RSV1 marks the first frame of a compressed message
+    if (!frame.deflate_negotiated || !isDataFrame ||
+        hdr.bits.opcode == kContinuation) {
+      return CloseStatus::kProtocolError;
+    }
+  }
   if (hdr.bits.payloadLen <= 125) {
     payload_len = hdr.bits.payloadLen;
   } else if (hdr.bits.payloadLen == 126) {
@@ -201,8 +235,9 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
     if (mask.mask32)
-      XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()),
-                     frame.payload->size(), mask);
+      XorMaskInplace(
+          reinterpret_cast<uint8_t*>(frame.payload->data() + newPayloadOffset),
+          payload_len, mask);
   }
   char opcode = hdr.bits.opcode;
   char fin = hdr.bits.fin;
@@ -224,6 +259,8 @@ CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
       frame.is_text = true;
       [[fallthrough]];
     case kBinary:
+      frame.is_compressed = hdr.bits.reserved & kRsv1;
+      [[fallthrough]];
     case kContinuation:
       frame.waiting_continuation = !fin;
       break;
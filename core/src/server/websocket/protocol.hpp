@@ -2,6 +2,7 @@
 
 #include <userver/server/websocket/server.hpp>
 
+#include <optional>
 #include <string>
 
 #include <boost/container/small_vector.hpp>
@@ -10,6 +11,8 @@
 #include <userver/tracing/span.hpp>
 #include <userver/utils/span.hpp>
 
+#include <server/websocket/deflate.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::websocket::impl {
@@ -60,6 +63,9 @@ union WSHeader {
 
 static_assert(sizeof(WSHeader) == 2);
 
+// RSV1 bit within WSHeader::bits::reserved, used by permessage-deflate
+constexpr inline unsigned char kRsv1 = 0x4;
+
 constexpr inline unsigned int kMaxFrameHeaderSize =
     sizeof(WSHeader) + sizeof(uint64_t);
 
@@ -75,9 +81,15 @@ enum class Final {
   kNo,
 };
 
+enum class Compressed {
+  kYes,
+  kNo,
+};
+
 boost::container::small_vector<char, impl::kMaxFrameHeaderSize> DataFrameHeader(
     utils::span<const std::byte> data, bool is_text,
-    Continuation is_continuation, Final is_final);
+    Continuation is_continuation, Final is_final,
+    Compressed is_compressed = Compressed::kNo);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(
     WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
@@ -94,6 +106,8 @@ struct FrameParserState {
   bool pong_received = false;
   bool waiting_continuation = false;
   bool is_text = false;
+  bool is_compressed = false;
+  bool deflate_negotiated = false;
   CloseStatusInt remote_close_status = 0;
 
   std::string* payload = nullptr;
@@ -102,6 +116,11 @@ struct FrameParserState {
 CloseStatus ReadWSFrame(FrameParserState& frame, engine::io::ReadableBase& io,
                         unsigned max_payload_size, std::size_t& payload_len);
 
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate_params);
+
 }  // namespace server::websocket::impl
 
 USERVER_NAMESPACE_END
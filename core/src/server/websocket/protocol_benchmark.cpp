@@ -0,0 +1,156 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include <boost/endian/conversion.hpp>
+
+#include <server/websocket/deflate.hpp>
+#include <server/websocket/protocol.hpp>
+#include <userver/engine/run_standalone.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace ws = server::websocket;
+
+class MemoryReader final : public engine::io::ReadableBase {
+ public:
+  explicit MemoryReader(std::string data) : data_(std::move(data)) {}
+
+  void Rewind() { pos_ = 0; }
+
+  bool IsValid() const override { return true; }
+
+  bool WaitReadable(engine::Deadline) override { return true; }
+
+  size_t ReadSome(void* buf, size_t len, engine::Deadline deadline) override {
+    return ReadAll(buf, len, deadline);
+  }
+
+  size_t ReadAll(void* buf, size_t len, engine::Deadline) override {
+    len = std::min(len, data_.size() - pos_);
+    std::memcpy(buf, data_.data() + pos_, len);
+    pos_ += len;
+    return len;
+  }
+
+ private:
+  const std::string data_;
+  std::size_t pos_{0};
+};
+
+// Mimics a JSON update of a realtime feed
+std::string MakePayload(std::size_t size) {
+  std::string payload;
+  payload.reserve(size);
+  for (std::size_t i = 0; payload.size() < size; ++i) {
+    payload += R"({"id":)" + std::to_string(i) +
+               R"(,"price":)" + std::to_string(i * 7919 % 100000) +
+               R"(,"status":"active"},)";
+  }
+  payload.resize(size);
+  return payload;
+}
+
+std::string MakeMaskedFrame(std::string_view payload) {
+  std::string frame;
+  frame.push_back(static_cast<char>(0x82));  // FIN, binary
+  frame.push_back(static_cast<char>(0x80 | 127));
+  const auto len = boost::endian::native_to_big<uint64_t>(payload.size());
+  frame.append(reinterpret_cast<const char*>(&len), sizeof(len));
+
+  constexpr char kMask[] = {'\x12', '\x34', '\x56', '\x78'};
+  frame.append(kMask, sizeof(kMask));
+  for (std::size_t i = 0; i < payload.size(); ++i) {
+    frame.push_back(payload[i] ^ kMask[i % sizeof(kMask)]);
+  }
+  return frame;
+}
+
+}  // namespace
+
+void websocket_read_masked_frame(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    MemoryReader reader{MakeMaskedFrame(MakePayload(size))};
+    std::string payload;
+    payload.reserve(size);
+
+    for ([[maybe_unused]] auto _ : state) {
+      reader.Rewind();
+      payload.clear();
+      ws::impl::FrameParserState frame;
+      frame.payload = &payload;
+      std::size_t payload_len = 0;
+      benchmark::DoNotOptimize(
+          ws::impl::ReadWSFrame(frame, reader, size, payload_len));
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+  });
+}
+BENCHMARK(websocket_read_masked_frame)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+void websocket_encode_frame(benchmark::State& state) {
+  const auto payload = MakePayload(state.range(0));
+  const auto data = utils::as_bytes(utils::span<const char>(payload));
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(ws::impl::frames::DataFrameHeader(
+        data, true, ws::impl::frames::Continuation::kNo,
+        ws::impl::frames::Final::kYes));
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(websocket_encode_frame)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+void websocket_deflate_message(benchmark::State& state) {
+  const auto payload = MakePayload(state.range(0));
+  const auto data = utils::as_bytes(utils::span<const char>(payload));
+
+  ws::impl::DeflateParams params;
+  params.server_no_context_takeover = state.range(1);
+  ws::impl::Deflater deflater{params};
+  std::string compressed;
+
+  for ([[maybe_unused]] auto _ : state) {
+    deflater.Compress(data, compressed);
+    benchmark::DoNotOptimize(ws::impl::frames::DataFrameHeader(
+        utils::as_bytes(utils::span<const char>(compressed)), true,
+        ws::impl::frames::Continuation::kNo, ws::impl::frames::Final::kYes,
+        ws::impl::frames::Compressed::kYes));
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+  state.counters["ratio"] =
+      static_cast<double>(payload.size()) / compressed.size();
+}
+BENCHMARK(websocket_deflate_message)
+    ->ArgsProduct({benchmark::CreateRange(64, 1 << 20, 8), {0, 1}});
+
+void websocket_inflate_message(benchmark::State& state) {
+  const auto payload = MakePayload(state.range(0));
+  const auto data = utils::as_bytes(utils::span<const char>(payload));
+
+  ws::impl::DeflateParams params;
+  params.server_no_context_takeover = true;
+  ws::impl::Deflater deflater{params};
+  std::string compressed;
+  deflater.Compress(data, compressed);
+
+  std::string message;
+  for ([[maybe_unused]] auto _ : state) {
+    // a fresh inflater per message, as with client_no_context_takeover
+    state.PauseTiming();
+    ws::impl::Inflater inflater;
+    message = compressed;
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(inflater.Decompress(message, payload.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(websocket_inflate_message)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+USERVER_NAMESPACE_END
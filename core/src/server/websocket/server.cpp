@@ -29,13 +29,95 @@ utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) {
   return utils::as_bytes(span);
 }
 
+// Splits the message into fragments and calls `func(header, payload)` for
+// each frame. Only the first frame of a message is marked as compressed.
+template <typename Func>
+void ForEachDataFrame(utils::span<const std::byte> data_to_send, bool is_text,
+                      impl::frames::Compressed compressed,
+                      unsigned fragment_size, Func&& func) {
+  auto continuation = impl::frames::Continuation::kNo;
+  while (data_to_send.size() > fragment_size && fragment_size > 0) {
+    const auto data_frame_header = impl::frames::DataFrameHeader(
+        data_to_send.first(fragment_size), is_text, continuation,
+        impl::frames::Final::kNo, compressed);
+    func(data_frame_header, data_to_send.first(fragment_size));
+    continuation = impl::frames::Continuation::kYes;
+    compressed = impl::frames::Compressed::kNo;
+    data_to_send = data_to_send.last(data_to_send.size() - fragment_size);
+  }
+  const auto data_frame_header = impl::frames::DataFrameHeader(
+      data_to_send, is_text, continuation, impl::frames::Final::kYes,
+      compressed);
+  func(data_frame_header, data_to_send);
+}
+
+std::string EncodeDataFrames(utils::span<const std::byte> data, bool is_text,
+                             impl::frames::Compressed compressed,
+                             unsigned fragment_size) {
+  std::string result;
+  result.reserve(data.size() + impl::kMaxFrameHeaderSize);
+  ForEachDataFrame(
+      data, is_text, compressed, fragment_size,
+      [&result](const auto& header, auto payload) {
+        result.append(header.data(), header.size());
+        result.append(reinterpret_cast<const char*>(payload.data()),
+                      payload.size());
+      });
+  return result;
+}
+
 }  // namespace
 
+struct PreparedMessage::Frames final {
+  std::string data;
+  bool is_text{false};
+
+  // Headers and payloads of all the fragments, ready to be written
+  std::string plain;
+
+  // Same as `plain` but compressed without context takeover, so that it could
+  // be decoded by any peer. Empty if permessage-deflate is disabled.
+  std::string compressed;
+};
+
+PreparedMessage::PreparedMessage(std::string data, bool is_text,
+                                 const Config& config) {
+  auto frames = std::make_shared<Frames>();
+  frames->data = std::move(data);
+  frames->is_text = is_text;
+
+  const auto payload = MakeBinarySpan(frames->data);
+  frames->plain = EncodeDataFrames(
+      payload, is_text, impl::frames::Compressed::kNo, config.fragment_size);
+
+  if (config.permessage_deflate && !payload.empty() &&
+      payload.size() >= config.deflate_min_size) {
+    impl::DeflateParams params;
+    params.server_no_context_takeover = true;
+    std::string compressed;
+    impl::Deflater{params}.Compress(payload, compressed);
+    frames->compressed =
+        EncodeDataFrames(MakeBinarySpan(compressed), is_text,
+                         impl::frames::Compressed::kYes, config.fragment_size);
+  }
+
+  frames_ = std::move(frames);
+}
+
+const std::string& PreparedMessage::GetData() const noexcept {
+  return frames_->data;
+}
+
+bool PreparedMessage::IsText() const noexcept { return frames_->is_text; }
+
 Config Parse(const yaml_config::YamlConfig& config,
              formats::parse::To<Config>) {
   return {
       config["max-remote-payload"].As<unsigned>(65536),
       config["fragment-size"].As<unsigned>(65536),
+      config["permessage-deflate"].As<bool>(false),
+      config["deflate-no-context-takeover"].As<bool>(false),
+      config["deflate-min-size"].As<unsigned>(64),
   };
 }
 
@@ -64,11 +146,29 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
 
   Config config;
 
+  // Present only if permessage-deflate is negotiated. deflater_ and
+  // compressed_ are protected by write_mutex_, inflater_ is used by Recv().
+  std::unique_ptr<impl::Deflater> deflater_;
+  std::unique_ptr<impl::Inflater> inflater_;
+  std::string compressed_;
+  // Prepared messages are compressed with the maximum window size
+  bool prepared_deflate_allowed_{false};
+
  public:
-  WebSocketConnectionImpl(std::unique_ptr<engine::io::RwBase> io_,
-                          const engine::io::Sockaddr& remote_addr,
-                          const Config& server_config)
-      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+  WebSocketConnectionImpl(
+      std::unique_ptr<engine::io::RwBase> io_,
+      const engine::io::Sockaddr& remote_addr, const Config& server_config,
+      const std::optional<impl::DeflateParams>& deflate_params)
+      : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+    if (deflate_params) {
+      deflater_ = std::make_unique<impl::Deflater>(*deflate_params);
+      inflater_ = std::make_unique<impl::Inflater>();
+      frame_.deflate_negotiated = true;
+      prepared_deflate_allowed_ = !deflate_params->server_max_window_bits ||
+                                  *deflate_params->server_max_window_bits ==
+                                      impl::kMaxDeflateWindowBits;
+    }
+  }
 
   ~WebSocketConnectionImpl() override {
     LOG_TRACE() << "Websocket connection closed";
@@ -93,26 +193,38 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
       SendExactly(*io, close_frame, {});
     } else if (!message.data.empty()) {
       utils::span<const std::byte> data_to_send{message.data};
-      auto continuation = impl::frames::Continuation::kNo;
-      while (data_to_send.size() > config.fragment_size &&
-             config.fragment_size > 0) {
-        const auto data_frame_header = impl::frames::DataFrameHeader(
-            data_to_send.first(config.fragment_size),
-            message.opcode == impl::WSOpcodes::kText, continuation,
-            impl::frames::Final::kNo);
-        SendExactly(*io, data_frame_header,
-                    data_to_send.first(config.fragment_size));
-        continuation = impl::frames::Continuation::kYes;
-        data_to_send =
-            data_to_send.last(data_to_send.size() - config.fragment_size);
+      auto compressed = impl::frames::Compressed::kNo;
+      if (deflater_ && data_to_send.size() >= config.deflate_min_size) {
+        deflater_->Compress(data_to_send, compressed_);
+        data_to_send = MakeBinarySpan(compressed_);
+        compressed = impl::frames::Compressed::kYes;
       }
-      const auto data_frame_header = impl::frames::DataFrameHeader(
-          data_to_send, message.opcode == impl::WSOpcodes::kText, continuation,
-          impl::frames::Final::kYes);
-      SendExactly(*io, data_frame_header, data_to_send);
+      ForEachDataFrame(data_to_send, message.opcode == impl::WSOpcodes::kText,
+                       compressed, config.fragment_size,
+                       [this](const auto& header, auto payload) {
+                         SendExactly(*io, header, payload);
+                       });
     }
   }
 
+  void SendPrepared(const PreparedMessage& message) override {
+    const auto& frames = *message.frames_;
+    stats_.msg_sent++;
+    stats_.bytes_sent += frames.data.size();
+
+    const bool use_compressed =
+        deflater_ && prepared_deflate_allowed_ && !frames.compressed.empty();
+    const auto& encoded = use_compressed ? frames.compressed : frames.plain;
+    if (encoded.empty()) return;
+
+    const std::unique_lock lock(write_mutex_);
+    LOG_TRACE() << "Write prepared message " << encoded.size() << " bytes";
+    SendExactly(*io, encoded, {});
+
+    // Peer's window now contains data that deflater_ is not aware of
+    if (use_compressed) deflater_->Reset();
+  }
+
   void Send(const Message& message) override {
     MessageExtended mext{
         MakeBinarySpan(message.data),
@@ -176,6 +288,17 @@ class WebSocketConnectionImpl final : public WebSocketConnection {
         }
         if (frame_.waiting_continuation) continue;
 
+        if (frame_.is_compressed) {
+          status_raw =
+              inflater_->Decompress(msg.data, config.max_remote_payload);
+          if (status_raw != CloseStatus::kNone) {
+            MessageExtended close_msg{{}, impl::WSOpcodes::kClose, status_raw};
+            SendExtended(close_msg);
+            msg = CloseMessage(status_raw);
+            return;
+          }
+        }
+
         msg.is_text = frame_.is_text;
         stats_.msg_recv++;
         stats_.bytes_recv += msg.data.size();
@@ -215,13 +338,29 @@ WebSocketConnection::WebSocketConnection() = default;
 
 WebSocketConnection::~WebSocketConnection() = default;
 
+void WebSocketConnection::SendPrepared(const PreparedMessage& message) {
+  Send({message.GetData(), {}, message.IsText()});
+}
+
 std::shared_ptr<WebSocketConnection> MakeWebSocket(
     std::unique_ptr<engine::io::RwBase>&& socket,
     engine::io::Sockaddr&& peer_name, const Config& config) {
+  return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config,
+                             std::nullopt);
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name, const Config& config,
+    const std::optional<DeflateParams>& deflate_params) {
   return std::make_shared<WebSocketConnectionImpl>(
-      std::move(socket), std::move(peer_name), config);
+      std::move(socket), std::move(peer_name), config, deflate_params);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
@@ -63,6 +63,18 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
 
   if (!HandleHandshake(request, response, context)) return "";
 
+  std::optional<impl::DeflateParams> deflate_params;
+  if (config_.permessage_deflate) {
+    deflate_params = impl::NegotiateDeflate(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions),
+        {config_.deflate_no_context_takeover});
+    if (deflate_params) {
+      response.SetHeader(
+          USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+          impl::FormatDeflateResponse(*deflate_params));
+    }
+  }
+
   response.SetStatus(server::http::HttpStatus::kSwitchingProtocols);
   response.SetHeader(USERVER_NAMESPACE::http::headers::kConnection, "Upgrade");
   response.SetHeader(USERVER_NAMESPACE::http::headers::kUpgrade, "websocket");
@@ -72,11 +84,12 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
   request.SetUpgradeWebsocket(
       [context = std::make_shared<server::request::RequestContext>(
            std::move(context)),
+       deflate_params,
        this](std::unique_ptr<engine::io::RwBase> socket,
              engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket),
-                                           std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(
+            std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
           Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -112,6 +125,18 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: boolean
+        description: negotiate permessage-deflate compression (RFC 7692)
+        defaultDescription: false
+    deflate-no-context-takeover:
+        type: boolean
+        description: reset compression context after each outgoing message
+        defaultDescription: false
+    deflate-min-size:
+        type: integer
+        description: outgoing messages smaller than this are not compressed
+        defaultDescription: 64
 )");
 }
 
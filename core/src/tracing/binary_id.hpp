@@ -0,0 +1,169 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+// Trace, span or link ID.
+//
+// IDs generated by userver and most of the IDs from the tracing headers are
+// lowercase hex strings of `Size` bytes, such IDs are kept as raw bytes and
+// are hex-encoded only when needed. Other IDs are kept as is.
+template <std::size_t Size>
+class BinaryId final {
+ public:
+  using Bytes = std::array<std::uint8_t, Size>;
+  using HexBuffer = std::array<char, Size * 2>;
+
+  BinaryId() noexcept = default;
+
+  explicit BinaryId(const Bytes& bytes) noexcept
+      : bytes_(bytes), kind_(Kind::kBinary) {}
+
+  // Does not copy the cached hex, to avoid an allocation
+  BinaryId(const BinaryId& other)
+      : bytes_(other.bytes_),
+        kind_(other.kind_),
+        string_(other.kind_ == Kind::kString ? other.string_ : std::string{}) {}
+
+  BinaryId(BinaryId&& other) noexcept
+      : bytes_(other.bytes_),
+        kind_(other.kind_),
+        string_(std::move(other.string_)),
+        hex_state_(other.hex_state_.exchange(HexState::kNone,
+                                             std::memory_order_relaxed)) {}
+
+  BinaryId& operator=(const BinaryId& other) {
+    if (this != &other) *this = BinaryId{other};
+    return *this;
+  }
+
+  BinaryId& operator=(BinaryId&& other) noexcept {
+    bytes_ = other.bytes_;
+    kind_ = other.kind_;
+    string_ = std::move(other.string_);
+    hex_state_.store(
+        other.hex_state_.exchange(HexState::kNone, std::memory_order_relaxed),
+        std::memory_order_relaxed);
+    return *this;
+  }
+
+  void Assign(std::string&& id) {
+    if (TryParse(id)) return;
+    kind_ = id.empty() ? Kind::kEmpty : Kind::kString;
+    string_ = std::move(id);
+  }
+
+  bool IsEmpty() const noexcept { return kind_ == Kind::kEmpty; }
+
+  // The returned view is valid while both `buffer` and `*this` are alive
+  std::string_view View(HexBuffer& buffer) const noexcept {
+    if (kind_ != Kind::kBinary) return string_;
+    if (hex_state_.load(std::memory_order_acquire) == HexState::kReady) {
+      return string_;
+    }
+    Encode(buffer.data());
+    return {buffer.data(), buffer.size()};
+  }
+
+  // Raw bytes of the ID. IDs that are not hex are hashed to keep the IDs of a
+  // trace the same, the empty ID is all zeros.
+  Bytes GetBytes() const noexcept {
+    if (kind_ == Kind::kBinary) return bytes_;
+
+    Bytes result{};
+    if (kind_ == Kind::kEmpty) return result;
+
+    std::uint64_t hash = 14695981039346656037ULL;  // FNV-1a
+    for (std::size_t i = 0; i < Size; ++i) {
+      if (i % sizeof(hash) == 0) {
+        for (const char c : string_) {
+          hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+        }
+      }
+      result[i] = static_cast<std::uint8_t>(hash >> (i % sizeof(hash) * 8));
+    }
+    return result;
+  }
+
+  // Caches the hex for the binary IDs, may be called concurrently
+  const std::string& GetString() const {
+    if (kind_ != Kind::kBinary) return string_;
+
+    auto state = hex_state_.load(std::memory_order_acquire);
+    if (state == HexState::kReady) return string_;
+
+    if (state == HexState::kNone &&
+        hex_state_.compare_exchange_strong(state, HexState::kEncoding,
+                                           std::memory_order_acquire)) {
+      string_.resize(Size * 2);
+      Encode(string_.data());
+      hex_state_.store(HexState::kReady, std::memory_order_release);
+      return string_;
+    }
+
+    // Another thread encodes the hex right now, it takes a few nanoseconds
+    while (hex_state_.load(std::memory_order_acquire) != HexState::kReady) {
+    }
+    return string_;
+  }
+
+ private:
+  enum class Kind : std::uint8_t { kEmpty, kBinary, kString };
+  enum class HexState : std::uint8_t { kNone, kEncoding, kReady };
+
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+
+  static int ParseHexDigit(char c) noexcept {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+  }
+
+  bool TryParse(std::string_view hex) noexcept {
+    if (hex.size() != Size * 2) return false;
+
+    Bytes bytes{};
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto high = ParseHexDigit(hex[i * 2]);
+      const auto low = ParseHexDigit(hex[i * 2 + 1]);
+      if (high < 0 || low < 0) return false;
+      bytes[i] = static_cast<std::uint8_t>(high * 16 + low);
+    }
+
+    bytes_ = bytes;
+    kind_ = Kind::kBinary;
+    string_.clear();
+    hex_state_.store(HexState::kNone, std::memory_order_relaxed);
+    return true;
+  }
+
+  void Encode(char* out) const noexcept {
+    for (const auto byte : bytes_) {
+      *out++ = kHexDigits[byte >> 4];
+      *out++ = kHexDigits[byte & 0xf];
+    }
+  }
+
+  Bytes bytes_{};
+  Kind kind_{Kind::kEmpty};
+  // The ID for kString, the lazily encoded hex for kBinary
+  mutable std::string string_;
+  // Guards the lazy encoding of `string_` for kBinary, as the const getters
+  // of tracing::Span may be called from different threads
+  mutable std::atomic<HexState> hex_state_{HexState::kNone};
+};
+
+using TraceId = BinaryId<16>;
+using SpanId = BinaryId<8>;
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
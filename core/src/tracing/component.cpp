@@ -2,6 +2,7 @@
 
 #include <userver/components/component.hpp>
 #include <userver/logging/component.hpp>
+#include <userver/tracing/sampling.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -31,6 +32,8 @@ Tracer::Tracer(const ComponentConfig& config, const ComponentContext& context) {
       LOG_INFO() << "Opentracing logger is not registered";
     }
 
+    tracing::Tracer::SetSamplingSettings(
+        config["sampling"].As<tracing::SamplingSettings>({}));
     tracing::Tracer::SetTracer(tracing::MakeTracer(
         std::move(service_name), std::move(opentracing_logger), tracer_type));
   } else {
@@ -52,6 +55,34 @@ properties:
         type: string
         description: type of the tracer to trace, currently supported only 'native'
         defaultDescription: 'native'
+    sampling:
+        type: object
+        description: sampling of the traces, see tracing::SamplingSettings
+        additionalProperties: false
+        properties:
+            probability:
+                type: number
+                description: probability of a new trace to be sampled, from 0 to 1
+                defaultDescription: 1
+                minimum: 0
+                maximum: 1
+            max-traces-per-second:
+                type: integer
+                description: max count of new traces sampled each second
+                defaultDescription: unlimited
+                minimum: 1
+            tail-sampling:
+                type: boolean
+                description: buffer the spans of not sampled traces to log the slow and failed ones
+                defaultDescription: false
+            tail-slow-threshold:
+                type: string
+                description: duration of the root span that makes a not sampled trace logged
+                defaultDescription: 1s
+            tail-max-buffered-spans:
+                type: integer
+                description: max spans of a trace to buffer, the rest are dropped
+                defaultDescription: 100
 )");
 }
 
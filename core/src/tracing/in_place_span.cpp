@@ -3,22 +3,11 @@
 #include <utility>
 
 #include <tracing/span_impl.hpp>
-#include <userver/utils/uuid4.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace tracing {
 
-namespace {
-
-void SetLinkIfRoot(tracing::Span& span) {
-  if (span.GetLink().empty()) {
-    span.SetLink(utils::generators::GenerateUuid());
-  }
-}
-
-}  // namespace
-
 struct InPlaceSpan::Impl final {
   template <typename... Args>
   explicit Impl(Args&&... args)
@@ -33,7 +22,7 @@ InPlaceSpan::InPlaceSpan(std::string&& name,
     : impl_(std::move(name), ReferenceType::kChild, logging::Level::kInfo,
             std::move(source_location)) {
   impl_->span.AttachToCoroStack();
-  SetLinkIfRoot(impl_->span);
+  impl_->span_impl.GenerateLinkIfEmpty();
 }
 
 InPlaceSpan::InPlaceSpan(std::string&& name, std::string&& trace_id,
@@ -44,7 +33,7 @@ InPlaceSpan::InPlaceSpan(std::string&& name, std::string&& trace_id,
   impl_->span.AttachToCoroStack();
   impl_->span_impl.SetTraceId(std::move(trace_id));
   impl_->span_impl.SetParentId(std::move(parent_span_id));
-  SetLinkIfRoot(impl_->span);
+  impl_->span_impl.GenerateLinkIfEmpty();
 }
 
 InPlaceSpan::~InPlaceSpan() = default;
@@ -1,5 +1,12 @@
 #include <userver/tracing/manager.hpp>
 
+#include <charconv>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+
+#include <fmt/format.h>
+
 #include <userver/engine/task/inherited_variable.hpp>
 #include <userver/http/common_headers.hpp>
 #include <userver/server/http/http_request.hpp>
@@ -15,6 +22,29 @@ namespace {
 
 constexpr std::string_view kSampledTag = "sampled";
 constexpr std::string_view kDefaultOtelTraceFlags = "00";
+constexpr std::uint8_t kOtelSampledFlag = 0x01;
+
+// Returns nullopt on malformed flags
+std::optional<std::uint8_t> ParseOtelTraceFlags(std::string_view flags) {
+  std::uint8_t result = 0;
+  const auto [ptr, ec] = std::from_chars(flags.data(),
+                                         flags.data() + flags.size(), result,
+                                         /*base=*/16);
+  if (ec != std::errc{} || ptr != flags.data() + flags.size()) {
+    return std::nullopt;
+  }
+  return result;
+}
+
+std::string MakeOtelTraceFlags(std::string_view flags, bool sampled) {
+  auto value = ParseOtelTraceFlags(flags).value_or(0);
+  if (sampled) {
+    value |= kOtelSampledFlag;
+  } else {
+    value &= static_cast<std::uint8_t>(~kOtelSampledFlag);
+  }
+  return fmt::format("{:02x}", value);
+}
 
 // The order matter for TryFillSpanBuilderFromRequest as it returns on first
 // success
@@ -53,6 +83,8 @@ bool B3TryFillSpanBuilderFromRequest(const server::http::HttpRequest& request,
   span_builder.SetTraceId(trace_id);
   span_builder.SetParentSpanId(request.GetHeader(b3::kSpanId));
   span_builder.AddTagFrozen(std::string{kSampledTag}, sampled);
+  // "d" is the debug flag, that implies sampling
+  span_builder.SetSampled(sampled != "0");
   return true;
 }
 
@@ -64,7 +96,9 @@ void B3FillWithTracingContext(const tracing::Span& span, T& target) {
   target.SetHeader(b3::kParentSpanId, span.GetParentId());
 
   const auto& sampled = server::request::GetTaskInheritedHeader(b3::kSampled);
-  if (!sampled.empty()) {
+  if (!span.IsSampled()) {
+    target.SetHeader(b3::kSampled, "0");
+  } else if (!sampled.empty() && sampled != "0") {
     target.SetHeader(b3::kSampled, sampled);
   } else {
     target.SetHeader(b3::kSampled, "1");
@@ -97,6 +131,12 @@ bool OpenTelemetryTryFillSpanBuilderFromRequest(
   if (data.trace_flags.empty()) {
     data.trace_flags = std::string{kDefaultOtelTraceFlags};
   }
+  // Many clients do not set the flag at all, so only the positive decision is
+  // honored
+  const auto trace_flags = ParseOtelTraceFlags(data.trace_flags);
+  if (trace_flags && (*trace_flags & kOtelSampledFlag)) {
+    span_builder.SetSampled(true);
+  }
 
   const auto& tracestate = request.GetHeader(opentelemetry::kTraceState);
   kOTelTracingHeadersInheritedData.Set({
@@ -115,7 +155,8 @@ void OpenTelemetryFillWithTracingContext(const tracing::Span& span, T& target) {
     traceflags = data->traceflags;
   }
   auto traceparent_result = opentelemetry::BuildTraceParentHeader(
-      span.GetTraceId(), span.GetSpanId(), traceflags);
+      span.GetTraceId(), span.GetSpanId(),
+      MakeOtelTraceFlags(traceflags, span.IsSampled()));
 
   if (!traceparent_result.has_value()) {
     LOG_LIMITED_WARNING() << fmt::format(
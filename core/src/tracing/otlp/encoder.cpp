@@ -0,0 +1,251 @@
+#include <tracing/otlp/encoder.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#include <userver/utils/overloaded.hpp>
+#include <userver/utils/statistics/storage.hpp>
+
+#include <tracing/otlp/protobuf_writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+namespace {
+
+// Field numbers of the messages from the opentelemetry-proto repository
+namespace fields {
+
+constexpr int kResourceSpans = 1;       // ExportTraceServiceRequest
+constexpr int kResourceMetrics = 1;     // ExportMetricsServiceRequest
+constexpr int kResource = 1;            // ResourceSpans, ResourceMetrics
+constexpr int kScopeSpans = 2;          // ResourceSpans
+constexpr int kScopeMetrics = 2;        // ResourceMetrics
+constexpr int kResourceAttributes = 1;  // Resource
+constexpr int kScope = 1;               // ScopeSpans, ScopeMetrics
+constexpr int kScopeName = 1;           // InstrumentationScope
+constexpr int kSpans = 2;               // ScopeSpans
+constexpr int kMetrics = 2;             // ScopeMetrics
+
+// Span
+constexpr int kTraceId = 1;
+constexpr int kSpanId = 2;
+constexpr int kParentSpanId = 4;
+constexpr int kName = 5;
+constexpr int kKind = 6;
+constexpr int kStartTime = 7;
+constexpr int kEndTime = 8;
+constexpr int kAttributes = 9;
+constexpr int kStatus = 15;
+constexpr int kStatusCode = 3;  // Status
+
+// KeyValue and AnyValue
+constexpr int kKey = 1;
+constexpr int kValue = 2;
+constexpr int kStringValue = 1;
+constexpr int kIntValue = 3;
+constexpr int kDoubleValue = 4;
+
+// Metric
+constexpr int kMetricName = 1;
+constexpr int kGauge = 5;
+constexpr int kSum = 7;
+constexpr int kDataPoints = 1;              // Gauge, Sum
+constexpr int kAggregationTemporality = 2;  // Sum
+constexpr int kIsMonotonic = 3;             // Sum
+
+// NumberDataPoint
+constexpr int kPointStartTime = 2;
+constexpr int kPointTime = 3;
+constexpr int kAsDouble = 4;
+constexpr int kAsInt = 6;
+constexpr int kPointAttributes = 7;
+
+}  // namespace fields
+
+constexpr std::uint64_t kSpanKindInternal = 1;
+constexpr std::uint64_t kStatusCodeError = 2;
+constexpr std::uint64_t kTemporalityCumulative = 2;
+constexpr std::string_view kInstrumentationScope = "userver";
+
+std::uint64_t ToUnixNano(std::chrono::system_clock::time_point time) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+void WriteStringAttribute(ProtobufWriter& writer, int field,
+                          std::string_view key, std::string_view value) {
+  writer.WriteMessage(field, [&](ProtobufWriter& key_value) {
+    key_value.WriteBytes(fields::kKey, key);
+    key_value.WriteMessage(fields::kValue, [&](ProtobufWriter& any_value) {
+      any_value.WriteBytes(fields::kStringValue, value);
+    });
+  });
+}
+
+void WriteAttribute(ProtobufWriter& writer,
+                    const logging::LogExtra::Pair& tag) {
+  writer.WriteMessage(fields::kAttributes, [&](ProtobufWriter& key_value) {
+    key_value.WriteBytes(fields::kKey, tag.first);
+    key_value.WriteMessage(fields::kValue, [&](ProtobufWriter& any_value) {
+      std::visit(
+          [&any_value](const auto& value) {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, std::string>) {
+              any_value.WriteBytes(fields::kStringValue, value);
+            } else if constexpr (std::is_floating_point_v<T>) {
+              any_value.WriteDouble(fields::kDoubleValue, value);
+            } else {
+              static_assert(std::is_integral_v<T>);
+              any_value.WriteVarint(
+                  fields::kIntValue,
+                  static_cast<std::uint64_t>(static_cast<std::int64_t>(value)));
+            }
+          },
+          tag.second);
+    });
+  });
+}
+
+void WriteResource(ProtobufWriter& writer, const ResourceAttributes& resource) {
+  writer.WriteMessage(fields::kResource, [&](ProtobufWriter& resource_writer) {
+    for (const auto& [key, value] : resource) {
+      WriteStringAttribute(resource_writer, fields::kResourceAttributes, key,
+                           value);
+    }
+  });
+}
+
+void WriteScope(ProtobufWriter& writer) {
+  writer.WriteMessage(fields::kScope, [](ProtobufWriter& scope) {
+    scope.WriteBytes(fields::kScopeName, kInstrumentationScope);
+  });
+}
+
+void WriteSpan(ProtobufWriter& writer, const impl::FinishedSpan& span) {
+  writer.WriteMessage(fields::kSpans, [&](ProtobufWriter& out) {
+    out.WriteBytes(fields::kTraceId, span.trace_id.data(),
+                   span.trace_id.size());
+    out.WriteBytes(fields::kSpanId, span.span_id.data(), span.span_id.size());
+    if (span.parent_span_id) {
+      out.WriteBytes(fields::kParentSpanId, span.parent_span_id->data(),
+                     span.parent_span_id->size());
+    }
+    out.WriteBytes(fields::kName, span.name);
+    out.WriteVarint(fields::kKind, kSpanKindInternal);
+    out.WriteFixed64(fields::kStartTime, ToUnixNano(span.start_time));
+    out.WriteFixed64(fields::kEndTime, ToUnixNano(span.end_time));
+    for (const auto& tag : span.tags) WriteAttribute(out, tag);
+    if (span.is_error) {
+      out.WriteMessage(fields::kStatus, [](ProtobufWriter& status) {
+        status.WriteVarint(fields::kStatusCode, kStatusCodeError);
+      });
+    }
+  });
+}
+
+class MetricsBuilder final : public utils::statistics::BaseFormatBuilder {
+ public:
+  MetricsBuilder(ProtobufWriter& writer, std::uint64_t start_time,
+                 std::uint64_t now)
+      : writer_(writer), start_time_(start_time), now_(now) {}
+
+  void HandleMetric(std::string_view path, utils::statistics::LabelsSpan labels,
+                    const utils::statistics::MetricValue& value) override {
+    if (value.IsHistogram()) return;
+
+    writer_.WriteMessage(fields::kMetrics, [&](ProtobufWriter& metric) {
+      metric.WriteBytes(fields::kMetricName, path);
+      value.Visit(utils::Overloaded{
+          [&](std::int64_t x) {
+            metric.WriteMessage(fields::kGauge, [&](ProtobufWriter& gauge) {
+              WritePoint(gauge, labels, /*start_time=*/0, [x](auto& point) {
+                point.WriteSignedFixed64(fields::kAsInt, x);
+              });
+            });
+          },
+          [&](double x) {
+            metric.WriteMessage(fields::kGauge, [&](ProtobufWriter& gauge) {
+              WritePoint(gauge, labels, /*start_time=*/0, [x](auto& point) {
+                point.WriteDouble(fields::kAsDouble, x);
+              });
+            });
+          },
+          [&](utils::statistics::Rate x) {
+            metric.WriteMessage(fields::kSum, [&](ProtobufWriter& sum) {
+              WritePoint(sum, labels, start_time_, [x](auto& point) {
+                point.WriteSignedFixed64(fields::kAsInt,
+                                         static_cast<std::int64_t>(x.value));
+              });
+              sum.WriteVarint(fields::kAggregationTemporality,
+                              kTemporalityCumulative);
+              sum.WriteBool(fields::kIsMonotonic, true);
+            });
+          },
+          [](utils::statistics::HistogramView) {},
+      });
+    });
+  }
+
+ private:
+  template <typename WriteValue>
+  void WritePoint(ProtobufWriter& writer, utils::statistics::LabelsSpan labels,
+                  std::uint64_t start_time, WriteValue write_value) {
+    writer.WriteMessage(fields::kDataPoints, [&](ProtobufWriter& point) {
+      for (const auto& label : labels) {
+        WriteStringAttribute(point, fields::kPointAttributes, label.Name(),
+                             label.Value());
+      }
+      if (start_time != 0) {
+        point.WriteFixed64(fields::kPointStartTime, start_time);
+      }
+      point.WriteFixed64(fields::kPointTime, now_);
+      write_value(point);
+    });
+  }
+
+  ProtobufWriter& writer_;
+  const std::uint64_t start_time_;
+  const std::uint64_t now_;
+};
+
+}  // namespace
+
+std::string EncodeTraces(const ResourceAttributes& resource,
+                         const std::vector<impl::FinishedSpan>& spans) {
+  std::string result;
+  ProtobufWriter writer{result};
+  writer.WriteMessage(fields::kResourceSpans, [&](ProtobufWriter& out) {
+    WriteResource(out, resource);
+    out.WriteMessage(fields::kScopeSpans, [&](ProtobufWriter& scope_spans) {
+      WriteScope(scope_spans);
+      for (const auto& span : spans) WriteSpan(scope_spans, span);
+    });
+  });
+  return result;
+}
+
+std::string EncodeMetrics(const ResourceAttributes& resource,
+                          const utils::statistics::Storage& storage,
+                          std::chrono::system_clock::time_point start_time,
+                          std::chrono::system_clock::time_point now) {
+  std::string result;
+  ProtobufWriter writer{result};
+  writer.WriteMessage(fields::kResourceMetrics, [&](ProtobufWriter& out) {
+    WriteResource(out, resource);
+    out.WriteMessage(fields::kScopeMetrics, [&](ProtobufWriter& scope_metrics) {
+      WriteScope(scope_metrics);
+      MetricsBuilder builder{scope_metrics, ToUnixNano(start_time),
+                             ToUnixNano(now)};
+      storage.VisitMetrics(builder);
+    });
+  });
+  return result;
+}
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
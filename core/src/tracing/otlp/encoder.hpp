@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <tracing/span_sink.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+// Attributes of the OTLP resource, e.g. {"service.name", "my-service"}
+using ResourceAttributes = std::vector<std::pair<std::string, std::string>>;
+
+// Serializes the spans into the opentelemetry.proto.collector.trace.v1
+// ExportTraceServiceRequest protobuf message
+std::string EncodeTraces(const ResourceAttributes& resource,
+                         const std::vector<impl::FinishedSpan>& spans);
+
+// Serializes the metrics into the opentelemetry.proto.collector.metrics.v1
+// ExportMetricsServiceRequest protobuf message. Integer and floating point
+// metrics are gauges, utils::statistics::Rate metrics are monotonic sums
+// accumulated since `start_time`. Histograms are not exported.
+std::string EncodeMetrics(const ResourceAttributes& resource,
+                          const utils::statistics::Storage& storage,
+                          std::chrono::system_clock::time_point start_time,
+                          std::chrono::system_clock::time_point now);
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
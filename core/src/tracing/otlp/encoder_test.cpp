@@ -0,0 +1,102 @@
+#include <tracing/otlp/encoder.hpp>
+
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <tracing/otlp/protobuf_writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using namespace std::string_literals;
+
+bool Contains(const std::string& data, const std::string& part) {
+  return data.find(part) != std::string::npos;
+}
+
+tracing::impl::FinishedSpan MakeSpan() {
+  tracing::impl::FinishedSpan span;
+  span.trace_id.fill(0x11);
+  span.span_id.fill(0x22);
+  span.parent_span_id.emplace().fill(0x33);
+  span.name = "op";
+  span.start_time =
+      std::chrono::system_clock::time_point{std::chrono::seconds{1}};
+  span.end_time =
+      std::chrono::system_clock::time_point{std::chrono::seconds{2}};
+  span.tags.emplace_back("k", "v");
+  span.tags.emplace_back("i", 150);
+  span.is_error = true;
+  return span;
+}
+
+}  // namespace
+
+TEST(OtlpProtobufWriter, Varint) {
+  std::string out;
+  tracing::otlp::ProtobufWriter writer{out};
+  writer.WriteVarint(1, 150);
+  EXPECT_EQ(out, "\x08\x96\x01"s);
+}
+
+TEST(OtlpProtobufWriter, Message) {
+  std::string out;
+  tracing::otlp::ProtobufWriter writer{out};
+  writer.WriteMessage(3, [](auto& message) { message.WriteVarint(1, 150); });
+  EXPECT_EQ(out, "\x1a\x03\x08\x96\x01"s);
+}
+
+TEST(OtlpProtobufWriter, LongMessage) {
+  std::string out;
+  tracing::otlp::ProtobufWriter writer{out};
+  const std::string payload(300, 'x');
+  writer.WriteMessage(1,
+                      [&](auto& message) { message.WriteBytes(2, payload); });
+  // 300 bytes of the payload, 1 byte of tag and 2 bytes of length
+  EXPECT_EQ(out, "\x0a\xaf\x02\x12\xac\x02"s + payload);
+}
+
+TEST(OtlpEncoder, Traces) {
+  const auto data = tracing::otlp::EncodeTraces(
+      {{"service.name", "svc"}}, {MakeSpan(), MakeSpan()});
+
+  EXPECT_EQ(data[0], '\x0a');  // resource_spans
+  EXPECT_TRUE(Contains(data, "\x0a\x10"s + std::string(16, '\x11')));
+  EXPECT_TRUE(Contains(data, "\x12\x08"s + std::string(8, '\x22')));
+  EXPECT_TRUE(Contains(data, "\x22\x08"s + std::string(8, '\x33')));
+  EXPECT_TRUE(Contains(data, "\x2a\x02op"s));
+  // start time in nanoseconds, fixed64
+  EXPECT_TRUE(Contains(data, "\x39\x00\xca\x9a\x3b\x00\x00\x00\x00"s));
+  // KeyValue{key: "k", value: AnyValue{string_value: "v"}}
+  EXPECT_TRUE(Contains(data, "\x4a\x08\x0a\x01k\x12\x03\x0a\x01v"s));
+  // KeyValue{key: "i", value: AnyValue{int_value: 150}}
+  EXPECT_TRUE(Contains(data, "\x4a\x08\x0a\x01i\x12\x03\x18\x96\x01"s));
+  // Status{code: STATUS_CODE_ERROR}
+  EXPECT_TRUE(Contains(data, "\x7a\x02\x18\x02"s));
+  EXPECT_TRUE(Contains(data, "service.name"));
+  EXPECT_TRUE(Contains(data, "svc"));
+}
+
+TEST(OtlpEncoder, Metrics) {
+  utils::statistics::Storage storage;
+  auto holder = storage.RegisterWriter(
+      "test", [](utils::statistics::Writer& writer) {
+        writer["gauge"] = 42;
+        writer["rate"] = utils::statistics::Rate{7};
+      });
+
+  const auto data = tracing::otlp::EncodeMetrics(
+      {{"service.name", "svc"}}, storage, {}, std::chrono::system_clock::now());
+
+  EXPECT_EQ(data[0], '\x0a');  // resource_metrics
+  EXPECT_TRUE(Contains(data, "test.gauge"));
+  EXPECT_TRUE(Contains(data, "test.rate"));
+  // NumberDataPoint.as_int: 42, sfixed64
+  EXPECT_TRUE(Contains(data, "\x31\x2a\x00\x00\x00\x00\x00\x00\x00"s));
+  // Sum{aggregation_temporality: CUMULATIVE, is_monotonic: true}
+  EXPECT_TRUE(Contains(data, "\x10\x02\x18\x01"s));
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,207 @@
+#include <tracing/otlp/exporter.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/engine/task/task_base.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/tracing/span.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+namespace {
+
+constexpr std::string_view kTracesPath = "/v1/traces";
+constexpr std::string_view kMetricsPath = "/v1/metrics";
+constexpr std::string_view kContentType = "application/x-protobuf";
+
+}  // namespace
+
+QueueOverflowBehavior QueueOverflowBehaviorFromString(std::string_view value) {
+  if (value == "discard-new") return QueueOverflowBehavior::kDiscardNew;
+  if (value == "discard-old") return QueueOverflowBehavior::kDiscardOld;
+  throw std::runtime_error("Unknown queue overflow behavior '" +
+                           std::string{value} +
+                           "', expected 'discard-new' or 'discard-old'");
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExporterStatistics& stats) {
+  if (auto spans = writer["spans"]) {
+    spans["exported"] = stats.exported_spans;
+    spans["dropped"] = stats.dropped_spans;
+    spans["batches"] = stats.sent_batches;
+    spans["send-errors"] = stats.send_errors;
+  }
+  if (auto metrics = writer["metrics"]) {
+    metrics["batches"] = stats.exported_metrics_batches;
+    metrics["send-errors"] = stats.metrics_send_errors;
+  }
+}
+
+Exporter::Exporter(ExporterSettings settings,
+                   clients::http::Client& http_client,
+                   const utils::statistics::Storage* metrics_storage)
+    : settings_(std::move(settings)),
+      http_client_(http_client),
+      metrics_storage_(metrics_storage),
+      start_time_(std::chrono::system_clock::now()) {
+  UINVARIANT(settings_.max_batch_size > 0, "max_batch_size must be positive");
+  UINVARIANT(!settings_.metrics_interval || metrics_storage_,
+             "Metrics export requires the statistics storage");
+}
+
+Exporter::~Exporter() { Stop(); }
+
+void Exporter::Start() {
+  // The spans of the exporter itself are not logged and not exported
+  flush_task_.Start("otlp-exporter-flush",
+                    {settings_.flush_interval, {}, logging::Level::kNone},
+                    [this] { Flush(); });
+  if (settings_.metrics_interval) {
+    metrics_task_.Start("otlp-exporter-metrics",
+                        {*settings_.metrics_interval, {},
+                         logging::Level::kNone},
+                        [this] { ExportMetrics(); });
+  }
+}
+
+void Exporter::Stop() noexcept {
+  metrics_task_.Stop();
+  if (!flush_task_.IsRunning()) return;
+  flush_task_.Stop();
+
+  try {
+    Flush();
+  } catch (const std::exception& e) {
+    LOG_ERROR() << "Failed to send the remaining spans: " << e;
+  }
+}
+
+void Exporter::Consume(impl::FinishedSpan&& span) noexcept {
+  bool should_flush = false;
+  {
+    const std::lock_guard lock(mutex_);
+    if (queue_.size() >= settings_.max_queue_size) {
+      ++stats_.dropped_spans;
+      if (settings_.queue_overflow_behavior ==
+              QueueOverflowBehavior::kDiscardNew ||
+          queue_.empty()) {
+        return;
+      }
+      queue_.pop_front();
+    }
+    queue_.push_back(std::move(span));
+    should_flush = queue_.size() >= settings_.max_batch_size;
+  }
+
+  // ForceStepAsync requires a coroutine environment, spans from other threads
+  // wait for the next periodic flush
+  if (should_flush && !flush_requested_.exchange(true) &&
+      engine::current_task::IsTaskProcessorThread() &&
+      flush_task_.IsRunning()) {
+    flush_task_.ForceStepAsync();
+  }
+}
+
+void Exporter::Flush() {
+  flush_requested_ = false;
+
+  std::optional<std::string> error;
+  std::size_t errors = 0;
+  {
+    // Logs of this span are suppressed, the errors are logged afterwards
+    tracing::Span span{"otlp-export-spans"};
+    span.SetLocalLogLevel(logging::Level::kNone);
+
+    for (auto batch = TakeBatch(); !batch.empty(); batch = TakeBatch()) {
+      const utils::statistics::Rate size{batch.size()};
+      auto send_error =
+          Send(kTracesPath, EncodeTraces(settings_.resource, batch));
+      if (!send_error) {
+        stats_.exported_spans += size;
+        ++stats_.sent_batches;
+      } else {
+        stats_.dropped_spans += size;
+        ++stats_.send_errors;
+        ++errors;
+        error = std::move(send_error);
+      }
+    }
+  }
+
+  if (error) {
+    LOG_LIMITED_WARNING() << "Failed to send " << errors
+                          << " batch(es) of spans to " << settings_.endpoint
+                          << ": " << *error;
+  }
+}
+
+void Exporter::ExportMetrics() {
+  UASSERT(metrics_storage_);
+
+  std::optional<std::string> error;
+  {
+    tracing::Span span{"otlp-export-metrics"};
+    span.SetLocalLogLevel(logging::Level::kNone);
+
+    auto body = EncodeMetrics(settings_.resource, *metrics_storage_,
+                              start_time_, std::chrono::system_clock::now());
+    error = Send(kMetricsPath, std::move(body));
+  }
+
+  if (!error) {
+    ++stats_.exported_metrics_batches;
+  } else {
+    ++stats_.metrics_send_errors;
+    LOG_LIMITED_WARNING() << "Failed to send metrics to " << settings_.endpoint
+                          << ": " << *error;
+  }
+}
+
+std::size_t Exporter::GetQueueSize() const {
+  const std::lock_guard lock(mutex_);
+  return queue_.size();
+}
+
+std::vector<impl::FinishedSpan> Exporter::TakeBatch() {
+  std::vector<impl::FinishedSpan> batch;
+  const std::lock_guard lock(mutex_);
+  const auto size = std::min(queue_.size(), settings_.max_batch_size);
+  batch.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    batch.push_back(std::move(queue_.front()));
+    queue_.pop_front();
+  }
+  return batch;
+}
+
+std::optional<std::string> Exporter::Send(std::string_view path,
+                                          std::string&& body) {
+  try {
+    auto request = http_client_.CreateRequest();
+    request.post(settings_.endpoint + std::string{path}, std::move(body))
+        .headers({{http::headers::kContentType, std::string{kContentType}}})
+        .timeout(settings_.timeout);
+    if (!settings_.unix_socket_path.empty()) {
+      request.unix_socket_path(settings_.unix_socket_path);
+    }
+    request.perform()->raise_for_status();
+    return std::nullopt;
+  } catch (const std::exception& e) {
+    return std::string{e.what()};
+  }
+}
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/clients/http/client.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <tracing/otlp/encoder.hpp>
+#include <tracing/span_sink.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+enum class QueueOverflowBehavior {
+  kDiscardNew,
+  kDiscardOld,
+};
+
+QueueOverflowBehavior QueueOverflowBehaviorFromString(std::string_view value);
+
+struct ExporterSettings final {
+  // Base URL of the OTLP/HTTP receiver, e.g. 'http://localhost:4318'
+  std::string endpoint;
+  // If not empty, the receiver is connected to via this Unix socket
+  std::string unix_socket_path;
+  ResourceAttributes resource;
+
+  std::size_t max_queue_size{65536};
+  QueueOverflowBehavior queue_overflow_behavior{
+      QueueOverflowBehavior::kDiscardNew};
+  std::size_t max_batch_size{512};
+  std::chrono::milliseconds flush_interval{1000};
+  std::chrono::milliseconds timeout{1000};
+
+  // Metrics are exported only if set
+  std::optional<std::chrono::milliseconds> metrics_interval;
+};
+
+struct ExporterStatistics final {
+  utils::statistics::RateCounter exported_spans;
+  utils::statistics::RateCounter dropped_spans;
+  utils::statistics::RateCounter sent_batches;
+  utils::statistics::RateCounter send_errors;
+  utils::statistics::RateCounter exported_metrics_batches;
+  utils::statistics::RateCounter metrics_send_errors;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ExporterStatistics& stats);
+
+// Queues the finished spans and sends them in batches to an OTLP/HTTP
+// receiver using the binary protobuf encoding
+class Exporter final : public impl::SpanSink {
+ public:
+  // `metrics_storage` is required if the metrics export is enabled
+  Exporter(ExporterSettings settings, clients::http::Client& http_client,
+           const utils::statistics::Storage* metrics_storage);
+
+  ~Exporter() override;
+
+  // Starts the periodic flushes
+  void Start();
+
+  // Stops the periodic flushes and sends the queued spans
+  void Stop() noexcept;
+
+  void Consume(impl::FinishedSpan&& span) noexcept override;
+
+  // Sends all the queued spans
+  void Flush();
+
+  void ExportMetrics();
+
+  std::size_t GetQueueSize() const;
+
+  const ExporterStatistics& GetStatistics() const noexcept { return stats_; }
+
+ private:
+  std::vector<impl::FinishedSpan> TakeBatch();
+
+  // Returns the error message on failure
+  std::optional<std::string> Send(std::string_view path, std::string&& body);
+
+  const ExporterSettings settings_;
+  clients::http::Client& http_client_;
+  const utils::statistics::Storage* const metrics_storage_;
+  const std::chrono::system_clock::time_point start_time_;
+
+  mutable std::mutex mutex_;
+  std::deque<impl::FinishedSpan> queue_;
+  std::atomic<bool> flush_requested_{false};
+
+  ExporterStatistics stats_;
+
+  utils::PeriodicTask flush_task_;
+  utils::PeriodicTask metrics_task_;
+};
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
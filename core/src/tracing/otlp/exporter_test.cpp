@@ -0,0 +1,174 @@
+#include <tracing/otlp/exporter.hpp>
+
+#include <string>
+#include <vector>
+
+#include <userver/engine/mutex.hpp>
+#include <userver/http/common_headers.hpp>
+#include <userver/utest/http_client.hpp>
+#include <userver/utest/http_server_mock.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class OtlpReceiverMock final {
+ public:
+  explicit OtlpReceiverMock(int response_status = 200)
+      : server_([this, response_status](const auto& request) {
+          return Handle(request, response_status);
+        }) {}
+
+  std::string GetBaseUrl() const { return server_.GetBaseUrl(); }
+
+  std::vector<utest::HttpServerMock::HttpRequest> GetRequests() {
+    const std::lock_guard lock(mutex_);
+    return requests_;
+  }
+
+ private:
+  utest::HttpServerMock::HttpResponse Handle(
+      const utest::HttpServerMock::HttpRequest& request, int response_status) {
+    const std::lock_guard lock(mutex_);
+    requests_.push_back(request);
+    return {response_status, {}, {}};
+  }
+
+  engine::Mutex mutex_;
+  std::vector<utest::HttpServerMock::HttpRequest> requests_;
+  utest::HttpServerMock server_;
+};
+
+tracing::impl::FinishedSpan MakeSpan(std::string name) {
+  tracing::impl::FinishedSpan span;
+  span.trace_id.fill(1);
+  span.span_id.fill(2);
+  span.name = std::move(name);
+  span.start_time = std::chrono::system_clock::now();
+  span.end_time = span.start_time;
+  return span;
+}
+
+tracing::otlp::ExporterSettings MakeSettings(const OtlpReceiverMock& receiver) {
+  tracing::otlp::ExporterSettings settings;
+  settings.endpoint = receiver.GetBaseUrl();
+  settings.resource = {{"service.name", "exporter-test"}};
+  settings.timeout = utest::kMaxTestWaitTime;
+  return settings;
+}
+
+bool Contains(const std::string& data, std::string_view part) {
+  return data.find(part) != std::string::npos;
+}
+
+}  // namespace
+
+UTEST(OtlpExporter, SendsBatches) {
+  OtlpReceiverMock receiver;
+  auto settings = MakeSettings(receiver);
+  settings.max_batch_size = 2;
+  const auto http_client = utest::CreateHttpClient();
+  tracing::otlp::Exporter exporter{settings, *http_client, nullptr};
+
+  exporter.Consume(MakeSpan("first_span"));
+  exporter.Consume(MakeSpan("second_span"));
+  exporter.Consume(MakeSpan("third_span"));
+  EXPECT_EQ(exporter.GetQueueSize(), 3);
+  exporter.Flush();
+  EXPECT_EQ(exporter.GetQueueSize(), 0);
+
+  const auto requests = receiver.GetRequests();
+  ASSERT_EQ(requests.size(), 2);
+  for (const auto& request : requests) {
+    EXPECT_EQ(request.method, clients::http::HttpMethod::kPost);
+    EXPECT_EQ(request.path, "/v1/traces");
+    EXPECT_EQ(request.headers.at(http::headers::kContentType),
+              "application/x-protobuf");
+    EXPECT_TRUE(Contains(request.body, "exporter-test"));
+  }
+  EXPECT_TRUE(Contains(requests[0].body, "first_span"));
+  EXPECT_TRUE(Contains(requests[0].body, "second_span"));
+  EXPECT_TRUE(Contains(requests[1].body, "third_span"));
+
+  const auto& stats = exporter.GetStatistics();
+  EXPECT_EQ(stats.exported_spans.Load().value, 3);
+  EXPECT_EQ(stats.sent_batches.Load().value, 2);
+  EXPECT_EQ(stats.dropped_spans.Load().value, 0);
+}
+
+UTEST(OtlpExporter, QueueOverflow) {
+  OtlpReceiverMock receiver;
+  auto settings = MakeSettings(receiver);
+  settings.max_queue_size = 2;
+  const auto http_client = utest::CreateHttpClient();
+
+  settings.queue_overflow_behavior =
+      tracing::otlp::QueueOverflowBehavior::kDiscardNew;
+  tracing::otlp::Exporter discard_new{settings, *http_client, nullptr};
+  discard_new.Consume(MakeSpan("span_a"));
+  discard_new.Consume(MakeSpan("span_b"));
+  discard_new.Consume(MakeSpan("span_c"));
+  EXPECT_EQ(discard_new.GetQueueSize(), 2);
+  EXPECT_EQ(discard_new.GetStatistics().dropped_spans.Load().value, 1);
+  discard_new.Flush();
+
+  settings.queue_overflow_behavior =
+      tracing::otlp::QueueOverflowBehavior::kDiscardOld;
+  tracing::otlp::Exporter discard_old{settings, *http_client, nullptr};
+  discard_old.Consume(MakeSpan("span_d"));
+  discard_old.Consume(MakeSpan("span_e"));
+  discard_old.Consume(MakeSpan("span_f"));
+  EXPECT_EQ(discard_old.GetQueueSize(), 2);
+  EXPECT_EQ(discard_old.GetStatistics().dropped_spans.Load().value, 1);
+  discard_old.Flush();
+
+  const auto requests = receiver.GetRequests();
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_TRUE(Contains(requests[0].body, "span_a"));
+  EXPECT_TRUE(Contains(requests[0].body, "span_b"));
+  EXPECT_FALSE(Contains(requests[0].body, "span_c"));
+  EXPECT_FALSE(Contains(requests[1].body, "span_d"));
+  EXPECT_TRUE(Contains(requests[1].body, "span_e"));
+  EXPECT_TRUE(Contains(requests[1].body, "span_f"));
+}
+
+UTEST(OtlpExporter, SendError) {
+  OtlpReceiverMock receiver{503};
+  const auto http_client = utest::CreateHttpClient();
+  tracing::otlp::Exporter exporter{MakeSettings(receiver), *http_client,
+                                   nullptr};
+
+  exporter.Consume(MakeSpan("failed_span"));
+  UEXPECT_NO_THROW(exporter.Flush());
+
+  EXPECT_EQ(receiver.GetRequests().size(), 1);
+  const auto& stats = exporter.GetStatistics();
+  EXPECT_EQ(stats.send_errors.Load().value, 1);
+  EXPECT_EQ(stats.dropped_spans.Load().value, 1);
+  EXPECT_EQ(stats.exported_spans.Load().value, 0);
+}
+
+UTEST(OtlpExporter, Metrics) {
+  OtlpReceiverMock receiver;
+  auto settings = MakeSettings(receiver);
+  settings.metrics_interval = std::chrono::seconds{1};
+  const auto http_client = utest::CreateHttpClient();
+
+  utils::statistics::Storage storage;
+  const auto holder = storage.RegisterWriter(
+      "test-metric", [](utils::statistics::Writer& writer) { writer = 42; });
+  tracing::otlp::Exporter exporter{settings, *http_client, &storage};
+
+  exporter.ExportMetrics();
+
+  const auto requests = receiver.GetRequests();
+  ASSERT_EQ(requests.size(), 1);
+  EXPECT_EQ(requests[0].path, "/v1/metrics");
+  EXPECT_TRUE(Contains(requests[0].body, "test-metric"));
+  EXPECT_EQ(exporter.GetStatistics().exported_metrics_batches.Load().value, 1);
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::otlp {
+
+// Minimal writer of the protobuf wire format, enough for the OTLP messages
+class ProtobufWriter final {
+ public:
+  explicit ProtobufWriter(std::string& out) noexcept : out_(out) {}
+
+  void WriteVarint(int field, std::uint64_t value) {
+    WriteTag(field, kWireVarint);
+    AppendVarint(value);
+  }
+
+  void WriteBool(int field, bool value) { WriteVarint(field, value ? 1 : 0); }
+
+  void WriteFixed64(int field, std::uint64_t value) {
+    WriteTag(field, kWireFixed64);
+    AppendFixed64(value);
+  }
+
+  void WriteSignedFixed64(int field, std::int64_t value) {
+    WriteFixed64(field, static_cast<std::uint64_t>(value));
+  }
+
+  void WriteDouble(int field, double value) {
+    static_assert(sizeof(double) == sizeof(std::uint64_t));
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteFixed64(field, bits);
+  }
+
+  void WriteBytes(int field, std::string_view value) {
+    WriteTag(field, kWireLengthDelimited);
+    AppendVarint(value.size());
+    out_.append(value);
+  }
+
+  void WriteBytes(int field, const void* data, std::size_t size) {
+    WriteBytes(field, std::string_view{static_cast<const char*>(data), size});
+  }
+
+  // Writes a nested message, `func` receives a writer of the message fields.
+  // The length is not known beforehand, so the space for the longest length
+  // varint is reserved and the unused part of it is erased afterwards.
+  template <typename Func>
+  void WriteMessage(int field, Func&& func) {
+    WriteTag(field, kWireLengthDelimited);
+    const auto length_pos = out_.size();
+    out_.append(kMaxLengthSize, '\0');
+
+    func(*this);
+
+    const auto length = out_.size() - length_pos - kMaxLengthSize;
+    UINVARIANT(length <= UINT32_MAX, "Too big protobuf message");
+
+    char buffer[kMaxLengthSize];
+    const auto length_size = EncodeVarint(length, buffer);
+    std::memcpy(out_.data() + length_pos, buffer, length_size);
+    out_.erase(length_pos + length_size, kMaxLengthSize - length_size);
+  }
+
+ private:
+  static constexpr int kWireVarint = 0;
+  static constexpr int kWireFixed64 = 1;
+  static constexpr int kWireLengthDelimited = 2;
+  static constexpr std::size_t kMaxLengthSize = 5;
+  static constexpr std::size_t kMaxVarintSize = 10;
+
+  static std::size_t EncodeVarint(std::uint64_t value, char* out) noexcept {
+    std::size_t size = 0;
+    while (value >= 0x80) {
+      out[size++] = static_cast<char>((value & 0x7f) | 0x80);
+      value >>= 7;
+    }
+    out[size++] = static_cast<char>(value);
+    return size;
+  }
+
+  void WriteTag(int field, int wire_type) {
+    UASSERT(field > 0);
+    AppendVarint((static_cast<std::uint64_t>(field) << 3) | wire_type);
+  }
+
+  void AppendVarint(std::uint64_t value) {
+    char buffer[kMaxVarintSize];
+    out_.append(buffer, EncodeVarint(value, buffer));
+  }
+
+  void AppendFixed64(std::uint64_t value) {
+    char buffer[sizeof(value)];
+    for (auto& c : buffer) {
+      c = static_cast<char>(value & 0xff);
+      value >>= 8;
+    }
+    out_.append(buffer, sizeof(buffer));
+  }
+
+  std::string& out_;
+};
+
+}  // namespace tracing::otlp
+
+USERVER_NAMESPACE_END
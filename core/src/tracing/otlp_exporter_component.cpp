@@ -0,0 +1,165 @@
+#include <userver/tracing/otlp_exporter_component.hpp>
+
+#include <map>
+
+#include <userver/clients/http/component.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/statistics_storage.hpp>
+#include <userver/formats/parse/common_containers.hpp>
+#include <userver/tracing/component.hpp>
+#include <userver/tracing/tracer.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/merge_schemas.hpp>
+
+#include <tracing/otlp/exporter.hpp>
+#include <tracing/span_sink.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace components {
+
+namespace {
+
+tracing::otlp::ExporterSettings ParseSettings(const ComponentConfig& config) {
+  tracing::otlp::ExporterSettings settings;
+  settings.endpoint =
+      config["endpoint"].As<std::string>("http://localhost:4318");
+  while (!settings.endpoint.empty() && settings.endpoint.back() == '/') {
+    settings.endpoint.pop_back();
+  }
+  settings.unix_socket_path = config["unix-socket-path"].As<std::string>({});
+
+  auto service_name = config["service-name"].As<std::string>(
+      tracing::Tracer::GetTracer()->GetServiceName());
+  settings.resource.emplace_back("service.name", std::move(service_name));
+  for (auto& [key, value] :
+       config["resource-attributes"].As<std::map<std::string, std::string>>(
+           {})) {
+    settings.resource.emplace_back(key, std::move(value));
+  }
+
+  settings.max_queue_size =
+      config["max-queue-size"].As<std::size_t>(settings.max_queue_size);
+  settings.queue_overflow_behavior =
+      tracing::otlp::QueueOverflowBehaviorFromString(
+          config["queue-overflow-behavior"].As<std::string>("discard-new"));
+  settings.max_batch_size =
+      config["max-batch-size"].As<std::size_t>(settings.max_batch_size);
+  settings.flush_interval =
+      config["flush-interval"].As<std::chrono::milliseconds>(
+          settings.flush_interval);
+  settings.timeout =
+      config["timeout"].As<std::chrono::milliseconds>(settings.timeout);
+  if (config["metrics"].As<bool>(false)) {
+    settings.metrics_interval =
+        config["metrics-interval"].As<std::chrono::milliseconds>(
+            std::chrono::seconds{15});
+  }
+  return settings;
+}
+
+}  // namespace
+
+OtlpExporter::OtlpExporter(const ComponentConfig& config,
+                           const ComponentContext& context)
+    : LoggableComponentBase(config, context) {
+  // Tracer sets up the service name
+  context.FindComponent<Tracer>();
+  auto& http_client =
+      context
+          .FindComponent<HttpClient>(
+              config["http-client"].As<std::string>(HttpClient::kName))
+          .GetHttpClient();
+  auto& statistics_storage =
+      context.FindComponent<StatisticsStorage>().GetStorage();
+
+  exporter_ = std::make_shared<tracing::otlp::Exporter>(
+      ParseSettings(config), http_client, &statistics_storage);
+  exporter_->Start();
+  tracing::impl::SetSpanSink(exporter_, config["log-spans"].As<bool>(true));
+
+  statistics_holder_ = statistics_storage.RegisterWriter(
+      std::string{kName}, [this](utils::statistics::Writer& writer) {
+        writer = exporter_->GetStatistics();
+        writer["queue-size"] = exporter_->GetQueueSize();
+      });
+}
+
+OtlpExporter::~OtlpExporter() {
+  statistics_holder_.Unregister();
+  tracing::impl::SetSpanSink(nullptr, true);
+  exporter_->Stop();
+}
+
+yaml_config::Schema OtlpExporter::GetStaticConfigSchema() {
+  return yaml_config::MergeSchemas<LoggableComponentBase>(R"(
+type: object
+description: Component that exports spans and metrics in OTLP format
+additionalProperties: false
+properties:
+    endpoint:
+        type: string
+        description: base URL of the OTLP/HTTP receiver
+        defaultDescription: http://localhost:4318
+    unix-socket-path:
+        type: string
+        description: connect to the receiver via this Unix socket
+        defaultDescription: <TCP is used>
+    http-client:
+        type: string
+        description: name of the HTTP client component to send the data with
+        defaultDescription: http-client
+    service-name:
+        type: string
+        description: "'service.name' resource attribute"
+        defaultDescription: service name of the tracer component
+    resource-attributes:
+        type: object
+        description: extra string attributes of the resource
+        properties: {}
+        additionalProperties:
+            type: string
+            description: attribute value
+    max-queue-size:
+        type: integer
+        description: max count of spans waiting to be sent
+        defaultDescription: 65536
+        minimum: 1
+    queue-overflow-behavior:
+        type: string
+        description: which spans to drop if the queue is full
+        defaultDescription: discard-new
+        enum:
+          - discard-new
+          - discard-old
+    max-batch-size:
+        type: integer
+        description: max count of spans in a single request
+        defaultDescription: 512
+        minimum: 1
+    flush-interval:
+        type: string
+        description: how often to send the queued spans
+        defaultDescription: 1s
+    timeout:
+        type: string
+        description: timeout of a request to the receiver
+        defaultDescription: 1s
+    log-spans:
+        type: boolean
+        description: whether to also write the exported spans to the logs
+        defaultDescription: true
+    metrics:
+        type: boolean
+        description: whether to export the utils::statistics metrics
+        defaultDescription: false
+    metrics-interval:
+        type: string
+        description: how often to export the metrics
+        defaultDescription: 15s
+)");
+}
+
+}  // namespace components
+
+USERVER_NAMESPACE_END
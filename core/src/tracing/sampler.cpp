@@ -0,0 +1,192 @@
+#include <tracing/sampler.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <userver/logging/impl/logger_base.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/token_bucket.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+#include <tracing/span_impl.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing {
+
+SamplingSettings Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<SamplingSettings>) {
+  SamplingSettings result;
+  result.probability = value["probability"].As<double>(result.probability);
+  result.max_traces_per_second =
+      value["max-traces-per-second"].As<std::optional<std::size_t>>();
+  result.tail_sampling = value["tail-sampling"].As<bool>(result.tail_sampling);
+  result.tail_slow_threshold =
+      value["tail-slow-threshold"].As<std::chrono::milliseconds>(
+          result.tail_slow_threshold);
+  result.tail_max_buffered_spans = value["tail-max-buffered-spans"].As<
+      std::size_t>(result.tail_max_buffered_spans);
+
+  if (result.probability < 0.0 || result.probability > 1.0) {
+    throw std::runtime_error(
+        "Sampling probability must be in range [0, 1], got " +
+        std::to_string(result.probability));
+  }
+  if (result.max_traces_per_second == 0) {
+    throw std::runtime_error("'max-traces-per-second' must be positive");
+  }
+  return result;
+}
+
+namespace impl {
+
+namespace {
+
+struct Sampler final {
+  SamplingSettings settings;
+  // Set if max_traces_per_second is set
+  std::unique_ptr<utils::TokenBucket> traces_bucket;
+};
+
+rcu::Variable<Sampler>& GlobalSampler() {
+  static rcu::Variable<Sampler> sampler;
+  return sampler;
+}
+
+Sampling MakeNotSampled(const SamplingSettings& settings) {
+  if (!settings.tail_sampling) return {SamplingDecision::kNotSampled, {}};
+
+  return {SamplingDecision::kDeferred,
+          std::make_shared<TailSamplingBuffer>(
+              settings.tail_slow_threshold, settings.tail_max_buffered_spans)};
+}
+
+}  // namespace
+
+void SetSamplingSettings(const SamplingSettings& settings) {
+  Sampler sampler{settings, nullptr};
+  if (settings.max_traces_per_second) {
+    const auto rate = *settings.max_traces_per_second;
+    UINVARIANT(rate > 0, "max_traces_per_second must be positive");
+    sampler.traces_bucket = std::make_unique<utils::TokenBucket>(
+        rate, utils::TokenBucket::RefillPolicy{
+                  1, utils::TokenBucket::Duration{std::chrono::seconds{1}} /
+                         rate});
+  }
+  GlobalSampler().Assign(std::move(sampler));
+}
+
+Sampling SampleNewTrace() {
+  const auto sampler = GlobalSampler().Read();
+  const auto& settings = sampler->settings;
+
+  if (settings.probability < 1.0 &&
+      !(utils::RandRange(1.0) < settings.probability)) {
+    return MakeNotSampled(settings);
+  }
+  if (sampler->traces_bucket && !sampler->traces_bucket->Obtain()) {
+    return MakeNotSampled(settings);
+  }
+  return {SamplingDecision::kSampled, {}};
+}
+
+Sampling SampleIncomingTrace(bool sampled) {
+  if (sampled) return {SamplingDecision::kSampled, {}};
+  const auto sampler = GlobalSampler().Read();
+  return MakeNotSampled(sampler->settings);
+}
+
+TailSamplingBuffer::TailSamplingBuffer(
+    std::chrono::steady_clock::duration slow_threshold, std::size_t max_spans)
+    : slow_threshold_(slow_threshold), max_spans_(max_spans) {}
+
+TailSamplingBuffer::~TailSamplingBuffer() = default;
+
+bool TailSamplingBuffer::TryBuffer(Span::Impl& span) {
+  const bool has_error = span.HasErrorTag();
+
+  {
+    const std::lock_guard lock(mutex_);
+    switch (state_) {
+      case State::kLogged:
+        return false;
+      case State::kDropped:
+        return true;
+      case State::kPending:
+        break;
+    }
+
+    has_error_ = has_error_ || has_error;
+    if (spans_.size() >= max_spans_) return true;
+  }
+
+  // Rendering takes a while, the root may finish meanwhile
+  UASSERT_MSG(!span.tail_buffer_, "the buffer must not own itself");
+  auto buffered = std::move(span).MakeBufferedSpan();
+
+  {
+    const std::lock_guard lock(mutex_);
+    switch (state_) {
+      case State::kLogged:
+        break;
+      case State::kDropped:
+        return true;
+      case State::kPending:
+        if (spans_.size() < max_spans_) {
+          spans_.push_back(std::move(buffered));
+        }
+        return true;
+    }
+  }
+
+  Log(std::move(buffered));
+  return true;
+}
+
+bool TailSamplingBuffer::Complete(const Span::Impl& root) {
+  const bool is_slow =
+      std::chrono::steady_clock::now() - root.start_steady_time_ >=
+      slow_threshold_;
+  const bool has_error = root.HasErrorTag();
+
+  bool should_log = false;
+  std::vector<BufferedSpan> spans;
+  {
+    const std::lock_guard lock(mutex_);
+    UASSERT(state_ == State::kPending);
+    should_log = is_slow || has_error || has_error_;
+    state_ = should_log ? State::kLogged : State::kDropped;
+    spans = std::move(spans_);
+  }
+
+  if (!should_log) return false;
+
+  for (auto& span : spans) Log(std::move(span));
+  return true;
+}
+
+void TailSamplingBuffer::Log(BufferedSpan&& span) noexcept {
+  if (span.sink_span && !ConsumeBySpanSink(std::move(*span.sink_span))) {
+    return;
+  }
+
+  try {
+    logging::GetDefaultLogger().Log(span.level, span.log_record);
+    if (span.opentracing_logger) {
+      span.opentracing_logger->Log(span.level, span.opentracing_record);
+    }
+  } catch (const std::exception& ex) {
+    UASSERT_MSG(false, ex.what());
+  }
+}
+
+}  // namespace impl
+
+}  // namespace tracing
+
+USERVER_NAMESPACE_END
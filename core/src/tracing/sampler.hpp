@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/logging/fwd.hpp>
+#include <userver/logging/level.hpp>
+#include <userver/tracing/sampling.hpp>
+#include <userver/tracing/span.hpp>
+
+#include <tracing/span_sink.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+enum class SamplingDecision : std::uint8_t {
+  kSampled,
+  kNotSampled,
+  // Not sampled, the spans are buffered until the trace turns out to be slow
+  // or failed
+  kDeferred,
+};
+
+class TailSamplingBuffer;
+
+struct Sampling final {
+  SamplingDecision decision{SamplingDecision::kSampled};
+  std::shared_ptr<TailSamplingBuffer> tail_buffer;
+};
+
+void SetSamplingSettings(const SamplingSettings& settings);
+
+// Head sampling decision for a new trace
+Sampling SampleNewTrace();
+
+// Decision for a trace that was (not) sampled by the caller
+Sampling SampleIncomingTrace(bool sampled);
+
+// A finished span of a deferred trace, rendered as it would have been logged
+struct BufferedSpan final {
+  logging::Level level{logging::Level::kInfo};
+  // Set if there was a span sink when the span finished
+  std::optional<FinishedSpan> sink_span;
+  std::string log_record;
+  // Set if the tracer has an opentracing logger
+  logging::LoggerPtr opentracing_logger;
+  std::string opentracing_record;
+};
+
+// Collects the finished spans of a deferred trace until the root span of the
+// trace in this process finishes
+class TailSamplingBuffer final {
+ public:
+  TailSamplingBuffer(std::chrono::steady_clock::duration slow_threshold,
+                     std::size_t max_spans);
+
+  ~TailSamplingBuffer();
+
+  // Takes the finished span, returns false if the span should be logged
+  // right away because the trace is already known to be logged. A buffered
+  // span is rendered into a BufferedSpan, `span` must not be logged after that.
+  bool TryBuffer(Span::Impl& span);
+
+  // Decides on the trace once its root span finishes, logs the buffered spans
+  // if the trace is slow or failed. Returns whether the root should be logged.
+  bool Complete(const Span::Impl& root);
+
+ private:
+  enum class State : std::uint8_t { kPending, kLogged, kDropped };
+
+  static void Log(BufferedSpan&& span) noexcept;
+
+  const std::chrono::steady_clock::duration slow_threshold_;
+  const std::size_t max_spans_;
+
+  std::mutex mutex_;
+  State state_{State::kPending};
+  bool has_error_{false};
+  std::vector<BufferedSpan> spans_;
+};
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
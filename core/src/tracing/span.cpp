@@ -1,21 +1,28 @@
 #include <tracing/span_impl.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <type_traits>
+#include <variant>
 
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
 #include <fmt/compile.h>
 #include <fmt/format.h>
 
 #include <engine/task/task_context.hpp>
 #include <logging/log_helper_impl.hpp>
+#include <tracing/span_sink.hpp>
+#include <userver/compiler/thread_local.hpp>
 #include <userver/engine/task/local_variable.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/assert.hpp>
-#include <userver/utils/encoding/hex.hpp>
+#include <userver/utils/boost_uuid4.hpp>
 #include <userver/utils/rand.hpp>
-#include <userver/utils/uuid4.hpp>
 #include <utils/internal_tag.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -62,14 +69,65 @@ TsBuffer StartTsToString(std::chrono::system_clock::time_point start) {
 // Maintain coro-local span stack to identify "current span" in O(1).
 engine::TaskLocalVariable<SpanStack> task_local_spans;
 
-std::string GenerateSpanId() {
+impl::SpanId GenerateSpanId() {
   std::uniform_int_distribution<std::uint64_t> dist;
   const auto random_value = utils::WithDefaultRandom(dist);
 
-  static_assert(sizeof(random_value) == 8);
-  return utils::encoding::ToHex(&random_value, 8);
+  impl::SpanId::Bytes bytes;
+  static_assert(sizeof(random_value) == sizeof(bytes));
+  std::memcpy(bytes.data(), &random_value, sizeof(bytes));
+  return impl::SpanId{bytes};
 }
 
+// Same as the hex of utils::generators::GenerateUuid
+impl::TraceId GenerateUuidId() {
+  const auto uuid = utils::generators::GenerateBoostUuid();
+
+  impl::TraceId::Bytes bytes;
+  static_assert(boost::uuids::uuid::static_size() == bytes.size());
+  std::copy(uuid.begin(), uuid.end(), bytes.begin());
+  return impl::TraceId{bytes};
+}
+
+// Up to this count of Span::Impl storages is kept by each thread
+constexpr std::size_t kMaxPooledImpls = 64;
+
+struct ImplStoragePool final {
+  ImplStoragePool() = default;
+  ImplStoragePool(ImplStoragePool&&) = default;
+
+  ~ImplStoragePool() {
+    for (void* storage : storages) ::operator delete(storage);
+  }
+
+  boost::container::static_vector<void*, kMaxPooledImpls> storages;
+};
+
+compiler::ThreadLocal local_impl_pool = [] { return ImplStoragePool{}; };
+
+// Keeps the record formatted for `target` instead of writing it
+class RecordingLogger final : public logging::impl::LoggerBase {
+ public:
+  explicit RecordingLogger(logging::impl::LoggerBase& target)
+      : LoggerBase(target.GetFormat()), target_(target) {
+    SetLevel(logging::Level::kTrace);
+  }
+
+  void Log(logging::Level, std::string_view msg) override {
+    record_.assign(msg);
+  }
+
+  void PrependCommonTags(logging::impl::TagWriter writer) const override {
+    target_.PrependCommonTags(writer);
+  }
+
+  std::string ExtractRecord() && { return std::move(record_); }
+
+ private:
+  logging::impl::LoggerBase& target_;
+  std::string record_;
+};
+
 }  // namespace
 
 Span::Impl::Impl(std::string name, ReferenceType reference_type,
@@ -80,15 +138,15 @@ Span::Impl::Impl(std::string name, ReferenceType reference_type,
 
 Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
                  ReferenceType reference_type, logging::Level log_level,
-                 utils::impl::SourceLocation source_location)
+                 utils::impl::SourceLocation source_location,
+                 bool defer_root_sampling)
     : name_(std::move(name)),
       is_no_log_span_(tracing::Tracer::IsNoLogSpan(name_)),
       log_level_(is_no_log_span_ ? logging::Level::kNone : log_level),
       tracer_(std::move(tracer)),
       start_system_time_(std::chrono::system_clock::now()),
       start_steady_time_(std::chrono::steady_clock::now()),
-      trace_id_(parent ? parent->GetTraceId()
-                       : utils::generators::GenerateUuid()),
+      trace_id_(parent ? parent->trace_id_ : GenerateUuidId()),
       span_id_(GenerateSpanId()),
       parent_id_(GetParentIdForLogging(parent)),
       reference_type_(reference_type),
@@ -96,25 +154,40 @@ Span::Impl::Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
   if (parent) {
     log_extra_inheritable_ = parent->log_extra_inheritable_;
     local_log_level_ = parent->local_log_level_;
+    link_ = parent->link_;
+    sampling_ = parent->sampling_;
+    tail_buffer_ = parent->tail_buffer_;
+  } else if (defer_root_sampling) {
+    is_sampling_pending_ = true;
+  } else {
+    SetSampling(impl::SampleNewTrace());
   }
 }
 
 Span::Impl::~Impl() {
+  if (tail_buffer_ && !FinishTailSampling()) {
+    return;
+  }
+
   if (!ShouldLog()) {
     return;
   }
 
+  if (impl::HasSpanSink() && !ExportToSpanSink()) {
+    return;
+  }
+
   {
     const DetachLocalSpansScope ignore_local_span;
     logging::LogHelper lh{logging::GetDefaultLogger(), log_level_,
                           source_location_};
     std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+    LogOpenTracing();
   }
 }
 
 void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
-  const auto steady_now = std::chrono::steady_clock::now();
-  const auto duration = steady_now - start_steady_time_;
+  const auto duration = GetFinishSteadyTime() - start_steady_time_;
   const auto total_time_ms =
       std::chrono::duration_cast<RealMilliseconds>(duration).count();
   const auto timestamp_buffer = StartTsToString(start_system_time_);
@@ -136,16 +209,129 @@ void Span::Impl::PutIntoLogger(logging::impl::TagWriter writer) && {
     //  and log_extra_local_. Merge to deduplicate such tags.
     log_extra_inheritable_.Extend(std::move(*log_extra_local_));
   }
+  PutLinkInto(writer);
   writer.PutLogExtra(log_extra_inheritable_);
+}
+
+impl::BufferedSpan Span::Impl::MakeBufferedSpan() && {
+  finish_steady_time_ = std::chrono::steady_clock::now();
+
+  impl::BufferedSpan buffered;
+  buffered.level = log_level_;
+  if (impl::HasSpanSink()) buffered.sink_span = MakeFinishedSpan();
+
+  const DetachLocalSpansScope ignore_local_span;
+  {
+    RecordingLogger recorder{logging::GetDefaultLogger()};
+    {
+      logging::LogHelper lh{recorder, log_level_, source_location_};
+      std::move(*this).PutIntoLogger(lh.GetTagWriterAfterText({}));
+    }
+    buffered.log_record = std::move(recorder).ExtractRecord();
+  }
+
+  if (tracer_) buffered.opentracing_logger = tracer_->GetOptionalLogger();
+  if (buffered.opentracing_logger) {
+    RecordingLogger recorder{*buffered.opentracing_logger};
+    LogOpenTracingTo(recorder);
+    buffered.opentracing_record = std::move(recorder).ExtractRecord();
+  }
+  return buffered;
+}
+
+impl::FinishedSpan Span::Impl::MakeFinishedSpan() const {
+  impl::FinishedSpan span;
+  span.trace_id = trace_id_.GetBytes();
+  span.span_id = span_id_.GetBytes();
+  if (!parent_id_.IsEmpty()) span.parent_span_id = parent_id_.GetBytes();
+  span.name = name_;
+  span.start_time = start_system_time_;
+  span.end_time =
+      start_system_time_ +
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+          GetFinishSteadyTime() - start_steady_time_);
+
+  const auto local_tags_count =
+      log_extra_local_ ? log_extra_local_->extra_->size() : 0;
+  span.tags.reserve(log_extra_inheritable_.extra_->size() + local_tags_count +
+                    1);
+  if (!link_.IsEmpty()) {
+    span.tags.emplace_back(kLinkTag, link_.GetString());
+  }
+  for (const auto& [key, value] : *log_extra_inheritable_.extra_) {
+    span.tags.emplace_back(key, value.GetValue());
+  }
+  if (log_extra_local_) {
+    for (const auto& [key, value] : *log_extra_local_->extra_) {
+      span.tags.emplace_back(key, value.GetValue());
+    }
+  }
+  span.is_error = HasErrorTag();
+  return span;
+}
+
+bool Span::Impl::ExportToSpanSink() const {
+  return impl::ConsumeBySpanSink(MakeFinishedSpan());
+}
 
-  LogOpenTracing();
+std::chrono::steady_clock::time_point Span::Impl::GetFinishSteadyTime() const {
+  return finish_steady_time_ != std::chrono::steady_clock::time_point{}
+             ? finish_steady_time_
+             : std::chrono::steady_clock::now();
 }
 
 void Span::Impl::LogTo(logging::impl::TagWriter writer) {
+  PutLinkInto(writer);
   writer.ExtendLogExtra(log_extra_inheritable_);
   tracer_->LogSpanContextTo(*this, writer);
 }
 
+void Span::Impl::PutLinkInto(logging::impl::TagWriter writer) const {
+  if (link_.IsEmpty()) return;
+  impl::TraceId::HexBuffer buffer;
+  writer.PutTag(kLinkTag, link_.View(buffer));
+}
+
+void Span::Impl::GenerateLinkIfEmpty() {
+  if (link_.IsEmpty()) link_ = GenerateUuidId();
+}
+
+bool Span::Impl::HasErrorTag() const {
+  const auto is_error = [](const logging::LogExtra::Value& value) {
+    return std::visit(
+        [](const auto& x) {
+          if constexpr (std::is_arithmetic_v<std::decay_t<decltype(x)>>) {
+            return x != 0;
+          } else {
+            return false;
+          }
+        },
+        value);
+  };
+
+  return (log_extra_local_ &&
+          is_error(log_extra_local_->GetValue(kErrorFlag))) ||
+         is_error(log_extra_inheritable_.GetValue(kErrorFlag));
+}
+
+void Span::Impl::SetSampling(impl::Sampling&& sampling) noexcept {
+  is_sampling_pending_ = false;
+  sampling_ = sampling.decision;
+  tail_buffer_ = std::move(sampling.tail_buffer);
+  is_tail_root_ = tail_buffer_ != nullptr;
+}
+
+void Span::Impl::SampleIfPending() {
+  if (is_sampling_pending_) SetSampling(impl::SampleNewTrace());
+}
+
+bool Span::Impl::FinishTailSampling() {
+  // Buffered spans must not keep the buffer alive
+  const auto tail_buffer = std::move(tail_buffer_);
+  if (is_tail_root_) return tail_buffer->Complete(*this);
+  return ShouldLog() && !tail_buffer->TryBuffer(*this);
+}
+
 void Span::Impl::DetachFromCoroStack() { unlink(); }
 
 void Span::Impl::AttachToCoroStack() {
@@ -153,11 +339,11 @@ void Span::Impl::AttachToCoroStack() {
   task_local_spans->push_back(*this);
 }
 
-std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
+impl::SpanId Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   if (!parent) return {};
 
   if (!parent->is_linked()) {
-    return parent->GetSpanId();
+    return parent->span_id_;
   }
 
   const auto* spans_ptr = task_local_spans.GetOptional();
@@ -170,9 +356,9 @@ std::string Span::Impl::GetParentIdForLogging(const Span::Impl* parent) {
   // orphaned. It's still possible for chaining to break in case parent span
   // becomes non-loggable after child span is created, but that we can't control
   for (auto current = spans_ptr->iterator_to(*parent);; --current) {
-    if (current->GetParentId().empty() /* won't find better candidate */ ||
+    if (current->parent_id_.IsEmpty() /* won't find better candidate */ ||
         current->ShouldLog()) {
-      return current->GetSpanId();
+      return current->span_id_;
     }
     if (current == spans_ptr->begin()) break;
   };
@@ -184,14 +370,15 @@ bool Span::Impl::ShouldLog() const {
   /* We must honour default log level, but use span's level from ourselves,
    * not the previous span's.
    */
-  return logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
+  return sampling_ != impl::SamplingDecision::kNotSampled &&
+         logging::impl::ShouldLogNoSpan(logging::GetDefaultLogger(),
                                         log_level_) &&
          local_log_level_.value_or(logging::Level::kTrace) <= log_level_;
 }
 
 void Span::OptionalDeleter::operator()(Span::Impl* impl) const noexcept {
   if (do_delete) {
-    std::default_delete<Impl>{}(impl);
+    DeleteImpl(impl);
   }
 }
 
@@ -222,8 +409,8 @@ Span::Span(std::string name, ReferenceType reference_type,
                           source_location),
              Span::OptionalDeleter{OptionalDeleter::ShouldDelete()}) {
   AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
-    SetLink(utils::generators::GenerateUuid());
+  if (pimpl_->parent_id_.IsEmpty()) {
+    pimpl_->GenerateLinkIfEmpty();
   }
   pimpl_->span_ = this;
 }
@@ -357,15 +544,13 @@ void Span::AddTagFrozen(std::string key, logging::LogExtra::Value value) {
                                         logging::LogExtra::ExtendType::kFrozen);
 }
 
-void Span::SetLink(std::string link) {
-  AddTagFrozen(kLinkTag, std::move(link));
-}
+void Span::SetLink(std::string link) { pimpl_->SetLink(std::move(link)); }
 
 void Span::SetParentLink(std::string parent_link) {
   AddTagFrozen(kParentLinkTag, std::move(parent_link));
 }
 
-std::string Span::GetLink() const { return GetTag(kLinkTag); }
+std::string Span::GetLink() const { return pimpl_->GetLink().GetString(); }
 
 std::string Span::GetParentLink() const { return GetTag(kParentLinkTag); }
 
@@ -375,6 +560,8 @@ void Span::LogTo(logging::impl::TagWriter writer) const& {
 
 bool Span::ShouldLogDefault() const noexcept { return pimpl_->ShouldLog(); }
 
+bool Span::IsSampled() const noexcept { return pimpl_->IsSampled(); }
+
 void Span::DetachFromCoroStack() {
   if (pimpl_) pimpl_->DetachFromCoroStack();
 }
@@ -414,6 +601,34 @@ const Span::Impl* GetParentSpanImpl() {
   return !spans_ptr || spans_ptr->empty() ? nullptr : &spans_ptr->back();
 }
 
+void* AllocateImplStorage() {
+  {
+    auto pool = local_impl_pool.Use();
+    if (!pool->storages.empty()) {
+      void* const storage = pool->storages.back();
+      pool->storages.pop_back();
+      return storage;
+    }
+  }
+  return ::operator new(sizeof(Span::Impl));
+}
+
+void DeallocateImplStorage(void* storage) noexcept {
+  {
+    auto pool = local_impl_pool.Use();
+    if (pool->storages.size() < kMaxPooledImpls) {
+      pool->storages.push_back(storage);
+      return;
+    }
+  }
+  ::operator delete(storage);
+}
+
+void DeleteImpl(Span::Impl* impl) noexcept {
+  impl->~Impl();
+  DeallocateImplStorage(impl);
+}
+
 DetachLocalSpansScope::DetachLocalSpansScope() noexcept {
   if (engine::current_task::IsTaskProcessorThread()) {
     if (auto* const spans_ptr = task_local_spans.GetOptional()) {
@@ -3,7 +3,6 @@
 #include <tracing/span_impl.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
-#include <userver/utils/uuid4.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -11,13 +10,16 @@ namespace tracing {
 
 SpanBuilder::SpanBuilder(std::string name,
                          const utils::impl::SourceLocation& location)
+    // A root is sampled in Build(), unless SetSampled() passes the decision
+    // of the caller, which must not take the budget of the new traces
     : pimpl_(AllocateImpl(tracing::Tracer::GetTracer(), std::move(name),
                           GetParentSpanImpl(), ReferenceType::kChild,
-                          logging::Level::kInfo, location),
+                          logging::Level::kInfo, location,
+                          /*defer_root_sampling=*/true),
              Span::OptionalDeleter{Span::OptionalDeleter::ShouldDelete()}) {
   pimpl_->AttachToCoroStack();
-  if (pimpl_->GetParentId().empty()) {
-    AddTagFrozen(kLinkTag, utils::generators::GenerateUuid());
+  if (pimpl_->GetBinaryParentId().IsEmpty()) {
+    pimpl_->GenerateLinkIfEmpty();
   }
 }
 
@@ -49,11 +51,18 @@ void SpanBuilder::AddNonInheritableTag(std::string key,
   pimpl_->log_extra_local_->Extend(std::move(key), std::move(value));
 }
 
+void SpanBuilder::SetSampled(bool sampled) {
+  pimpl_->SetSampling(impl::SampleIncomingTrace(sampled));
+}
+
 void SpanBuilder::SetParentLink(std::string parent_link) {
   AddTagFrozen(kParentLinkTag, std::move(parent_link));
 }
 
-Span SpanBuilder::Build() && { return Span(std::move(pimpl_)); }
+Span SpanBuilder::Build() && {
+  pimpl_->SampleIfPending();
+  return Span(std::move(pimpl_));
+}
 
 }  // namespace tracing
 
@@ -18,6 +18,8 @@
 #include <userver/tracing/tracer.hpp>
 #include <userver/utils/impl/source_location.hpp>
 
+#include <tracing/binary_id.hpp>
+#include <tracing/sampler.hpp>
 #include <tracing/time_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -37,9 +39,12 @@ class Span::Impl
                 utils::impl::SourceLocation source_location =
                     utils::impl::SourceLocation::Current());
 
+  // If `defer_root_sampling` is set, a span without a parent is not sampled
+  // until SetSampling or SampleIfPending is called
   Impl(TracerPtr tracer, std::string name, const Span::Impl* parent,
        ReferenceType reference_type, logging::Level log_level,
-       utils::impl::SourceLocation source_location);
+       utils::impl::SourceLocation source_location,
+       bool defer_root_sampling = false);
 
   Impl(Impl&&) = default;
 
@@ -51,35 +56,76 @@ class Span::Impl
   // Log this Span specifically
   void PutIntoLogger(logging::impl::TagWriter writer) &&;
 
+  // Renders the finished Span for the tail sampling, the Span is not logged
+  // by itself after that
+  impl::BufferedSpan MakeBufferedSpan() &&;
+
   // Add the context of this Span a non-Span-specific log record
   void LogTo(logging::impl::TagWriter writer);
 
-  const std::string& GetTraceId() const& noexcept { return trace_id_; }
-  const std::string& GetSpanId() const& noexcept { return span_id_; }
-  const std::string& GetParentId() const& noexcept { return parent_id_; }
+  // Hex of the binary IDs is cached, prefer the binary IDs where possible
+  const std::string& GetTraceId() const { return trace_id_.GetString(); }
+  const std::string& GetSpanId() const { return span_id_.GetString(); }
+  const std::string& GetParentId() const { return parent_id_.GetString(); }
+
+  const impl::TraceId& GetBinaryTraceId() const noexcept { return trace_id_; }
+  const impl::SpanId& GetBinarySpanId() const noexcept { return span_id_; }
+  const impl::SpanId& GetBinaryParentId() const noexcept { return parent_id_; }
+
+  void SetTraceId(std::string&& id) { trace_id_.Assign(std::move(id)); }
+  void SetSpanId(std::string&& id) { span_id_.Assign(std::move(id)); }
+  void SetParentId(std::string&& id) { parent_id_.Assign(std::move(id)); }
+
+  const impl::TraceId& GetLink() const noexcept { return link_; }
 
-  std::string GetTraceId() && noexcept { return std::move(trace_id_); }
-  std::string GetSpanId() && noexcept { return std::move(span_id_); }
-  std::string GetParentId() && noexcept { return std::move(parent_id_); }
+  // The link can be set only once
+  void SetLink(std::string&& link) {
+    if (link_.IsEmpty()) link_.Assign(std::move(link));
+  }
 
-  void SetTraceId(std::string&& id) noexcept { trace_id_ = std::move(id); }
-  void SetSpanId(std::string&& id) noexcept { span_id_ = std::move(id); }
-  void SetParentId(std::string&& id) noexcept { parent_id_ = std::move(id); }
+  void GenerateLinkIfEmpty();
 
   ReferenceType GetReferenceType() const noexcept { return reference_type_; }
 
+  bool IsSampled() const noexcept {
+    return sampling_ == impl::SamplingDecision::kSampled;
+  }
+
+  // Whether the tracing::kErrorFlag tag is set
+  bool HasErrorTag() const;
+
+  // Makes this span the root of the trace sampled as `sampling` says
+  void SetSampling(impl::Sampling&& sampling) noexcept;
+
+  // Makes the head sampling decision for a root with deferred sampling
+  void SampleIfPending();
+
   void DetachFromCoroStack();
   void AttachToCoroStack();
 
  private:
   void LogOpenTracing() const;
+  void LogOpenTracingTo(logging::impl::LoggerBase& logger) const;
   void DoLogOpenTracing(logging::impl::TagWriter writer) const;
   static void AddOpentracingTags(formats::json::StringBuilder& output,
                                  const logging::LogExtra& input);
 
-  static std::string GetParentIdForLogging(const Span::Impl* parent);
+  static impl::SpanId GetParentIdForLogging(const Span::Impl* parent);
   bool ShouldLog() const;
 
+  void PutLinkInto(logging::impl::TagWriter writer) const;
+
+  impl::FinishedSpan MakeFinishedSpan() const;
+
+  // Returns false if the span should not be written to the logs
+  bool ExportToSpanSink() const;
+
+  // Now, or the time the span was buffered by the tail sampling
+  std::chrono::steady_clock::time_point GetFinishSteadyTime() const;
+
+  // Returns false if the span should not be logged right away
+  bool FinishTailSampling();
+
   const std::string name_;
   const bool is_no_log_span_;
   logging::Level log_level_;
@@ -96,14 +142,24 @@ class Span::Impl
   const std::chrono::system_clock::time_point start_system_time_;
   const std::chrono::steady_clock::time_point start_steady_time_;
 
-  std::string trace_id_;
-  std::string span_id_;
-  std::string parent_id_;
+  impl::TraceId trace_id_;
+  impl::SpanId span_id_;
+  impl::SpanId parent_id_;
+  // Kept apart from the tags, so that the children do not copy the string
+  impl::TraceId link_;
   const ReferenceType reference_type_;
+  impl::SamplingDecision sampling_{impl::SamplingDecision::kSampled};
+  bool is_tail_root_{false};
+  bool is_sampling_pending_{false};
   utils::impl::SourceLocation source_location_;
 
+  std::shared_ptr<impl::TailSamplingBuffer> tail_buffer_;
+  // Set for the spans buffered by the tail sampling
+  std::chrono::steady_clock::time_point finish_steady_time_{};
+
   friend class Span;
   friend class SpanBuilder;
+  friend class impl::TailSamplingBuffer;
 };
 
 // Use list instead of stack to avoid UB in case of "pop non-last item"
@@ -114,11 +170,23 @@ using SpanStack =
 
 const Span::Impl* GetParentSpanImpl();
 
+// Storage of the finished spans is reused by the new spans of the thread
+void* AllocateImplStorage();
+void DeallocateImplStorage(void* storage) noexcept;
+
 template <typename... Args>
 Span::Impl* AllocateImpl(Args&&... args) {
-  return new Span::Impl(std::forward<Args>(args)...);
+  void* const storage = AllocateImplStorage();
+  try {
+    return new (storage) Span::Impl(std::forward<Args>(args)...);
+  } catch (...) {
+    DeallocateImplStorage(storage);
+    throw;
+  }
 }
 
+void DeleteImpl(Span::Impl* impl) noexcept;
+
 class DetachLocalSpansScope final {
  public:
   DetachLocalSpansScope() noexcept;
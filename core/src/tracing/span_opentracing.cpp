@@ -86,15 +86,18 @@ void Span::Impl::LogOpenTracing() const {
 
   auto logger = tracer_->GetOptionalLogger();
   if (logger) {
-    const DetachLocalSpansScope ignore_local_span;
-    logging::LogHelper lh(*logger, log_level_);
-    DoLogOpenTracing(lh.GetTagWriterAfterText({}));
+    LogOpenTracingTo(*logger);
   }
 }
 
+void Span::Impl::LogOpenTracingTo(logging::impl::LoggerBase& logger) const {
+  const DetachLocalSpansScope ignore_local_span;
+  logging::LogHelper lh(logger, log_level_);
+  DoLogOpenTracing(lh.GetTagWriterAfterText({}));
+}
+
 void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
-  const auto steady_now = std::chrono::steady_clock::now();
-  const auto duration = steady_now - start_steady_time_;
+  const auto duration = GetFinishSteadyTime() - start_steady_time_;
   const auto duration_microseconds =
       std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
   auto start_time = std::chrono::duration_cast<std::chrono::microseconds>(
@@ -104,9 +107,12 @@ void Span::Impl::DoLogOpenTracing(logging::impl::TagWriter writer) const {
   if (tracer_) {
     writer.PutTag(jaeger::kServiceName, tracer_->GetServiceName());
   }
-  writer.PutTag(jaeger::kTraceId, trace_id_);
-  writer.PutTag(jaeger::kParentId, parent_id_);
-  writer.PutTag(jaeger::kSpanId, span_id_);
+  impl::TraceId::HexBuffer trace_id_buffer;
+  impl::SpanId::HexBuffer parent_id_buffer;
+  impl::SpanId::HexBuffer span_id_buffer;
+  writer.PutTag(jaeger::kTraceId, trace_id_.View(trace_id_buffer));
+  writer.PutTag(jaeger::kParentId, parent_id_.View(parent_id_buffer));
+  writer.PutTag(jaeger::kSpanId, span_id_.View(span_id_buffer));
   writer.PutTag(jaeger::kStartTime, start_time);
   writer.PutTag(jaeger::kStartTimeMillis, start_time / 1000);
   writer.PutTag(jaeger::kDuration, duration_microseconds);
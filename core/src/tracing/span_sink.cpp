@@ -0,0 +1,48 @@
+#include <tracing/span_sink.hpp>
+
+#include <atomic>
+
+#include <userver/rcu/rcu.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+namespace {
+
+struct SinkHolder final {
+  std::shared_ptr<SpanSink> sink;
+  bool log_spans{true};
+};
+
+// Checked first, so that the spans do not read the rcu without a sink
+std::atomic<bool> has_sink{false};
+
+rcu::Variable<SinkHolder>& GlobalSink() {
+  static rcu::Variable<SinkHolder> sink;
+  return sink;
+}
+
+}  // namespace
+
+SpanSink::~SpanSink() = default;
+
+void SetSpanSink(std::shared_ptr<SpanSink> sink, bool log_spans) {
+  const bool is_set = sink != nullptr;
+  GlobalSink().Assign(SinkHolder{std::move(sink), log_spans});
+  has_sink.store(is_set);
+}
+
+bool HasSpanSink() noexcept { return has_sink.load(std::memory_order_relaxed); }
+
+bool ConsumeBySpanSink(FinishedSpan&& span) noexcept {
+  const auto holder = GlobalSink().Read();
+  if (!holder->sink) return true;
+
+  holder->sink->Consume(std::move(span));
+  return holder->log_spans;
+}
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <userver/logging/log_extra.hpp>
+
+#include <tracing/binary_id.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace tracing::impl {
+
+// A copy of the data of a finished tracing::Span
+struct FinishedSpan final {
+  TraceId::Bytes trace_id{};
+  SpanId::Bytes span_id{};
+  std::optional<SpanId::Bytes> parent_span_id;
+  std::string name;
+  std::chrono::system_clock::time_point start_time;
+  std::chrono::system_clock::time_point end_time;
+  std::vector<logging::LogExtra::Pair> tags;
+  bool is_error{false};
+};
+
+// Receives the spans that are about to be logged, from any thread
+class SpanSink {
+ public:
+  virtual ~SpanSink();
+
+  // Must not block or switch coroutines
+  virtual void Consume(FinishedSpan&& span) noexcept = 0;
+};
+
+// Sets the sink of the spans, nullptr to remove it. If `log_spans` is false,
+// the spans are only passed to the sink and are not written to the logs.
+void SetSpanSink(std::shared_ptr<SpanSink> sink, bool log_spans);
+
+bool HasSpanSink() noexcept;
+
+// Returns false if the span should not be written to the logs
+bool ConsumeBySpanSink(FinishedSpan&& span) noexcept;
+
+}  // namespace tracing::impl
+
+USERVER_NAMESPACE_END
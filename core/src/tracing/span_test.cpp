@@ -3,9 +3,14 @@
 #include <logging/log_helper_impl.hpp>
 #include <logging/logging_test.hpp>
 #include <tracing/no_log_spans.hpp>
+#include <tracing/span_sink.hpp>
+#include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/formats/json/serialize.hpp>
+#include <userver/tracing/sampling.hpp>
+#include <userver/tracing/span_builder.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/tracing/tags.hpp>
 #include <userver/tracing/tracer.hpp>
 #include <userver/utest/utest.hpp>
 #include <userver/utils/regex.hpp>
@@ -718,4 +723,267 @@ UTEST_F(Span, MakeSpanWithParentIdTraceIdLinkWithExisting) {
   }
 }
 
+UTEST_F(Span, Ids) {
+  tracing::Span root_span("root_span");
+  EXPECT_EQ(root_span.GetTraceId().size(), 32);
+  EXPECT_EQ(root_span.GetSpanId().size(), 16);
+  EXPECT_EQ(root_span.GetLink().size(), 32);
+
+  tracing::Span child("child");
+  EXPECT_EQ(child.GetTraceId(), root_span.GetTraceId());
+  EXPECT_EQ(child.GetParentId(), root_span.GetSpanId());
+  EXPECT_NE(child.GetSpanId(), root_span.GetSpanId());
+  EXPECT_EQ(child.GetLink(), root_span.GetLink());
+}
+
+UTEST_F_MT(Span, ConcurrentIdsReads, 4) {
+  constexpr std::size_t kTasksCount = 4;
+  for (int i = 0; i < 100; ++i) {
+    tracing::Span span("span");
+    std::vector<engine::TaskWithResult<std::string>> tasks;
+    tasks.reserve(kTasksCount);
+    for (std::size_t j = 0; j < kTasksCount; ++j) {
+      tasks.push_back(engine::AsyncNoSpan([&span] {
+        return span.GetTraceId() + span.GetSpanId() + span.GetParentId();
+      }));
+    }
+    for (auto& task : tasks) {
+      EXPECT_EQ(task.Get(), span.GetTraceId() + span.GetSpanId());
+    }
+  }
+}
+
+UTEST_F(Span, ForeignIdsArePreserved) {
+  for (const std::string trace_id :
+       {"0123456789abcdef0123456789abcdef", "0123456789ABCDEF0123456789ABCDEF",
+        "0123456789abcdef", "not-a-hex-id"}) {
+    {
+      tracing::SpanBuilder builder("span_name");
+      builder.SetTraceId(trace_id);
+      builder.SetParentSpanId(trace_id);
+      auto span = std::move(builder).Build();
+      EXPECT_EQ(span.GetTraceId(), trace_id);
+      EXPECT_EQ(span.GetParentId(), trace_id);
+      EXPECT_EQ(span.CreateChild("child").GetTraceId(), trace_id);
+    }
+    logging::LogFlush();
+    EXPECT_NE(GetStreamString().find("trace_id=" + trace_id + "\t"),
+              std::string::npos);
+  }
+}
+
+class SpanSampling : public Span {
+ protected:
+  ~SpanSampling() override {
+    tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+  }
+
+  static tracing::Span MakeRootSpan(std::string name) {
+    return tracing::Span(tracing::Tracer::GetTracer(), std::move(name),
+                         nullptr, tracing::ReferenceType::kChild);
+  }
+
+  bool IsLogged(std::string_view span_name) {
+    logging::LogFlush();
+    return GetStreamString().find(fmt::format("stopwatch_name={}\t",
+                                              span_name)) != std::string::npos;
+  }
+};
+
+UTEST_F(SpanSampling, Head) {
+  tracing::SamplingSettings settings;
+  settings.probability = 0;
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  {
+    auto root = MakeRootSpan("not_sampled_root");
+    EXPECT_FALSE(root.IsSampled());
+    EXPECT_FALSE(root.ShouldLogDefault());
+    {
+      tracing::Span child("not_sampled_child");
+      EXPECT_FALSE(child.IsSampled());
+      LOG_INFO() << "log inside not sampled trace";
+    }
+  }
+  EXPECT_FALSE(IsLogged("not_sampled_root"));
+  EXPECT_FALSE(IsLogged("not_sampled_child"));
+  EXPECT_NE(GetStreamString().find("log inside not sampled trace"),
+            std::string::npos);
+
+  tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+  { auto root = MakeRootSpan("sampled_root"); }
+  EXPECT_TRUE(IsLogged("sampled_root"));
+}
+
+UTEST_F(SpanSampling, RateLimit) {
+  tracing::SamplingSettings settings;
+  settings.max_traces_per_second = 1;
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  EXPECT_TRUE(MakeRootSpan("first").IsSampled());
+  EXPECT_FALSE(MakeRootSpan("second").IsSampled());
+}
+
+UTEST_F(SpanSampling, IncomingTracesDoNotTakeRateBudget) {
+  tracing::SamplingSettings settings;
+  settings.max_traces_per_second = 1;
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  for (const bool sampled : {true, false, true}) {
+    tracing::SpanBuilder builder("incoming");
+    builder.SetSampled(sampled);
+    EXPECT_EQ(std::move(builder).Build().IsSampled(), sampled);
+  }
+
+  EXPECT_TRUE(MakeRootSpan("local").IsSampled());
+  EXPECT_FALSE(tracing::SpanBuilder{"local_built"}.Build().IsSampled());
+}
+
+UTEST_F(SpanSampling, IncomingDecision) {
+  tracing::SamplingSettings settings;
+  settings.probability = 0;
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  {
+    tracing::SpanBuilder builder("sampled_by_caller");
+    builder.SetSampled(true);
+    auto span = std::move(builder).Build();
+    EXPECT_TRUE(span.IsSampled());
+  }
+  EXPECT_TRUE(IsLogged("sampled_by_caller"));
+
+  tracing::Tracer::SetSamplingSettings(tracing::SamplingSettings{});
+  {
+    tracing::SpanBuilder builder("not_sampled_by_caller");
+    builder.SetSampled(false);
+    auto span = std::move(builder).Build();
+    EXPECT_FALSE(span.IsSampled());
+  }
+  EXPECT_FALSE(IsLogged("not_sampled_by_caller"));
+}
+
+UTEST_F(SpanSampling, TailDropsFastTraces) {
+  tracing::SamplingSettings settings;
+  settings.probability = 0;
+  settings.tail_sampling = true;
+  settings.tail_slow_threshold = std::chrono::hours{1};
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  {
+    auto root = MakeRootSpan("fast_root");
+    EXPECT_FALSE(root.IsSampled());
+    { tracing::Span child("fast_child"); }
+  }
+  EXPECT_FALSE(IsLogged("fast_root"));
+  EXPECT_FALSE(IsLogged("fast_child"));
+}
+
+UTEST_F(SpanSampling, TailLogsFailedTraces) {
+  tracing::SamplingSettings settings;
+  settings.probability = 0;
+  settings.tail_sampling = true;
+  settings.tail_slow_threshold = std::chrono::hours{1};
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  {
+    auto root = MakeRootSpan("failed_root");
+    {
+      tracing::Span child("failed_child");
+      child.AddTag(tracing::kErrorFlag, true);
+      child.AddTag("buffered_tag", "buffered_value");
+    }
+    // buffered until the root finishes
+    EXPECT_FALSE(IsLogged("failed_child"));
+  }
+  EXPECT_TRUE(IsLogged("failed_root"));
+  EXPECT_TRUE(IsLogged("failed_child"));
+  EXPECT_NE(GetStreamString().find("buffered_tag=buffered_value"),
+            std::string::npos);
+}
+
+UTEST_F(SpanSampling, TailLogsSlowTraces) {
+  tracing::SamplingSettings settings;
+  settings.probability = 0;
+  settings.tail_sampling = true;
+  settings.tail_slow_threshold = std::chrono::milliseconds{0};
+  settings.tail_max_buffered_spans = 1;
+  tracing::Tracer::SetSamplingSettings(settings);
+
+  {
+    auto root = MakeRootSpan("slow_root");
+    { tracing::Span child("slow_child"); }
+    { tracing::Span child("overflown_child"); }
+  }
+  EXPECT_TRUE(IsLogged("slow_root"));
+  EXPECT_TRUE(IsLogged("slow_child"));
+  EXPECT_FALSE(IsLogged("overflown_child"));
+}
+
+class SpanSink : public Span {
+ protected:
+  class TestSink final : public tracing::impl::SpanSink {
+   public:
+    void Consume(tracing::impl::FinishedSpan&& span) noexcept override {
+      spans.push_back(std::move(span));
+    }
+
+    std::vector<tracing::impl::FinishedSpan> spans;
+  };
+
+  ~SpanSink() override { tracing::impl::SetSpanSink(nullptr, true); }
+};
+
+UTEST_F(SpanSink, ReceivesFinishedSpans) {
+  auto sink = std::make_shared<TestSink>();
+  tracing::impl::SetSpanSink(sink, /*log_spans=*/false);
+
+  {
+    tracing::Span parent("sink_parent");
+    parent.AddTag("inherited", 1);
+    tracing::Span child("sink_child");
+    child.AddNonInheritableTag("local", "value");
+    child.AddTag(tracing::kErrorFlag, true);
+  }
+  {
+    // not logged due to the log level, so not exported
+    tracing::Span no_log("sink_no_log");
+    no_log.SetLocalLogLevel(logging::Level::kNone);
+  }
+
+  ASSERT_EQ(sink->spans.size(), 2);
+  const auto& child = sink->spans[0];
+  const auto& parent = sink->spans[1];
+  EXPECT_EQ(child.name, "sink_child");
+  EXPECT_EQ(parent.name, "sink_parent");
+  EXPECT_EQ(child.trace_id, parent.trace_id);
+  EXPECT_EQ(child.parent_span_id, parent.span_id);
+  EXPECT_LE(child.start_time, child.end_time);
+  EXPECT_TRUE(child.is_error);
+  EXPECT_FALSE(parent.is_error);
+
+  const auto has_tag = [](const tracing::impl::FinishedSpan& span,
+                          std::string_view key) {
+    return std::any_of(span.tags.begin(), span.tags.end(),
+                       [key](const auto& tag) { return tag.first == key; });
+  };
+  EXPECT_TRUE(has_tag(child, "inherited"));
+  EXPECT_TRUE(has_tag(child, "local"));
+  EXPECT_FALSE(has_tag(parent, "local"));
+
+  logging::LogFlush();
+  EXPECT_EQ(GetStreamString().find("stopwatch_name=sink_"), std::string::npos);
+}
+
+UTEST_F(SpanSink, KeepsLogs) {
+  auto sink = std::make_shared<TestSink>();
+  tracing::impl::SetSpanSink(sink, /*log_spans=*/true);
+
+  { tracing::Span span("logged_and_exported"); }
+
+  EXPECT_EQ(sink->spans.size(), 1);
+  logging::LogFlush();
+  EXPECT_NE(GetStreamString().find("stopwatch_name=logged_and_exported"),
+            std::string::npos);
+}
+
 USERVER_NAMESPACE_END
@@ -4,9 +4,10 @@
 
 #include <userver/logging/impl/tag_writer.hpp>
 #include <userver/rcu/rcu.hpp>
-#include <userver/utils/uuid4.hpp>
+#include <userver/tracing/sampling.hpp>
 
 #include <tracing/no_log_spans.hpp>
+#include <tracing/sampler.hpp>
 #include <tracing/span_impl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -30,9 +31,13 @@ class NoopTracer final : public Tracer {
 
 void NoopTracer::LogSpanContextTo(const Span::Impl& span,
                                   logging::impl::TagWriter writer) const {
-  writer.PutTag(kTraceIdName, span.GetTraceId());
-  writer.PutTag(kSpanIdName, span.GetSpanId());
-  writer.PutTag(kParentIdName, span.GetParentId());
+  impl::TraceId::HexBuffer trace_id_buffer;
+  impl::SpanId::HexBuffer span_id_buffer;
+  impl::SpanId::HexBuffer parent_id_buffer;
+  writer.PutTag(kTraceIdName, span.GetBinaryTraceId().View(trace_id_buffer));
+  writer.PutTag(kSpanIdName, span.GetBinarySpanId().View(span_id_buffer));
+  writer.PutTag(kParentIdName,
+                span.GetBinaryParentId().View(parent_id_buffer));
 }
 
 auto& GlobalNoLogSpans() {
@@ -83,6 +88,10 @@ bool Tracer::IsNoLogSpan(const std::string& name) {
          spans->names.find(name) != spans->names.end();
 }
 
+void Tracer::SetSamplingSettings(const SamplingSettings& settings) {
+  impl::SetSamplingSettings(settings);
+}
+
 void Tracer::SetTracer(std::shared_ptr<Tracer> tracer) {
   GlobalTracer().Assign(std::move(tracer));
 }
@@ -103,7 +112,7 @@ Span Tracer::CreateSpanWithoutParent(std::string name) {
   auto span =
       Span(shared_from_this(), std::move(name), nullptr, ReferenceType::kChild);
 
-  span.SetLink(utils::generators::GenerateUuid());
+  span.pimpl_->GenerateLinkIfEmpty();
   return span;
 }
 
@@ -33,6 +33,31 @@ void tracing_happy_log(benchmark::State& state) {
 }
 BENCHMARK(tracing_happy_log);
 
+void tracing_child_ctr(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeTracer("test_service", {});
+    const auto root = tracer->CreateSpanWithoutParent("root");
+
+    for ([[maybe_unused]] auto _ : state)
+      benchmark::DoNotOptimize(root.CreateChild("name"));
+  });
+}
+BENCHMARK(tracing_child_ctr);
+
+void tracing_ids_access(benchmark::State& state) {
+  engine::RunStandalone([&] {
+    auto tracer = tracing::MakeTracer("test_service", {});
+
+    for ([[maybe_unused]] auto _ : state) {
+      const auto span = tracer->CreateSpanWithoutParent("name");
+      benchmark::DoNotOptimize(span.GetTraceId());
+      benchmark::DoNotOptimize(span.GetSpanId());
+      benchmark::DoNotOptimize(span.GetLink());
+    }
+  });
+}
+BENCHMARK(tracing_ids_access);
+
 tracing::Span GetSpanWithOpentracingHttpTags(tracing::TracerPtr tracer) {
   auto span = tracer->CreateSpanWithoutParent("name");
   span.AddTag("meta_code", 200);
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 #include <unordered_map>
 
 #include <fmt/compile.h>
@@ -41,6 +42,37 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
     fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
   }
 
+  void HandleSeries(const impl::RegisteredSeries& series,
+                    utils::statistics::LabelsSpan add_labels,
+                    const MetricValue& value) override {
+    if (value.IsHistogram()) {
+      UASSERT_MSG(false,
+                  "Histogram metrics are not supported for Prometheus yet");
+      return;
+    }
+    const auto labels =
+        series.GetFragment(impl::SeriesFormat::kPrometheus, [&series] {
+          std::string result;
+          DumpLabelsList(result, series.GetLabels());
+          return result;
+        });
+
+    DumpMetricNameAndType(series.GetPath(), value);
+    buf_.push_back('{');
+    if (!add_labels.empty()) {
+      // add_labels are the same for the whole scrape
+      if (!add_labels_text_) {
+        add_labels_text_.emplace();
+        DumpLabelsList(*add_labels_text_, add_labels);
+      }
+      buf_.append(*add_labels_text_);
+      if (!labels.empty()) buf_.push_back(',');
+    }
+    buf_.append(labels);
+    buf_.push_back('}');
+    fmt::format_to(std::back_inserter(buf_), FMT_COMPILE(" {}\n"), value);
+  }
+
   std::string Release() { return fmt::to_string(buf_); }
 
  private:
@@ -84,24 +116,31 @@ class FormatBuilder final : public utils::statistics::BaseFormatBuilder {
 
   void DumpLabels(utils::statistics::LabelsSpan labels) {
     buf_.push_back('{');
+    DumpLabelsList(buf_, labels);
+    buf_.push_back('}');
+  }
+
+  template <typename Buffer>
+  static void DumpLabelsList(Buffer& out,
+                             utils::statistics::LabelsSpan labels) {
     bool sep = false;
     for (const auto& label : labels) {
       if (sep) {
-        buf_.push_back(',');
+        out.push_back(',');
       }
-      fmt::format_to(std::back_inserter(buf_), FMT_COMPILE("{}=\""),
+      fmt::format_to(std::back_inserter(out), FMT_COMPILE("{}=\""),
                      impl::ToPrometheusLabel(label.Name()));
       const auto& value = label.Value();
-      std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(buf_),
+      std::replace_copy(value.cbegin(), value.cend(), std::back_inserter(out),
                         '"', '\'');
-      buf_.push_back('"');
+      out.push_back('"');
       sep = true;
     }
-    buf_.push_back('}');
   }
 
   fmt::memory_buffer buf_;
   utils::impl::TransparentMap<std::string, std::string> metrics_;
+  std::optional<std::string> add_labels_text_;
 };
 
 }  // namespace
@@ -29,7 +29,42 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
                     const MetricValue& value) override {
     const formats::json::StringBuilder::ObjectGuard guard{builder_};
     builder_.Key("labels");
-    DumpLabels(path, labels);
+    DumpLabels(builder_, path, labels);
+    DumpValue(path, value);
+  }
+
+  void HandleSeries(const impl::RegisteredSeries& series,
+                    utils::statistics::LabelsSpan add_labels,
+                    const MetricValue& value) override {
+    if (!add_labels.empty()) {
+      BaseFormatBuilder::HandleSeries(series, add_labels, value);
+      return;
+    }
+
+    const auto labels =
+        series.GetFragment(impl::SeriesFormat::kSolomon, [&series] {
+          formats::json::StringBuilder labels_builder;
+          DumpLabels(labels_builder, series.GetPath(), series.GetLabels());
+          return labels_builder.GetString();
+        });
+
+    const formats::json::StringBuilder::ObjectGuard guard{builder_};
+    builder_.Key("labels");
+    builder_.WriteRawString(labels);
+    DumpValue(series.GetPath(), value);
+  }
+
+  void AddCommonLabels(
+      const std::unordered_map<std::string, std::string>& common_labels) {
+    if (common_labels.empty()) {
+      return;
+    }
+    builder_.Key("commonLabels");
+    WriteToStream(common_labels, builder_);
+  }
+
+ private:
+  void DumpValue(std::string_view path, const MetricValue& value) {
     value.Visit(utils::Overloaded{
         [&, this](HistogramView x) {
           builder_.Key("hist");
@@ -59,25 +94,17 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
     });
   }
 
-  void AddCommonLabels(
-      const std::unordered_map<std::string, std::string>& common_labels) {
-    if (common_labels.empty()) {
-      return;
-    }
-    builder_.Key("commonLabels");
-    WriteToStream(common_labels, builder_);
-  }
-
- private:
-  void DumpLabels(std::string_view path, utils::statistics::LabelsSpan labels) {
-    const formats::json::StringBuilder::ObjectGuard guard{builder_};
-    builder_.Key("sensor");
+  static void DumpLabels(formats::json::StringBuilder& builder,
+                         std::string_view path,
+                         utils::statistics::LabelsSpan labels) {
+    const formats::json::StringBuilder::ObjectGuard guard{builder};
+    builder.Key("sensor");
 
     if (path.size() > impl::solomon::kMaxLabelValueLen) {
       LOG_LIMITED_WARNING()
           << "Path '" << path << "' is too long for Solomon; will be truncated";
     }
-    builder_.WriteString(path.substr(0, impl::solomon::kMaxLabelValueLen));
+    builder.WriteString(path.substr(0, impl::solomon::kMaxLabelValueLen));
 
     std::size_t written_labels = 0;
     for (const auto& label : labels) {
@@ -105,7 +132,7 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
                               << impl::solomon::kMaxLabelNameLen
                               << " chars allowed in Solomon; will be truncated";
       }
-      builder_.Key(name.substr(0, impl::solomon::kMaxLabelNameLen));
+      builder.Key(name.substr(0, impl::solomon::kMaxLabelNameLen));
 
       const auto value = label.Value();
       if (value.size() > impl::solomon::kMaxLabelValueLen) {
@@ -114,7 +141,7 @@ class SolomonJsonBuilder final : public utils::statistics::BaseFormatBuilder {
             << "' is longer than " << impl::solomon::kMaxLabelValueLen
             << " chars allowed in Solomon; will be truncated";
       }
-      builder_.WriteString(value.substr(0, impl::solomon::kMaxLabelValueLen));
+      builder.WriteString(value.substr(0, impl::solomon::kMaxLabelValueLen));
 
       ++written_labels;
     }
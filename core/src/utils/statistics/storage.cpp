@@ -1,5 +1,6 @@
 #include <userver/utils/statistics/storage.hpp>
 
+#include <algorithm>
 #include <utility>
 
 #include <boost/container/small_vector.hpp>
@@ -34,6 +35,42 @@ void RemoveAddedLabels(std::vector<Label>& labels,
                labels.end());
 }
 
+std::vector<LabelView> MakeLabelViews(const std::vector<Label>& labels) {
+  std::vector<LabelView> views;
+  views.reserve(labels.size());
+  for (const auto& label : labels) {
+    views.emplace_back(label);
+  }
+  return views;
+}
+
+bool IsSeriesRequested(const impl::RegisteredSeries& series,
+                       LabelsSpan add_labels, const Request& request) {
+  const auto path = series.GetPath();
+  switch (request.prefix_match_type) {
+    case Request::PrefixMatch::kNoop:
+      break;
+    case Request::PrefixMatch::kExact:
+      if (path != request.prefix) return false;
+      break;
+    case Request::PrefixMatch::kStartsWith:
+      if (!utils::text::StartsWith(path, request.prefix)) return false;
+      break;
+  }
+
+  const auto labels = series.GetLabels();
+  for (const auto& required : request.require_labels) {
+    const LabelView required_view{required};
+    if (std::find(labels.begin(), labels.end(), required_view) ==
+            labels.end() &&
+        std::find(add_labels.begin(), add_labels.end(), required_view) ==
+            add_labels.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 class FakeFormatBuilder final : public BaseFormatBuilder {
  public:
   void HandleMetric(std::string_view, LabelsSpan, const MetricValue&) override {
@@ -60,6 +97,9 @@ CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnregistering(
     if (source.extender) {
       source.extender(StatisticsRequest{});
     }
+    if (source.series) {
+      [[maybe_unused]] const auto value = source.series->Read();
+    }
   } catch (const std::exception& e) {
     LOG_ERROR() << "Unhandled exception while statistics holder "
                 << source.prefix_path
@@ -94,6 +134,40 @@ Request::Request(std::string prefix_in, PrefixMatch path_match_type_in,
 
 BaseFormatBuilder::~BaseFormatBuilder() = default;
 
+void BaseFormatBuilder::HandleSeries(const impl::RegisteredSeries& series,
+                                     LabelsSpan add_labels,
+                                     const MetricValue& value) {
+  if (add_labels.empty()) {
+    HandleMetric(series.GetPath(), series.GetLabels(), value);
+    return;
+  }
+
+  boost::container::small_vector<LabelView, 16> labels_vector;
+  labels_vector.reserve(add_labels.size() + series.GetLabels().size());
+  labels_vector.insert(labels_vector.end(), add_labels.begin(),
+                       add_labels.end());
+  labels_vector.insert(labels_vector.end(), series.GetLabels().begin(),
+                       series.GetLabels().end());
+  HandleMetric(series.GetPath(), LabelsSpan{labels_vector}, value);
+}
+
+namespace impl {
+
+InternedLabels::InternedLabels(std::vector<Label>&& labels_in)
+    : labels(std::move(labels_in)), views(MakeLabelViews(labels)) {}
+
+RegisteredSeries::RegisteredSeries(std::string path,
+                                   std::shared_ptr<const InternedLabels> labels,
+                                   SeriesReaderFunc reader)
+    : path_(std::move(path)),
+      labels_(std::move(labels)),
+      reader_(std::move(reader)) {
+  UASSERT(labels_);
+  UASSERT(reader_);
+}
+
+}  // namespace impl
+
 Storage::Storage() : may_register_extenders_(true) {}
 
 formats::json::Value Storage::GetAsJson() const {
@@ -103,7 +177,7 @@ formats::json::Value Storage::GetAsJson() const {
   std::shared_lock lock(mutex_);
 
   for (const auto& entry : metrics_sources_) {
-    if (entry.writer) {
+    if (!entry.extender) {
       continue;
     }
 
@@ -125,8 +199,25 @@ void Storage::VisitMetrics(BaseFormatBuilder& out,
 
     boost::container::small_vector<LabelView, 16> labels_vector;
 
+    const LabelsSpan request_labels{state.add_labels};
+
     std::shared_lock lock(mutex_);
     for (const auto& entry : metrics_sources_) {
+      if (entry.series) {
+        const auto& series = *entry.series;
+        if (!IsSeriesRequested(series, request_labels, request)) continue;
+
+        try {
+          out.HandleSeries(series, request_labels, series.Read());
+        } catch (const std::exception& e) {
+          UASSERT_MSG(false, fmt::format("Failed to write series '{}': {}",
+                                         series.GetPath(), e.what()));
+          LOG_ERROR() << "Failed to write series '" << series.GetPath()
+                      << "': " << e;
+        }
+        continue;
+      }
+
       if (!entry.writer) {
         continue;
       }
@@ -164,13 +255,39 @@ void Storage::StopRegisteringExtenders() { may_register_extenders_ = false; }
 Entry Storage::RegisterWriter(std::string prefix, WriterFunc func,
                               std::vector<Label> add_labels) {
   return DoRegisterExtender(impl::MetricsSource{
-      std::move(prefix), {}, {}, std::move(func), std::move(add_labels)});
+      std::move(prefix), {}, {}, std::move(func), std::move(add_labels), {}});
+}
+
+Entry Storage::RegisterSeries(std::string path, std::vector<Label> labels,
+                              SeriesReaderFunc reader) {
+  UINVARIANT(!path.empty(), "Series path must not be empty");
+  UINVARIANT(reader, "Series reader must not be empty");
+  UASSERT_MSG(may_register_extenders_.load(),
+              "You may not register statistics series outside of component "
+              "constructors");
+
+  std::lock_guard lock(mutex_);
+  auto it = interned_labels_.find(labels);
+  if (it == interned_labels_.end()) {
+    it = interned_labels_
+             .insert(std::make_shared<const impl::InternedLabels>(
+                 std::move(labels)))
+             .first;
+  }
+
+  impl::MetricsSource source;
+  source.prefix_path = path;
+  source.series = std::make_unique<const impl::RegisteredSeries>(
+      std::move(path), *it, std::move(reader));
+  const auto res =
+      metrics_sources_.insert(metrics_sources_.end(), std::move(source));
+  return Entry(Entry::Impl{this, res});
 }
 
 Entry Storage::RegisterExtender(std::string prefix, ExtenderFunc func) {
   auto prefix_split = formats::common::SplitPathString(prefix);
   return DoRegisterExtender(impl::MetricsSource{
-      std::move(prefix), std::move(prefix_split), std::move(func), {}, {}});
+      std::move(prefix), std::move(prefix_split), std::move(func), {}, {}, {}});
 }
 
 Entry Storage::DoRegisterExtender(impl::MetricsSource&& source) {
@@ -194,7 +311,17 @@ void Storage::UnregisterExtender(
       CheckDataUsedByCallbackHasNotBeenDestroyedBeforeUnregistering(*iterator);
     }
   }
+
+  std::shared_ptr<const impl::InternedLabels> labels;
+  if (iterator->series) {
+    labels = iterator->series->GetInternedLabels();
+  }
   metrics_sources_.erase(iterator);
+
+  // the set and `labels` are the only owners left
+  if (labels && labels.use_count() == 2) {
+    interned_labels_.erase(labels);
+  }
 }
 
 }  // namespace utils::statistics
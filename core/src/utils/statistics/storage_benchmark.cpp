@@ -0,0 +1,100 @@
+#include <userver/utils/statistics/storage.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <userver/engine/run_standalone.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/solomon.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kSeriesCount = 100'000;
+constexpr std::size_t kSeriesPerPath = 100;
+
+struct SeriesData final {
+  std::string path;
+  std::string label;
+  std::atomic<std::int64_t> value{0};
+};
+
+std::vector<SeriesData> MakeSeriesData() {
+  std::vector<SeriesData> result(kSeriesCount);
+  for (std::size_t i = 0; i < kSeriesCount; ++i) {
+    result[i].path = "service.handler-" + std::to_string(i / kSeriesPerPath) +
+                     ".requests";
+    result[i].label = "/v1/endpoint/" + std::to_string(i);
+    result[i].value = static_cast<std::int64_t>(i);
+  }
+  return result;
+}
+
+enum class Format { kPrometheus, kSolomon };
+
+void Scrape(const utils::statistics::Storage& storage, Format format) {
+  if (format == Format::kPrometheus) {
+    benchmark::DoNotOptimize(utils::statistics::ToPrometheusFormat(storage));
+  } else {
+    benchmark::DoNotOptimize(utils::statistics::ToSolomonFormat(storage, {}));
+  }
+}
+
+}  // namespace
+
+// kSeriesCount labelled series written by a single writer callback
+void statistics_scrape_writer(benchmark::State& state) {
+  const auto format = static_cast<Format>(state.range(0));
+  engine::RunStandalone([&] {
+    const auto data = MakeSeriesData();
+    utils::statistics::Storage storage;
+    const auto holder = storage.RegisterWriter(
+        {}, [&data](utils::statistics::Writer& writer) {
+          for (const auto& series : data) {
+            writer[series.path].ValueWithLabels(series.value.load(),
+                                                {"endpoint", series.label});
+          }
+        });
+
+    for ([[maybe_unused]] auto _ : state) {
+      Scrape(storage, format);
+    }
+    state.SetItemsProcessed(state.iterations() * kSeriesCount);
+  });
+}
+BENCHMARK(statistics_scrape_writer)
+    ->Arg(static_cast<int>(Format::kPrometheus))
+    ->Arg(static_cast<int>(Format::kSolomon))
+    ->Unit(benchmark::kMillisecond);
+
+// the same kSeriesCount series registered one by one
+void statistics_scrape_registered_series(benchmark::State& state) {
+  const auto format = static_cast<Format>(state.range(0));
+  engine::RunStandalone([&] {
+    const auto data = MakeSeriesData();
+    utils::statistics::Storage storage;
+    std::vector<utils::statistics::Entry> holders;
+    holders.reserve(kSeriesCount);
+    for (const auto& series : data) {
+      holders.push_back(storage.RegisterSeries(
+          series.path, {{"endpoint", series.label}}, [&series] {
+            return utils::statistics::MetricValue{series.value.load()};
+          }));
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+      Scrape(storage, format);
+    }
+    state.SetItemsProcessed(state.iterations() * kSeriesCount);
+  });
+}
+BENCHMARK(statistics_scrape_registered_series)
+    ->Arg(static_cast<int>(Format::kPrometheus))
+    ->Arg(static_cast<int>(Format::kSolomon))
+    ->Unit(benchmark::kMillisecond);
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,11 @@
 #include <userver/utils/statistics/storage.hpp>
 
+#include <atomic>
+
 #include <userver/utest/utest.hpp>
+#include <userver/utils/statistics/json.hpp>
+#include <userver/utils/statistics/prometheus.hpp>
+#include <userver/utils/statistics/solomon.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -14,4 +19,70 @@ UTEST(StatisticsStorage, RegisterExtender) {
   EXPECT_EQ(json["foo"]["bar"]["baz"].As<int>(), 42);
 }
 
+UTEST(StatisticsStorage, RegisterSeriesMatchesWriter) {
+  std::atomic<std::int64_t> value{1};
+
+  utils::statistics::Storage series_storage;
+  auto series_holder = series_storage.RegisterSeries(
+      "foo.bar", {{"a", "x"}, {"b", "y\"z"}},
+      [&value] { return utils::statistics::MetricValue{value.load()}; });
+
+  utils::statistics::Storage writer_storage;
+  auto writer_holder = writer_storage.RegisterWriter(
+      "foo", [&value](utils::statistics::Writer& writer) {
+        writer["bar"].ValueWithLabels(value.load(),
+                                      {{"a", "x"}, {"b", "y\"z"}});
+      });
+
+  for (const auto& request :
+       {utils::statistics::Request{},
+        utils::statistics::Request::MakeWithPrefix("foo",
+                                                   {{"app", "processing"}}),
+        utils::statistics::Request::MakeWithPath("foo.bar", {},
+                                                 {{"a", "x"}})}) {
+    for (int i = 0; i < 2; ++i) {
+      value = i + 10;
+      EXPECT_EQ(utils::statistics::ToPrometheusFormat(series_storage, request),
+                utils::statistics::ToPrometheusFormat(writer_storage, request));
+      EXPECT_EQ(
+          utils::statistics::ToSolomonFormat(series_storage, {}, request),
+          utils::statistics::ToSolomonFormat(writer_storage, {}, request));
+      EXPECT_EQ(utils::statistics::ToJsonFormat(series_storage, request),
+                utils::statistics::ToJsonFormat(writer_storage, request));
+    }
+  }
+
+  EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(series_storage),
+            "foo_bar{a=\"x\",b=\"y'z\"} 11\n");
+}
+
+UTEST(StatisticsStorage, RegisterSeriesFilters) {
+  utils::statistics::Storage storage;
+  auto first = storage.RegisterSeries(
+      "foo.first", {{"a", "x"}},
+      [] { return utils::statistics::MetricValue{std::int64_t{1}}; });
+  auto second = storage.RegisterSeries(
+      "foo.second", {{"a", "y"}},
+      [] { return utils::statistics::MetricValue{std::int64_t{2}}; });
+  auto other = storage.RegisterSeries(
+      "other", {}, [] { return utils::statistics::MetricValue{3.5}; });
+
+  using utils::statistics::Request;
+  EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(
+                storage, Request::MakeWithPrefix("foo")),
+            "foo_first{a=\"x\"} 1\n"
+            "foo_second{a=\"y\"} 2\n");
+  EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(
+                storage, Request::MakeWithPath("other", {{"app", "p"}})),
+            "other{app=\"p\"} 3.5\n");
+  EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(
+                storage, Request::MakeWithPrefix({}, {}, {{"a", "y"}})),
+            "foo_second{a=\"y\"} 2\n");
+
+  second.Unregister();
+  EXPECT_EQ(utils::statistics::ToPrometheusFormatUntyped(storage),
+            "foo_first{a=\"x\"} 1\n"
+            "other{} 3.5\n");
+}
+
 USERVER_NAMESPACE_END
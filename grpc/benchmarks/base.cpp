@@ -1,3 +1,4 @@
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -11,6 +12,10 @@
 #include <userver/utils/algo.hpp>
 #include <userver/utils/fixed_array.hpp>
 
+#include <google/protobuf/arena.h>
+
+#include <tests/nested_messages_client.usrv.pb.hpp>
+#include <tests/nested_messages_service.usrv.pb.hpp>
 #include <tests/unit_test_client.usrv.pb.hpp>
 #include <tests/unit_test_service.usrv.pb.hpp>
 
@@ -104,6 +109,46 @@ void NewClientRepeated(GrpcClientTest& client_factory) {
   }
 }
 
+class NestedMessagesService final
+    : public sample::ugrpc::NestedMessagesServiceBase {
+ public:
+  void Echo(EchoCall& call, sample::ugrpc::NestedMessage&& request) override {
+    call.Finish(request);
+  }
+};
+
+// Serves the calls with the per-call arena of the given initial block size
+class NestedMessagesServer final : public tests::ServiceBase {
+ public:
+  explicit NestedMessagesServer(std::size_t arena_initial_block_size) {
+    SetArenaInitialBlockSize(arena_initial_block_size);
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~NestedMessagesServer() override { StopServer(); }
+
+ private:
+  NestedMessagesService service_;
+};
+
+constexpr std::size_t kArenaInitialBlockSize = 64 * 1024;
+
+sample::ugrpc::NestedMessage MakeNestedMessage() {
+  static constexpr std::size_t kItems = 64;
+  static constexpr std::size_t kValues = 16;
+
+  sample::ugrpc::NestedMessage message;
+  for (std::size_t i = 0; i < kItems; ++i) {
+    auto& item = *message.add_items();
+    item.set_key("key-" + std::to_string(i));
+    for (std::size_t j = 0; j < kValues; ++j) {
+      item.add_values("some reasonably long value " + std::to_string(j));
+    }
+  }
+  return message;
+}
+
 }  // namespace
 
 void UnaryRPC(benchmark::State& state) {
@@ -220,6 +265,39 @@ void BatchOfNewClient(benchmark::State& state) {
 
 BENCHMARK(BatchOfNewClient)->DenseRange(1, 8)->Unit(benchmark::kMillisecond);
 
+// state.range(0) is 0 for heap-allocated messages, 1 for arena-allocated ones
+void UnaryRPCNestedMessage(benchmark::State& state) {
+  const bool use_arena = state.range(0) != 0;
+
+  engine::RunStandalone(2, [&] {
+    NestedMessagesServer server(use_arena ? kArenaInitialBlockSize : 0);
+    auto client =
+        server.MakeClient<sample::ugrpc::NestedMessagesServiceClient>();
+    const auto request = MakeNestedMessage();
+
+    for (auto _ : state) {
+      auto call = client.Echo(request);
+      if (use_arena) {
+        google::protobuf::ArenaOptions options;
+        options.start_block_size = kArenaInitialBlockSize;
+        google::protobuf::Arena arena(options);
+        auto* response = google::protobuf::Arena::CreateMessage<
+            sample::ugrpc::NestedMessage>(&arena);
+        call.FinishAsync(*response).Get();
+        benchmark::DoNotOptimize(response->items_size());
+      } else {
+        const auto response = call.Finish();
+        benchmark::DoNotOptimize(response.items_size());
+      }
+    }
+  });
+}
+
+BENCHMARK(UnaryRPCNestedMessage)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace ugrpc
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,38 @@
+#pragma once
+
+/// @file userver/ugrpc/client/balancer_settings.hpp
+/// @brief @copybrief ugrpc::client::BalancerSettings
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/yaml_config/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+/// @brief Settings of the balancer that spreads the calls of a client over the
+/// channels of an endpoint
+///
+/// The balancer picks the better of two random channels ("power of two
+/// choices"), comparing their in-flight calls count weighted by the EWMA of
+/// their latencies. Channels that fail `consecutive-failures` calls in a row
+/// are ejected for `ejection-time`.
+struct BalancerSettings final {
+  /// Failed calls in a row that eject a channel, 0 to never eject
+  std::size_t consecutive_failures{5};
+
+  /// Time an ejected channel gets no calls
+  std::chrono::milliseconds ejection_time{30'000};
+
+  /// Max percent of the channels of an endpoint that may be ejected at once
+  std::size_t max_ejection_percent{50};
+};
+
+BalancerSettings Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<BalancerSettings>);
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
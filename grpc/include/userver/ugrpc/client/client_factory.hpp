@@ -3,12 +3,14 @@
 /// @file userver/ugrpc/client/client_factory.hpp
 /// @brief @copybrief ugrpc::client::ClientFactory
 
+#include <chrono>
 #include <cstddef>
 
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/security/credentials.h>
 #include <grpcpp/support/channel_arguments.h>
 
+#include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/logging/level.hpp>
@@ -17,9 +19,11 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <userver/ugrpc/client/balancer_settings.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/base.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -48,6 +52,18 @@ struct ClientFactorySettings final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  /// Settings of the balancer over the channels of an endpoint
+  BalancerSettings balancer{};
+
+  /// If set, `host:port` endpoints are resolved with it and `channel_count`
+  /// channels are created per resolved address. Otherwise the endpoints are
+  /// resolved by gRPC.
+  clients::dns::Resolver* resolver{nullptr};
+
+  /// How often the endpoints are re-resolved with `resolver`, the channels of
+  /// an endpoint are recreated if its addresses change
+  std::chrono::milliseconds dns_refresh_interval{std::chrono::seconds{30}};
 };
 
 /// @brief Creates generated gRPC clients. Has a minimal built-in channel cache:
@@ -62,6 +78,16 @@ class ClientFactory final {
                 testsuite::GrpcControl& testsuite_grpc,
                 dynamic_config::Source source);
 
+  /// Calls of the clients are spread over `queues`, the calls made from
+  /// the same thread share a queue
+  ClientFactory(ClientFactorySettings&& settings,
+                engine::TaskProcessor& channel_task_processor,
+                MiddlewareFactories mws,
+                const ugrpc::impl::CompletionQueues& queues,
+                utils::statistics::Storage& statistics_storage,
+                testsuite::GrpcControl& testsuite_grpc,
+                dynamic_config::Source source);
+
   template <typename Client>
   Client MakeClient(const std::string& client_name,
                     const std::string& endpoint);
@@ -70,9 +96,11 @@ class ClientFactory final {
   impl::ChannelCache::Token GetChannel(const std::string& client_name,
                                        const std::string& endpoint);
 
+  void WriteSubchannelStatistics(utils::statistics::Writer& writer);
+
   engine::TaskProcessor& channel_task_processor_;
   MiddlewareFactories mws_;
-  grpc::CompletionQueue& queue_;
+  const ugrpc::impl::CompletionQueues queues_;
   impl::ChannelCache channel_cache_;
   std::unordered_map<std::string, std::unique_ptr<impl::ChannelCache>>
       client_channel_cache_;
@@ -93,7 +121,7 @@ Client ClientFactory::MakeClient(const std::string& client_name,
     mws.push_back(mw_factory->GetMiddleware(client_name));
 
   return Client(impl::ClientParams{
-      client_name, std::move(mws), queue_, statistics,
+      client_name, std::move(mws), queues_, statistics,
       GetChannel(client_name, endpoint), config_source_, testsuite_grpc_});
 }
 
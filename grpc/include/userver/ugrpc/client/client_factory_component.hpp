@@ -33,6 +33,17 @@ namespace ugrpc::client {
 /// service config should be distributed via the name resolution process.
 /// We allow setting default service_config: pass desired JSON literal
 /// to `default-service-config` parameter
+///
+/// ## Load balancing
+/// The calls of a client are spread over the channels of its endpoint by a
+/// "power of two choices" balancer that takes the in-flight calls and the
+/// latencies of the channels into account, see ugrpc::client::BalancerSettings.
+/// With `dns-resolver: async` the endpoints are resolved with
+/// clients::dns::Component and channels are created per resolved address, so
+/// the calls are balanced between the backends. The endpoints are re-resolved
+/// every `dns-refresh-interval`, and the channels and the balancer of an
+/// endpoint are recreated if its addresses change. Per-channel statistics are
+/// written to `grpc.client.subchannels`.
 
 // clang-format off
 
@@ -47,6 +58,11 @@ namespace ugrpc::client {
 /// auth-type | authentication method, see above | -
 /// default-service-config | default service config, see above | -
 /// channel-count | Number of underlying grpc::Channel objects | 1
+/// dns-resolver | endpoints resolver: 'grpc' (built-in gRPC resolver) or 'async' (clients::dns::Component, enables balancing between resolved addresses) | 'grpc'
+/// dns-refresh-interval | how often the endpoints are re-resolved with 'dns-resolver: async' | 30s
+/// balancer.consecutive-failures | failed calls in a row that eject a channel, 0 to never eject | 5
+/// balancer.ejection-time | time an ejected channel gets no calls | 30s
+/// balancer.max-ejection-percent | max percent of the channels of an endpoint ejected at once | 50
 /// middlewares | middlewares names to use | []
 ///
 ///
@@ -103,6 +103,8 @@ class RpcData final {
 
   ugrpc::impl::RpcStatisticsScope& GetStatsScope() noexcept;
 
+  SubchannelLease& GetSubchannel() noexcept;
+
   void SetWritesFinished() noexcept;
 
   bool AreWritesFinished() const noexcept;
@@ -152,6 +154,7 @@ class RpcData final {
   grpc::CompletionQueue& queue_;
   RpcConfigValues config_values_;
   const Middlewares& mws_;
+  SubchannelLease subchannel_;
 
   std::variant<std::monostate, AsyncMethodInvocation,
                FinishAsyncMethodInvocation>
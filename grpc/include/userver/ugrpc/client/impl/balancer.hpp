@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <grpcpp/support/status.h>
+
+#include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <userver/ugrpc/client/balancer_settings.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+/// Picks the channels of an endpoint for the calls, see BalancerSettings
+///
+/// Thread-safe, the statistics of the channels are approximate.
+class Balancer final {
+ public:
+  /// @param addresses address of every channel, used in the statistics
+  Balancer(std::vector<std::string> addresses,
+           const BalancerSettings& settings);
+
+  ~Balancer();
+
+  std::size_t GetSize() const noexcept;
+
+  /// Picks a channel and accounts a call started on it
+  std::size_t Pick() noexcept;
+
+  /// Accounts a call on the channel that has finished, failed calls are the
+  /// ones that are likely caused by the channel itself. Failed calls are
+  /// accounted with a penalty latency, calls without `latency` do not affect
+  /// the latency estimate of the channel.
+  void AccountFinished(std::size_t index,
+                       std::optional<std::chrono::microseconds> latency,
+                       bool is_failure) noexcept;
+
+  /// Accounts a call on the channel that has finished without a result,
+  /// e.g. cancelled
+  void AccountAbandoned(std::size_t index) noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const Balancer& balancer);
+
+ private:
+  struct Subchannel final {
+    std::atomic<std::uint64_t> in_flight{0};
+    std::atomic<std::uint64_t> ewma_latency_us{0};
+    std::atomic<std::size_t> consecutive_failures{0};
+    // steady clock time in ns, 0 if the channel is not ejected
+    std::atomic<std::int64_t> ejected_until{0};
+
+    utils::statistics::RateCounter calls{0};
+    utils::statistics::RateCounter failures{0};
+    utils::statistics::RateCounter ejections{0};
+  };
+
+  bool IsAvailable(Subchannel& subchannel) noexcept;
+  std::uint64_t GetLoad(const Subchannel& subchannel) const noexcept;
+  std::int64_t GetSlowestLatencyUs() const noexcept;
+  void TryEject(Subchannel& subchannel) noexcept;
+
+  const std::vector<std::string> addresses_;
+  const BalancerSettings settings_;
+  const std::size_t max_ejected_;
+  utils::FixedArray<Subchannel> subchannels_;
+  std::atomic<std::size_t> ejected_count_{0};
+};
+
+/// Holds a channel picked for a call and reports the result of the call to the
+/// balancer. The call is accounted as abandoned if no result is reported.
+class SubchannelLease final {
+ public:
+  SubchannelLease() noexcept = default;
+
+  explicit SubchannelLease(std::shared_ptr<Balancer> balancer) noexcept;
+
+  SubchannelLease(SubchannelLease&&) noexcept;
+  SubchannelLease& operator=(SubchannelLease&&) noexcept;
+  ~SubchannelLease();
+
+  std::size_t GetIndex() const noexcept;
+
+  /// The lifetime of a streaming call depends on the messages rather than on
+  /// the channel, so it is not taken as a latency sample
+  void SetStreaming() noexcept;
+
+  void OnFinished(grpc::StatusCode code) noexcept;
+
+  void OnNetworkError() noexcept;
+
+ private:
+  void Release(bool is_failure) noexcept;
+
+  std::shared_ptr<Balancer> balancer_;
+  std::size_t index_{0};
+  std::chrono::steady_clock::time_point started_at_{};
+  bool is_streaming_{false};
+};
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string_view>
 
 #include <grpcpp/client_context.h>
@@ -7,6 +8,7 @@
 
 #include <userver/dynamic_config/snapshot.hpp>
 
+#include <userver/ugrpc/client/impl/balancer.hpp>
 #include <userver/ugrpc/client/impl/client_data.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
 #include <userver/ugrpc/client/qos.hpp>
@@ -24,6 +26,9 @@ struct CallParams {
   std::unique_ptr<grpc::ClientContext> context;
   ugrpc::impl::MethodStatistics& statistics;
   const Middlewares& mws;
+  SubchannelLease subchannel;
+  // The stub for the picked channel, see ClientData::GetStub
+  std::shared_ptr<void> stub;
 };
 
 CallParams DoCreateCallParams(const ClientData&, std::size_t method_id,
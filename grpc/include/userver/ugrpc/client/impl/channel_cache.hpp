@@ -1,27 +1,58 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <grpcpp/channel.h>
 #include <grpcpp/security/credentials.h>
 #include <grpcpp/support/channel_arguments.h>
 
+#include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/variable.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/periodic_task.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <userver/ugrpc/client/balancer_settings.hpp>
+#include <userver/ugrpc/client/impl/balancer.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+/// The channels of an endpoint for one set of its resolved addresses and the
+/// balancer over them. Immutable, replaced as a whole on re-resolution.
+struct ChannelSet final {
+  ChannelSet(std::vector<std::string>&& resolved_targets,
+             const std::shared_ptr<grpc::ChannelCredentials>& credentials,
+             const grpc::ChannelArguments& channel_args, std::size_t count,
+             const BalancerSettings& balancer_settings);
+
+  std::vector<std::string> targets;
+  utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+  std::shared_ptr<Balancer> balancer;
+};
+
 class ChannelCache final {
  public:
+  /// @param resolver if set, `host:port` endpoints are resolved with it and
+  /// the channels are created per resolved address
+  /// @param resolve_interval how often the endpoints are re-resolved with
+  /// `resolver`, the channels are recreated if the addresses change
   ChannelCache(std::shared_ptr<grpc::ChannelCredentials>&& credentials,
                const grpc::ChannelArguments& channel_args,
-               std::size_t channel_count);
+               std::size_t channel_count,
+               clients::dns::Resolver* resolver = nullptr,
+               const BalancerSettings& balancer_settings = {},
+               std::chrono::milliseconds resolve_interval =
+                   std::chrono::seconds{30});
 
   ~ChannelCache();
 
@@ -31,23 +62,36 @@ class ChannelCache final {
   // alive.
   Token Get(const std::string& endpoint);
 
+  /// Writes the statistics of the balancers of the cached endpoints
+  void WriteStatistics(utils::statistics::Writer& writer);
+
  private:
   struct CountedChannel final {
-    CountedChannel(const std::string& endpoint,
-                   const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-                   const grpc::ChannelArguments& channel_args,
-                   std::size_t count);
+    explicit CountedChannel(std::shared_ptr<const ChannelSet>&& channel_set);
 
-    utils::FixedArray<std::shared_ptr<grpc::Channel>> channels;
+    rcu::Variable<std::shared_ptr<const ChannelSet>> channel_set;
     std::uint64_t counter{0};
   };
 
+  std::vector<std::string> ResolveTargets(const std::string& endpoint) const;
+
+  std::optional<std::vector<std::string>> TryResolveTargets(
+      const std::string& endpoint) const;
+
+  std::shared_ptr<const ChannelSet> MakeChannelSet(
+      const std::string& endpoint, std::vector<std::string>&& targets) const;
+
+  void RefreshTargets();
+
   using Map = std::unordered_map<std::string, CountedChannel>;
 
   const std::shared_ptr<grpc::ChannelCredentials> credentials_;
   const grpc::ChannelArguments channel_args_;
   const std::size_t channel_count_;
+  clients::dns::Resolver* const resolver_;
+  const BalancerSettings balancer_settings_;
   concurrent::Variable<Map> channels_;
+  utils::PeriodicTask refresh_task_;
 };
 
 class ChannelCache::Token final {
@@ -62,10 +106,13 @@ class ChannelCache::Token final {
   Token& operator=(Token&&) noexcept;
   ~Token();
 
-  std::size_t GetChannelCount() const noexcept;
+  /// The current channels of the endpoint, they are replaced if the endpoint
+  /// is re-resolved to other addresses
+  std::shared_ptr<const ChannelSet> GetChannelSet() const;
+
+  std::size_t GetChannelCount() const;
 
-  const std::shared_ptr<grpc::Channel>& GetChannel(std::size_t index) const
-      noexcept;
+  std::shared_ptr<grpc::Channel> GetChannel(std::size_t index) const;
 
  private:
   ChannelCache* cache_{nullptr};
@@ -8,13 +8,16 @@
 #include <grpcpp/completion_queue.h>
 
 #include <userver/dynamic_config/source.hpp>
+#include <userver/rcu/rcu.hpp>
 #include <userver/testsuite/grpc_control.hpp>
+#include <userver/ugrpc/client/impl/balancer.hpp>
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 #include <userver/ugrpc/client/middlewares/fwd.hpp>
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/static_metadata.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
-#include <userver/utils/rand.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -23,7 +26,7 @@ namespace ugrpc::client::impl {
 struct ClientParams final {
   std::string client_name;
   Middlewares mws;
-  grpc::CompletionQueue& queue;
+  const ugrpc::impl::CompletionQueues& queues;
   ugrpc::impl::ServiceStatistics& statistics_storage;
   impl::ChannelCache::Token channel_token;
   const dynamic_config::Source config_source;
@@ -41,14 +44,11 @@ class ClientData final {
   template <typename Service>
   ClientData(ClientParams&& params, ugrpc::impl::StaticServiceMetadata metadata,
              std::in_place_type_t<Service>)
-      : params_(std::move(params)), metadata_(metadata) {
-    const std::size_t channel_count = GetChannelToken().GetChannelCount();
-    stubs_ = utils::GenerateFixedArray(channel_count, [&](std::size_t index) {
-      return StubPtr(
-          Service::NewStub(GetChannelToken().GetChannel(index)).release(),
-          &StubDeleter<Service>);
-    });
-  }
+      : params_(std::move(params)),
+        metadata_(metadata),
+        stub_factory_(&MakeStub<Service>),
+        stubs_(std::make_unique<StubsVariable>(
+            MakeStubs(params_.channel_token.GetChannelSet()))) {}
 
   ClientData(ClientData&&) noexcept = default;
   ClientData& operator=(ClientData&&) = delete;
@@ -56,13 +56,25 @@ class ClientData final {
   ClientData(const ClientData&) = delete;
   ClientData& operator=(const ClientData&) = delete;
 
+  /// The channel picked for a new call and the stub of the service for it.
+  /// The stub is only needed to prepare the call.
+  struct Subchannel final {
+    SubchannelLease lease;
+    std::shared_ptr<void> stub;
+  };
+
+  /// Picks the channel for a new call
+  Subchannel PickSubchannel() const;
+
   template <typename Service>
-  Stub<Service>& NextStub() const {
-    return *static_cast<Stub<Service>*>(
-        stubs_[utils::RandRange(stubs_.size())].get());
+  static Stub<Service>& GetStub(const std::shared_ptr<void>& stub) {
+    UASSERT(stub);
+    return *static_cast<Stub<Service>*>(stub.get());
   }
 
-  grpc::CompletionQueue& GetQueue() const { return params_.queue; }
+  grpc::CompletionQueue& GetQueue() const {
+    return params_.queues.GetCurrentThreadQueue();
+  }
 
   dynamic_config::Snapshot GetConfigSnapshot() const {
     return params_.config_source.GetSnapshot();
@@ -87,17 +99,29 @@ class ClientData final {
   }
 
  private:
-  using StubDeleterType = void (*)(void*);
-  using StubPtr = std::unique_ptr<void, StubDeleterType>;
+  using StubPtr = std::shared_ptr<void>;
+  using StubFactory = StubPtr (*)(std::shared_ptr<grpc::Channel>);
+
+  // The stubs for the channels of a ChannelSet
+  struct Stubs final {
+    std::shared_ptr<const ChannelSet> channel_set;
+    utils::FixedArray<StubPtr> stubs;
+  };
+
+  using StubsVariable = rcu::Variable<std::shared_ptr<const Stubs>>;
 
   template <typename Service>
-  static void StubDeleter(void* ptr) noexcept {
-    delete static_cast<Stub<Service>*>(ptr);
+  static StubPtr MakeStub(std::shared_ptr<grpc::Channel> channel) {
+    return Service::NewStub(std::move(channel));
   }
 
+  std::shared_ptr<const Stubs> MakeStubs(
+      std::shared_ptr<const ChannelSet>&& channel_set) const;
+
   ClientParams params_;
   ugrpc::impl::StaticServiceMetadata metadata_;
-  utils::FixedArray<StubPtr> stubs_;
+  StubFactory stub_factory_;
+  std::unique_ptr<StubsVariable> stubs_;
 };
 
 template <typename Client>
@@ -167,6 +167,9 @@ class [[nodiscard]] UnaryCall final : public CallAnyBase {
   ///
   /// `Finish` and `FinishAsync` should not be called together for the same RPC.
   ///
+  /// `response` may be allocated on a google::protobuf::Arena, large nested
+  /// responses are then parsed without per-field heap allocations.
+  ///
   /// @returns the future for the single response
   UnaryFuture FinishAsync(Response& response);
 
@@ -508,6 +511,7 @@ InputStream<Response>::InputStream(
     impl::RawReaderPreparer<Stub, Request, Response> prepare_func,
     const Request& req)
     : CallAnyBase(std::move(params)) {
+  GetData().GetSubchannel().SetStreaming();
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -538,6 +542,7 @@ OutputStream<Request, Response>::OutputStream(
     impl::RawWriterPreparer<Stub, Request, Response> prepare_func)
     : CallAnyBase(std::move(params)),
       final_response_(std::make_unique<Response>()) {
+  GetData().GetSubchannel().SetStreaming();
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
@@ -589,6 +594,7 @@ BidirectionalStream<Request, Response>::BidirectionalStream(
     impl::CallParams&& params, Stub& stub,
     impl::RawReaderWriterPreparer<Stub, Request, Response> prepare_func)
     : CallAnyBase(std::move(params)) {
+  GetData().GetSubchannel().SetStreaming();
   impl::CallMiddlewares(
       GetData().GetMiddlewares(), *this,
       [&] {
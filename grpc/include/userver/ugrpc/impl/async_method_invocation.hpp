@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include <userver/engine/deadline.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 
@@ -7,6 +9,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
+class QueueStatistics;
+
 class EventBase {
  public:
   /// @brief For use from the blocking call queue
@@ -57,8 +61,13 @@ class AsyncMethodInvocation : public EventBase {
   void WaitWhileBusy();
 
  private:
+  void AccountResumeLatency() noexcept;
+
   bool ok_{false};
   bool busy_{false};
+  // written by the queue thread before the event is sent
+  QueueStatistics* queue_statistics_{nullptr};
+  std::chrono::steady_clock::time_point notified_at_{};
   engine::SingleConsumerEvent event_;
 };
 
@@ -10,6 +10,11 @@ namespace ugrpc::impl {
 
 struct CompletionQueues final {
   std::vector<grpc::CompletionQueue*> queues;
+
+  /// @returns the queue of the current thread. Threads are assigned to the
+  /// queues round-robin on first use, so with as many queues as worker
+  /// threads each worker gets a queue of its own.
+  grpc::CompletionQueue& GetCurrentThreadQueue() const noexcept;
 };
 
 }  // namespace ugrpc::impl
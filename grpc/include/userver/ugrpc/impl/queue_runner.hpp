@@ -4,20 +4,30 @@
 
 #include <userver/engine/single_use_event.hpp>
 
+#include <userver/ugrpc/impl/statistics.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
 
 class QueueRunner final {
  public:
-  explicit QueueRunner(grpc::CompletionQueue& queue);
+  /// @param statistics optional statistics of the events of the queue, must
+  /// outlive the QueueRunner
+  explicit QueueRunner(grpc::CompletionQueue& queue,
+                       QueueStatistics* statistics = nullptr);
   ~QueueRunner();
 
  private:
   grpc::CompletionQueue& queue_;
+  QueueStatistics* const statistics_;
   engine::SingleUseEvent completion_;
 };
 
+/// @returns statistics of the queue processed by the current thread, nullptr
+/// outside of the queue threads or if the queue has no statistics
+QueueStatistics* GetCurrentQueueStatistics() noexcept;
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
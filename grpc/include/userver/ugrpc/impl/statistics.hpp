@@ -91,6 +91,23 @@ class ServiceStatistics final {
   utils::FixedArray<MethodStatistics> method_statistics_;
 };
 
+/// Statistics of the events delivered through completion queues
+class QueueStatistics final {
+ public:
+  /// Time from an event popped from the queue to the waiting task resumed
+  void AccountResumeLatency(std::chrono::microseconds latency) noexcept;
+
+  friend void DumpMetric(utils::statistics::Writer& writer,
+                         const QueueStatistics& stats);
+
+ private:
+  using Percentile =
+      utils::statistics::Percentile<2000, std::uint32_t, 256, 100>;
+
+  utils::statistics::RecentPeriod<Percentile, Percentile> resume_latencies_;
+  utils::statistics::RateCounter events_{0};
+};
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string_view>
 #include <unordered_map>
 
@@ -32,6 +33,12 @@ class StatisticsStorage final {
   // gRPC services must not be [un]registered during GetStartedRequests().
   std::uint64_t GetStartedRequests() const;
 
+  using SubchannelsWriter = std::function<void(utils::statistics::Writer&)>;
+
+  // Sets the writer of the statistics of the client channels, they are
+  // written under 'subchannels'.
+  void SetSubchannelsWriter(SubchannelsWriter writer);
+
  private:
   // Pointer to service name from its metadata is used as a unique service ID
   using ServiceId = const char*;
@@ -48,6 +55,7 @@ class StatisticsStorage final {
   std::unordered_map<ServiceId, ugrpc::impl::ServiceStatistics,
                      std::hash<ServiceId>, ServiceIdComparer>
       service_statistics_;
+  SubchannelsWriter subchannels_writer_;
   engine::SharedMutex mutex_;
 
   utils::statistics::Entry statistics_holder_;
@@ -5,6 +5,7 @@
 #include <grpcpp/server_builder.h>
 
 #include <userver/ugrpc/impl/completion_queues.hpp>
+#include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/utils/fast_pimpl.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,7 +18,10 @@ namespace ugrpc::server::impl {
 /// instances are destroyed.
 class QueueHolder final {
  public:
-  explicit QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder);
+  /// @param statistics statistics of the events of all the queues, must
+  /// outlive the QueueHolder
+  QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder,
+              ugrpc::impl::QueueStatistics& statistics);
 
   QueueHolder(QueueHolder&&) = delete;
   QueueHolder& operator=(QueueHolder&&) = delete;
@@ -3,11 +3,13 @@
 #include <chrono>
 #include <exception>
 #include <functional>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include <google/protobuf/arena.h>
 #include <grpcpp/completion_queue.h>
 #include <grpcpp/impl/service_type.h>
 #include <grpcpp/server_context.h>
@@ -100,8 +102,32 @@ class CallData final {
         method_data_(method_data) {
     UASSERT(method_data.method_id <
             method_data.service_data.metadata.method_full_names.size());
+
+    const auto arena_initial_block_size =
+        method_data.service_data.settings.arena_initial_block_size;
+    if (arena_initial_block_size > 0) {
+      // the arena allocates its first block on the first message
+      google::protobuf::ArenaOptions options;
+      options.start_block_size = arena_initial_block_size;
+      arena_.emplace(options);
+    }
+
+    if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
+      if (arena_) {
+        initial_request_ =
+            google::protobuf::Arena::CreateMessage<InitialRequest>(&*arena_);
+        return;
+      }
+    }
+    initial_request_ = &initial_request_storage_.emplace();
   }
 
+  // 'initial_request_' may point into the object itself
+  CallData(const CallData&) = delete;
+  CallData(CallData&&) = delete;
+  CallData& operator=(const CallData&) = delete;
+  CallData& operator=(CallData&&) = delete;
+
   void operator()() && {
     // Based on the tensorflow code, we must first call AsyncNotifyWhenDone
     // and only then Prepare<>
@@ -118,7 +144,7 @@ class CallData final {
         method_data_.queue_num);
 
     method_data_.service_data.async_service.template Prepare<CallTraits>(
-        method_data_.method_id, context_, initial_request_, raw_responder_,
+        method_data_.method_id, context_, *initial_request_, raw_responder_,
         queue, queue, prepare_.GetTag());
 
     // Note: we ignore task cancellations here. Even if notify_when_done has
@@ -174,21 +200,22 @@ class CallData final {
 
     auto& access_tskv_logger =
         method_data_.service_data.settings.access_tskv_logger;
-    Call responder(CallParams{context_, call_name, statistics_scope,
-                              *access_tskv_logger, span_->Get()},
-                   raw_responder_);
+    Call responder(
+        CallParams{context_, call_name, statistics_scope, *access_tskv_logger,
+                   span_->Get(), arena_ ? &*arena_ : nullptr},
+        raw_responder_);
     auto do_call = [&] {
       if constexpr (std::is_same_v<InitialRequest, NoInitialRequest>) {
         (service.*service_method)(responder);
       } else {
-        (service.*service_method)(responder, std::move(initial_request_));
+        (service.*service_method)(responder, std::move(*initial_request_));
       }
     };
 
     try {
       ::google::protobuf::Message* initial_request = nullptr;
       if constexpr (!std::is_same_v<InitialRequest, NoInitialRequest>) {
-        initial_request = &initial_request_;
+        initial_request = initial_request_;
       }
 
       auto& middlewares = method_data_.service_data.settings.middlewares;
@@ -214,8 +241,13 @@ class CallData final {
 
   MethodData<GrpcppService, CallTraits> method_data_;
 
+  // Owns the arena-allocated messages of the call, must outlive them
+  std::optional<google::protobuf::Arena> arena_;
+
   grpc::ServerContext context_{};
-  InitialRequest initial_request_{};
+  // Holds the initial request if the arena is not used
+  std::optional<InitialRequest> initial_request_storage_;
+  InitialRequest* initial_request_{nullptr};
   RawCall raw_responder_{&context_};
   ugrpc::impl::AsyncMethodInvocation prepare_;
   std::optional<tracing::InPlaceSpan> span_{};
@@ -52,6 +52,14 @@ class CallAnyBase {
 
   tracing::Span& GetSpan() { return params_.call_span; }
 
+  /// @returns the per-call protobuf Arena that the request is allocated on,
+  /// or nullptr if `arena-initial-block-size` of the service is 0
+  ///
+  /// Responses and streamed messages of the call may be allocated on it as
+  /// well via `google::protobuf::Arena::CreateMessage`, the arena is destroyed
+  /// after the handler returns.
+  google::protobuf::Arena* GetArena() { return params_.arena; }
+
   virtual bool IsFinished() const = 0;
 
   /// @cond
@@ -19,6 +19,7 @@
 #include <userver/utils/statistics/fwd.hpp>
 #include <userver/yaml_config/fwd.hpp>
 
+#include <userver/ugrpc/impl/completion_queues.hpp>
 #include <userver/ugrpc/impl/statistics.hpp>
 #include <userver/ugrpc/server/middlewares/fwd.hpp>
 #include <userver/ugrpc/server/service_base.hpp>
@@ -89,6 +90,11 @@ class Server final
   /// usually no more than one instance per program.
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  /// @returns all the completion queues of the server, clients may spread
+  /// their calls over them
+  /// @note Same lifetime restrictions as for GetCompletionQueue apply
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
   /// @brief Start accepting requests
   /// @note Must be called at most once after all the services are registered
   void Start();
@@ -3,6 +3,8 @@
 /// @file userver/ugrpc/server/service_base.hpp
 /// @brief @copybrief ugrpc::server::ServiceBase
 
+#include <cstddef>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <userver/ugrpc/server/impl/service_worker.hpp>
@@ -19,6 +21,10 @@ struct ServiceConfig final {
 
   /// Server middlewares to use for the gRPC service.
   Middlewares middlewares;
+
+  /// Initial block size of the per-call protobuf Arena that the requests are
+  /// allocated on, 0 to allocate the requests on the heap.
+  std::size_t arena_initial_block_size{0};
 };
 
 /// @brief The type-erased base class for all gRPC service implementations
@@ -28,6 +28,7 @@ class ServerComponent;
 /// ---- | ----------- | -------------
 /// task-processor | the task processor to use for responses | taken from grpc-server.service-defaults
 /// middlewares | middleware component names to use for each RPC call, can be empty array ([]) | taken from grpc-server.service-defaults
+/// arena-initial-block-size | initial block size of the per-call protobuf Arena that the requests are allocated on, 0 to allocate them on the heap | taken from grpc-server.service-defaults or 0
 
 // clang-format on
 
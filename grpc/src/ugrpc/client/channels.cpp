@@ -3,7 +3,6 @@
 #include <algorithm>
 
 #include <grpcpp/create_channel.h>
-#include <boost/range/irange.hpp>
 
 #include <userver/engine/async.hpp>
 
@@ -49,11 +48,12 @@ namespace {
 [[nodiscard]] bool TryWaitForConnected(
     impl::ChannelCache::Token& token, grpc::CompletionQueue& queue,
     engine::Deadline deadline, engine::TaskProcessor& blocking_task_processor) {
-  auto range = boost::irange(std::size_t{0}, token.GetChannelCount());
-  return std::all_of(range.begin(), range.end(), [&](std::size_t index) {
-    return TryWaitForConnected(*token.GetChannel(index), queue, deadline,
-                               blocking_task_processor);
-  });
+  const auto channel_set = token.GetChannelSet();
+  return std::all_of(channel_set->channels.begin(), channel_set->channels.end(),
+                     [&](const std::shared_ptr<grpc::Channel>& channel) {
+                       return TryWaitForConnected(*channel, queue, deadline,
+                                                  blocking_task_processor);
+                     });
 }
 
 }  // namespace impl
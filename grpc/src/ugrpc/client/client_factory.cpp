@@ -2,12 +2,14 @@
 
 #include <optional>
 #include <stdexcept>
+#include <utility>
 
 #include <fmt/format.h>
 
 #include <userver/engine/async.hpp>
 #include <userver/logging/level_serialization.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/statistics/writer.hpp>
 #include <userver/yaml_config/yaml_config.hpp>
 
 #include <ugrpc/client/impl/client_factory_config.hpp>
@@ -19,6 +21,19 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client {
 
+namespace {
+
+struct ChannelCacheStatistics final {
+  impl::ChannelCache& channel_cache;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const ChannelCacheStatistics& stats) {
+  stats.channel_cache.WriteStatistics(writer);
+}
+
+}  // namespace
+
 ClientFactory::ClientFactory(ClientFactorySettings&& settings,
                              engine::TaskProcessor& channel_task_processor,
                              MiddlewareFactories mws,
@@ -26,13 +41,26 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
                              utils::statistics::Storage& statistics_storage,
                              testsuite::GrpcControl& testsuite_grpc,
                              dynamic_config::Source source)
+    : ClientFactory(std::move(settings), channel_task_processor, std::move(mws),
+                    ugrpc::impl::CompletionQueues{{&queue}},
+                    statistics_storage, testsuite_grpc, source) {}
+
+ClientFactory::ClientFactory(ClientFactorySettings&& settings,
+                             engine::TaskProcessor& channel_task_processor,
+                             MiddlewareFactories mws,
+                             const ugrpc::impl::CompletionQueues& queues,
+                             utils::statistics::Storage& statistics_storage,
+                             testsuite::GrpcControl& testsuite_grpc,
+                             dynamic_config::Source source)
     : channel_task_processor_(channel_task_processor),
       mws_(mws),
-      queue_(queue),
+      queues_(queues),
       channel_cache_(testsuite_grpc.IsTlsEnabled()
                          ? settings.credentials
                          : grpc::InsecureChannelCredentials(),
-                     settings.channel_args, settings.channel_count),
+                     settings.channel_args, settings.channel_count,
+                     settings.resolver, settings.balancer,
+                     settings.dns_refresh_interval),
       client_statistics_storage_(statistics_storage, "client"),
       config_source_(source),
       testsuite_grpc_(testsuite_grpc) {
@@ -45,8 +73,14 @@ ClientFactory::ClientFactory(ClientFactorySettings&& settings,
         std::make_unique<impl::ChannelCache>(
             testsuite_grpc.IsTlsEnabled() ? creds
                                           : grpc::InsecureChannelCredentials(),
-            settings.channel_args, settings.channel_count));
+            settings.channel_args, settings.channel_count, settings.resolver,
+            settings.balancer, settings.dns_refresh_interval));
   }
+
+  client_statistics_storage_.SetSubchannelsWriter(
+      [this](utils::statistics::Writer& writer) {
+        WriteSubchannelStatistics(writer);
+      });
 }
 
 impl::ChannelCache::Token ClientFactory::GetChannel(
@@ -68,6 +102,15 @@ impl::ChannelCache::Token ClientFactory::GetChannel(
       .Get();
 }
 
+void ClientFactory::WriteSubchannelStatistics(
+    utils::statistics::Writer& writer) {
+  channel_cache_.WriteStatistics(writer);
+  for (const auto& [client_name, channel_cache] : client_channel_cache_) {
+    writer.ValueWithLabels(ChannelCacheStatistics{*channel_cache},
+                           {"grpc_client", client_name});
+  }
+}
+
 }  // namespace ugrpc::client
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,6 @@
 #include <userver/ugrpc/client/client_factory_component.hpp>
 
+#include <userver/clients/dns/component.hpp>
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/components/statistics_storage.hpp>
@@ -36,13 +37,13 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto& task_processor =
       context.GetTaskProcessor(config["task-processor"].As<std::string>());
 
-  grpc::CompletionQueue* queue = nullptr;
+  ugrpc::impl::CompletionQueues queues;
   if (auto* const server =
           context.FindComponentOptional<ugrpc::server::ServerComponent>()) {
-    queue = &server->GetServer().GetCompletionQueue();
+    queues = server->GetServer().GetCompletionQueues();
   } else {
     queue_.emplace();
-    queue = &queue_->GetQueue();
+    queues.queues.push_back(&queue_->GetQueue());
   }
 
   auto& statistics_storage =
@@ -63,9 +64,18 @@ ClientFactoryComponent::ClientFactoryComponent(
   auto factory_config = config.As<impl::ClientFactoryConfig>();
 
   const auto* secdist = GetSecdist(context);
-  factory_.emplace(MakeFactorySettings(std::move(factory_config), secdist),
-                   task_processor, mws, *queue, statistics_storage,
-                   testsuite_grpc, config_source);
+  auto factory_settings =
+      MakeFactorySettings(std::move(factory_config), secdist);
+  if (config["dns-resolver"].As<std::string>("grpc") == "async") {
+    factory_settings.resolver =
+        &context.FindComponent<clients::dns::Component>().GetResolver();
+  }
+  factory_settings.dns_refresh_interval =
+      config["dns-refresh-interval"].As<std::chrono::milliseconds>(
+          factory_settings.dns_refresh_interval);
+
+  factory_.emplace(std::move(factory_settings), task_processor, mws, queues,
+                   statistics_storage, testsuite_grpc, config_source);
 }
 
 ClientFactory& ClientFactoryComponent::GetFactory() { return *factory_; }
@@ -118,6 +128,41 @@ properties:
         description: |
             Number of channels created for each endpoint.
         defaultDescription: 1
+    dns-resolver:
+        type: string
+        description: |
+            endpoints resolver, 'async' resolves them with the dns-client
+            component and creates channels per resolved address
+        defaultDescription: grpc
+        enum:
+          - grpc
+          - async
+    dns-refresh-interval:
+        type: string
+        description: |
+            how often the endpoints are re-resolved with 'dns-resolver: async',
+            the channels of an endpoint are recreated if its addresses change
+        defaultDescription: 30s
+    balancer:
+        type: object
+        description: settings of the balancer over the channels of an endpoint
+        additionalProperties: false
+        properties:
+            consecutive-failures:
+                type: integer
+                description: failed calls in a row that eject a channel, 0 to never eject
+                defaultDescription: 5
+                minimum: 0
+            ejection-time:
+                type: string
+                description: time an ejected channel gets no calls
+                defaultDescription: 30s
+            max-ejection-percent:
+                type: integer
+                description: max percent of the channels of an endpoint ejected at once
+                defaultDescription: 50
+                minimum: 0
+                maximum: 100
     middlewares:
         type: array
         items:
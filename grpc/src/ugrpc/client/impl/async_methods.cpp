@@ -93,7 +93,8 @@ RpcData::RpcData(impl::CallParams&& params)
       stats_scope_(params.statistics),
       queue_(params.queue),
       config_values_(params.config),
-      mws_(params.mws) {
+      mws_(params.mws),
+      subchannel_(std::move(params.subchannel)) {
   UASSERT(context_);
   UASSERT(!client_name_.empty());
   SetupSpan(span_, *context_, call_name_);
@@ -161,6 +162,8 @@ ugrpc::impl::RpcStatisticsScope& RpcData::GetStatsScope() noexcept {
   return stats_scope_;
 }
 
+SubchannelLease& RpcData::GetSubchannel() noexcept { return subchannel_; }
+
 void RpcData::SetFinished() noexcept {
   UASSERT(context_);
   UINVARIANT(!is_finished_, "Tried to finish already finished call");
@@ -238,6 +241,7 @@ void CheckOk(RpcData& data, AsyncMethodInvocation::WaitStatus status,
     data.SetFinished();
     data.GetStatsScope().OnNetworkError();
     data.GetStatsScope().Flush();
+    data.GetSubchannel().OnNetworkError();
     SetErrorForSpan(data, fmt::format("Network error at '{}'", stage));
     throw RpcInterruptedError(data.GetCallName(), stage);
   } else if (status == impl::AsyncMethodInvocation::WaitStatus::kCancelled) {
@@ -264,6 +268,7 @@ void ProcessFinishResult(RpcData& data,
               "by gRPC docs, see grpc::CompletionQueue::Next");
   data.GetStatsScope().OnExplicitFinish(status.error_code());
   data.GetStatsScope().Flush();
+  data.GetSubchannel().OnFinished(status.error_code());
 
   if (!status.ok()) {
     SetStatusDetailsForSpan(data, status, parsed_gstatus.gstatus_string);
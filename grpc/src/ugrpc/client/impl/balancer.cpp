@@ -0,0 +1,281 @@
+#include <userver/ugrpc/client/impl/balancer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/rand.hpp>
+#include <userver/utils/statistics/writer.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client {
+
+BalancerSettings Parse(const yaml_config::YamlConfig& value,
+                       formats::parse::To<BalancerSettings>) {
+  BalancerSettings settings;
+  settings.consecutive_failures = value["consecutive-failures"].As<std::size_t>(
+      settings.consecutive_failures);
+  settings.ejection_time = value["ejection-time"].As<std::chrono::milliseconds>(
+      settings.ejection_time);
+  settings.max_ejection_percent = value["max-ejection-percent"].As<std::size_t>(
+      settings.max_ejection_percent);
+  return settings;
+}
+
+namespace impl {
+
+namespace {
+
+// Weight of a new latency sample in the EWMA is 1 / 2^kEwmaShift
+constexpr int kEwmaShift = 3;
+
+// A failed call is accounted as kFailurePenalty times slower than the slowest
+// channel, so that a channel rejecting the calls instantly does not look fast
+constexpr std::int64_t kFailurePenalty = 4;
+constexpr std::int64_t kMaxFailureLatencyUs = 10'000'000;
+
+std::int64_t Now() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+bool IsChannelFailure(grpc::StatusCode code) noexcept {
+  return code == grpc::StatusCode::UNAVAILABLE;
+}
+
+struct SubchannelSnapshot final {
+  std::uint64_t in_flight;
+  std::uint64_t ewma_latency_us;
+  bool is_ejected;
+  utils::statistics::Rate calls;
+  utils::statistics::Rate failures;
+  utils::statistics::Rate ejections;
+};
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const SubchannelSnapshot& snapshot) {
+  writer["in-flight"] = snapshot.in_flight;
+  writer["ewma-latency-us"] = snapshot.ewma_latency_us;
+  writer["ejected"] = snapshot.is_ejected ? 1 : 0;
+  writer["calls"] = snapshot.calls;
+  writer["failures"] = snapshot.failures;
+  writer["ejections"] = snapshot.ejections;
+}
+
+}  // namespace
+
+Balancer::Balancer(std::vector<std::string> addresses,
+                   const BalancerSettings& settings)
+    : addresses_(std::move(addresses)),
+      settings_(settings),
+      max_ejected_(addresses_.size() *
+                   std::min<std::size_t>(settings.max_ejection_percent, 100) /
+                   100),
+      subchannels_(addresses_.size()) {
+  UINVARIANT(!addresses_.empty(), "Balancer requires at least one channel");
+}
+
+Balancer::~Balancer() = default;
+
+std::size_t Balancer::GetSize() const noexcept { return subchannels_.size(); }
+
+std::size_t Balancer::Pick() noexcept {
+  const auto size = subchannels_.size();
+  std::size_t index = 0;
+
+  if (size > 1) {
+    const auto first = utils::RandRange(size);
+    auto second = utils::RandRange(size - 1);
+    if (second >= first) ++second;
+
+    const bool is_first_available = IsAvailable(subchannels_[first]);
+    const bool is_second_available = IsAvailable(subchannels_[second]);
+    if (is_first_available && is_second_available) {
+      index = GetLoad(subchannels_[second]) < GetLoad(subchannels_[first])
+                  ? second
+                  : first;
+    } else if (is_first_available || is_second_available) {
+      index = is_first_available ? first : second;
+    } else {
+      // both are ejected, fall back to any available channel
+      index = first;
+      for (std::size_t i = 0; i < size; ++i) {
+        if (IsAvailable(subchannels_[i])) {
+          index = i;
+          break;
+        }
+      }
+    }
+  }
+
+  subchannels_[index].in_flight.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+void Balancer::AccountFinished(
+    std::size_t index, std::optional<std::chrono::microseconds> latency,
+    bool is_failure) noexcept {
+  UASSERT(index < subchannels_.size());
+  auto& subchannel = subchannels_[index];
+  subchannel.in_flight.fetch_sub(1, std::memory_order_relaxed);
+  ++subchannel.calls;
+
+  if (latency) {
+    auto sample = static_cast<std::int64_t>(latency->count());
+    if (is_failure) {
+      const auto penalty = std::min(GetSlowestLatencyUs() * kFailurePenalty,
+                                    kMaxFailureLatencyUs);
+      sample = std::max(sample, penalty);
+    }
+
+    // concurrent updates may be lost, that is fine for an estimate
+    const auto old = static_cast<std::int64_t>(
+        subchannel.ewma_latency_us.load(std::memory_order_relaxed));
+    const auto updated =
+        old == 0 ? sample : old + ((sample - old) >> kEwmaShift);
+    subchannel.ewma_latency_us.store(
+        static_cast<std::uint64_t>(std::max<std::int64_t>(updated, 1)),
+        std::memory_order_relaxed);
+  }
+
+  if (!is_failure) {
+    subchannel.consecutive_failures.store(0, std::memory_order_relaxed);
+    return;
+  }
+
+  ++subchannel.failures;
+  // keeps trying while the ejection is prevented by max_ejection_percent
+  if (settings_.consecutive_failures != 0 &&
+      subchannel.consecutive_failures.fetch_add(1) + 1 >=
+          settings_.consecutive_failures) {
+    TryEject(subchannel);
+  }
+}
+
+void Balancer::AccountAbandoned(std::size_t index) noexcept {
+  UASSERT(index < subchannels_.size());
+  subchannels_[index].in_flight.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::int64_t Balancer::GetSlowestLatencyUs() const noexcept {
+  std::uint64_t slowest = 0;
+  for (const auto& subchannel : subchannels_) {
+    slowest = std::max(
+        slowest, subchannel.ewma_latency_us.load(std::memory_order_relaxed));
+  }
+  return static_cast<std::int64_t>(slowest);
+}
+
+bool Balancer::IsAvailable(Subchannel& subchannel) noexcept {
+  auto ejected_until = subchannel.ejected_until.load(std::memory_order_relaxed);
+  if (ejected_until == 0) return true;
+  if (Now() < ejected_until) return false;
+
+  // only the one who returns the channel back accounts it
+  if (subchannel.ejected_until.compare_exchange_strong(ejected_until, 0)) {
+    --ejected_count_;
+  }
+  return true;
+}
+
+std::uint64_t Balancer::GetLoad(const Subchannel& subchannel) const noexcept {
+  // channels without latency samples yet are the most attractive ones
+  return (subchannel.in_flight.load(std::memory_order_relaxed) + 1) *
+         subchannel.ewma_latency_us.load(std::memory_order_relaxed);
+}
+
+void Balancer::TryEject(Subchannel& subchannel) noexcept {
+  auto ejected_count = ejected_count_.load();
+  do {
+    if (ejected_count >= max_ejected_) return;
+  } while (!ejected_count_.compare_exchange_weak(ejected_count,
+                                                 ejected_count + 1));
+
+  const auto ejected_until =
+      Now() + std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  settings_.ejection_time)
+                  .count();
+  std::int64_t expected = 0;
+  if (!subchannel.ejected_until.compare_exchange_strong(expected,
+                                                        ejected_until)) {
+    // ejected concurrently
+    --ejected_count_;
+    return;
+  }
+  subchannel.consecutive_failures.store(0, std::memory_order_relaxed);
+  ++subchannel.ejections;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Balancer& balancer) {
+  const auto now = Now();
+  for (std::size_t i = 0; i < balancer.subchannels_.size(); ++i) {
+    const auto& subchannel = balancer.subchannels_[i];
+    const auto ejected_until = subchannel.ejected_until.load();
+    const SubchannelSnapshot snapshot{
+        subchannel.in_flight.load(),
+        subchannel.ewma_latency_us.load(),
+        ejected_until != 0 && now < ejected_until,
+        subchannel.calls.Load(),
+        subchannel.failures.Load(),
+        subchannel.ejections.Load(),
+    };
+    writer.ValueWithLabels(snapshot,
+                           {{"grpc_address", balancer.addresses_[i]},
+                            {"grpc_subchannel", std::to_string(i)}});
+  }
+}
+
+SubchannelLease::SubchannelLease(std::shared_ptr<Balancer> balancer) noexcept
+    : balancer_(std::move(balancer)),
+      index_(balancer_->Pick()),
+      started_at_(std::chrono::steady_clock::now()) {}
+
+SubchannelLease::SubchannelLease(SubchannelLease&& other) noexcept
+    : balancer_(std::move(other.balancer_)),
+      index_(other.index_),
+      started_at_(other.started_at_),
+      is_streaming_(other.is_streaming_) {}
+
+SubchannelLease& SubchannelLease::operator=(SubchannelLease&& other) noexcept {
+  if (this == &other) return *this;
+  if (balancer_) balancer_->AccountAbandoned(index_);
+  balancer_ = std::move(other.balancer_);
+  index_ = other.index_;
+  started_at_ = other.started_at_;
+  is_streaming_ = other.is_streaming_;
+  return *this;
+}
+
+SubchannelLease::~SubchannelLease() {
+  if (balancer_) balancer_->AccountAbandoned(index_);
+}
+
+std::size_t SubchannelLease::GetIndex() const noexcept { return index_; }
+
+void SubchannelLease::SetStreaming() noexcept { is_streaming_ = true; }
+
+void SubchannelLease::OnFinished(grpc::StatusCode code) noexcept {
+  Release(IsChannelFailure(code));
+}
+
+void SubchannelLease::OnNetworkError() noexcept { Release(true); }
+
+void SubchannelLease::Release(bool is_failure) noexcept {
+  if (!balancer_) return;
+  std::optional<std::chrono::microseconds> latency;
+  if (!is_streaming_) {
+    latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - started_at_);
+  }
+  balancer_->AccountFinished(index_, latency, is_failure);
+  balancer_.reset();
+}
+
+}  // namespace impl
+
+}  // namespace ugrpc::client
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,173 @@
+#include <userver/ugrpc/client/impl/balancer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::client::BalancerSettings;
+using ugrpc::client::impl::Balancer;
+using ugrpc::client::impl::SubchannelLease;
+
+std::vector<std::string> MakeAddresses(std::size_t count) {
+  std::vector<std::string> addresses;
+  for (std::size_t i = 0; i < count; ++i) {
+    addresses.push_back("ipv4:127.0.0." + std::to_string(i + 1) + ":8080");
+  }
+  return addresses;
+}
+
+// gives every channel the same latency estimate
+void WarmUp(Balancer& balancer) {
+  for (std::size_t i = 0; i < balancer.GetSize(); ++i) {
+    balancer.AccountFinished(balancer.Pick(), 1ms, false);
+  }
+}
+
+}  // namespace
+
+TEST(GrpcBalancer, SingleChannel) {
+  Balancer balancer{MakeAddresses(1), BalancerSettings{}};
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(balancer.Pick(), 0);
+    balancer.AccountFinished(0, 1ms, true);
+  }
+}
+
+TEST(GrpcBalancer, AvoidsSlowChannel) {
+  Balancer balancer{MakeAddresses(2), BalancerSettings{}};
+  WarmUp(balancer);
+
+  std::array<std::size_t, 2> picks{};
+  for (int i = 0; i < 100; ++i) {
+    const auto index = balancer.Pick();
+    ++picks[index];
+    balancer.AccountFinished(index, index == 0 ? 100ms : 1ms, false);
+  }
+  EXPECT_GT(picks[1], 90);
+}
+
+TEST(GrpcBalancer, PrefersLessLoadedChannel) {
+  Balancer balancer{MakeAddresses(2), BalancerSettings{}};
+  WarmUp(balancer);
+
+  const auto busy = balancer.Pick();
+  for (int i = 0; i < 10; ++i) {
+    const auto index = balancer.Pick();
+    EXPECT_NE(index, busy);
+    balancer.AccountAbandoned(index);
+  }
+  balancer.AccountAbandoned(busy);
+}
+
+TEST(GrpcBalancer, AvoidsFastFailingChannel) {
+  BalancerSettings settings;
+  // the latency estimate alone must keep the failing channel away
+  settings.consecutive_failures = 0;
+  Balancer balancer{MakeAddresses(2), settings};
+  WarmUp(balancer);
+
+  std::array<std::size_t, 2> picks{};
+  for (int i = 0; i < 100; ++i) {
+    const auto index = balancer.Pick();
+    ++picks[index];
+    if (index == 0) {
+      balancer.AccountFinished(index, 1us, true);
+    } else {
+      balancer.AccountFinished(index, 1ms, false);
+    }
+  }
+  EXPECT_GT(picks[1], 90);
+}
+
+TEST(GrpcBalancer, StreamingCallsKeepLatencyEstimate) {
+  const auto balancer =
+      std::make_shared<Balancer>(MakeAddresses(2), BalancerSettings{});
+  WarmUp(*balancer);
+
+  SubchannelLease stream{balancer};
+  stream.SetStreaming();
+  const auto streamed = stream.GetIndex();
+  std::this_thread::sleep_for(10ms);
+  stream.OnFinished(grpc::StatusCode::OK);
+
+  // a long stream would make the channel look 2 times slower otherwise
+  std::array<std::size_t, 2> picks{};
+  for (int i = 0; i < 100; ++i) {
+    const auto index = balancer->Pick();
+    ++picks[index];
+    balancer->AccountFinished(index, 1ms, false);
+  }
+  EXPECT_GT(picks[streamed], 10);
+}
+
+TEST(GrpcBalancer, EjectsFailingChannel) {
+  BalancerSettings settings;
+  settings.consecutive_failures = 3;
+  settings.ejection_time = 1h;
+  Balancer balancer{MakeAddresses(2), settings};
+
+  // one of the channels gets 3 failures in a row
+  for (int i = 0; i < 6; ++i) {
+    balancer.AccountFinished(balancer.Pick(), 1ms, true);
+  }
+
+  const auto alive = balancer.Pick();
+  balancer.AccountAbandoned(alive);
+  for (int i = 0; i < 20; ++i) {
+    const auto index = balancer.Pick();
+    EXPECT_EQ(index, alive);
+    balancer.AccountAbandoned(index);
+  }
+}
+
+TEST(GrpcBalancer, EjectionExpires) {
+  BalancerSettings settings;
+  settings.consecutive_failures = 1;
+  settings.ejection_time = 0ms;
+  Balancer balancer{MakeAddresses(2), settings};
+
+  for (int i = 0; i < 10; ++i) {
+    balancer.AccountFinished(balancer.Pick(), 1ms, true);
+  }
+
+  std::array<std::size_t, 2> picks{};
+  for (int i = 0; i < 100; ++i) {
+    const auto index = balancer.Pick();
+    ++picks[index];
+    balancer.AccountFinished(index, 1ms, false);
+  }
+  EXPECT_GT(picks[0], 0);
+  EXPECT_GT(picks[1], 0);
+}
+
+TEST(GrpcBalancer, MaxEjectionPercent) {
+  BalancerSettings settings;
+  settings.consecutive_failures = 1;
+  settings.ejection_time = 1h;
+  settings.max_ejection_percent = 50;
+  Balancer balancer{MakeAddresses(4), settings};
+
+  for (int i = 0; i < 20; ++i) {
+    balancer.AccountFinished(balancer.Pick(), 1ms, true);
+  }
+
+  // only 2 of the 4 channels may be ejected
+  std::array<std::size_t, 4> picks{};
+  for (int i = 0; i < 200; ++i) {
+    const auto index = balancer.Pick();
+    ++picks[index];
+    balancer.AccountAbandoned(index);
+  }
+  EXPECT_EQ(std::count(picks.begin(), picks.end(), 0), 2);
+}
+
+USERVER_NAMESPACE_END
@@ -7,13 +7,16 @@ namespace ugrpc::client::impl {
 CallParams DoCreateCallParams(const ClientData& client_data,
                               std::size_t method_id,
                               std::unique_ptr<grpc::ClientContext> context) {
+  auto subchannel = client_data.PickSubchannel();
   return CallParams{client_data.GetClientName(),
                     client_data.GetQueue(),
                     client_data.GetConfigSnapshot(),
                     client_data.GetMetadata().method_full_names[method_id],
                     std::move(context),
                     client_data.GetStatistics(method_id),
-                    client_data.GetMiddlewares()};
+                    client_data.GetMiddlewares(),
+                    std::move(subchannel.lease),
+                    std::move(subchannel.stub)};
 }
 
 }  // namespace ugrpc::client::impl
@@ -1,12 +1,21 @@
 #include <userver/ugrpc/client/impl/channel_cache.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <string_view>
 #include <utility>
 
+#include <fmt/format.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/io/sockaddr.hpp>
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/to_string.hpp>
 
@@ -14,6 +23,42 @@ USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::client::impl {
 
+namespace {
+
+constexpr std::chrono::seconds kResolveTimeout{5};
+
+struct HostPort final {
+  std::string host;
+  std::uint16_t port{0};
+};
+
+std::optional<HostPort> SplitHostPort(std::string_view endpoint) {
+  const auto colon = endpoint.rfind(':');
+  if (colon == std::string_view::npos || colon == 0) return std::nullopt;
+
+  // targets with a scheme and IP literals are left to gRPC
+  const auto host = endpoint.substr(0, colon);
+  if (host.find_first_of(":/[") != std::string_view::npos) return std::nullopt;
+
+  try {
+    const auto port =
+        utils::FromString<std::uint16_t>(endpoint.substr(colon + 1));
+    return HostPort{std::string{host}, port};
+  } catch (const std::exception&) {
+    return std::nullopt;
+  }
+}
+
+std::string MakeTarget(engine::io::Sockaddr address, std::uint16_t port) {
+  address.SetPort(port);
+  return fmt::format(
+      "{}:{}",
+      address.Domain() == engine::io::AddrDomain::kInet6 ? "ipv6" : "ipv4",
+      address);
+}
+
+}  // namespace
+
 ChannelCache::Token::Token(ChannelCache& cache, const std::string& endpoint,
                            CountedChannel& counted_channel) noexcept
     : cache_(&cache), endpoint_(&endpoint), counted_channel_(&counted_channel) {
@@ -43,48 +88,174 @@ ChannelCache::Token::~Token() {
   }
 }
 
-const std::shared_ptr<grpc::Channel>& ChannelCache::Token::GetChannel(
-    std::size_t index) const noexcept {
+std::shared_ptr<const ChannelSet> ChannelCache::Token::GetChannelSet() const {
   UASSERT(counted_channel_);
-  UASSERT(index < counted_channel_->channels.size());
-  return counted_channel_->channels[index];
+  return counted_channel_->channel_set.ReadCopy();
 }
 
-std::size_t ChannelCache::Token::GetChannelCount() const noexcept {
-  UASSERT(counted_channel_);
-  return counted_channel_->channels.size();
+std::shared_ptr<grpc::Channel> ChannelCache::Token::GetChannel(
+    std::size_t index) const {
+  const auto channel_set = GetChannelSet();
+  UASSERT(index < channel_set->channels.size());
+  return channel_set->channels[index];
 }
 
-ChannelCache::CountedChannel::CountedChannel(
-    const std::string& endpoint,
+std::size_t ChannelCache::Token::GetChannelCount() const {
+  return GetChannelSet()->channels.size();
+}
+
+ChannelSet::ChannelSet(
+    std::vector<std::string>&& resolved_targets,
     const std::shared_ptr<grpc::ChannelCredentials>& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t count) {
-  const auto endpoint_string = ugrpc::impl::ToGrpcString(endpoint);
-  channels = utils::GenerateFixedArray(count, [&](std::size_t) {
-    return grpc::CreateCustomChannel(endpoint_string, credentials,
-                                     channel_args);
-  });
+    const grpc::ChannelArguments& channel_args, std::size_t count,
+    const BalancerSettings& balancer_settings)
+    : targets(std::move(resolved_targets)) {
+  UASSERT(!targets.empty());
   UASSERT(count > 0);
+
+  std::vector<std::string> addresses;
+  addresses.reserve(targets.size() * count);
+  for (const auto& target : targets) {
+    addresses.insert(addresses.end(), count, target);
+  }
+
+  channels = utils::GenerateFixedArray(addresses.size(), [&](std::size_t i) {
+    return grpc::CreateCustomChannel(ugrpc::impl::ToGrpcString(addresses[i]),
+                                     credentials, channel_args);
+  });
+  balancer =
+      std::make_shared<Balancer>(std::move(addresses), balancer_settings);
 }
 
+ChannelCache::CountedChannel::CountedChannel(
+    std::shared_ptr<const ChannelSet>&& channel_set)
+    : channel_set(std::move(channel_set)) {}
+
 ChannelCache::ChannelCache(
     std::shared_ptr<grpc::ChannelCredentials>&& credentials,
-    const grpc::ChannelArguments& channel_args, std::size_t channel_count)
+    const grpc::ChannelArguments& channel_args, std::size_t channel_count,
+    clients::dns::Resolver* resolver, const BalancerSettings& balancer_settings,
+    std::chrono::milliseconds resolve_interval)
     : credentials_(std::move(credentials)),
       channel_args_(channel_args),
-      channel_count_(channel_count) {
+      channel_count_(channel_count),
+      resolver_(resolver),
+      balancer_settings_(balancer_settings) {
   UINVARIANT(channel_count > 0, "Channels count must be greater than zero");
+  if (resolver_) {
+    refresh_task_.Start("grpc-channels-resolver",
+                        utils::PeriodicTask::Settings{resolve_interval, {}},
+                        [this] { RefreshTargets(); });
+  }
 }
 
-ChannelCache::~ChannelCache() = default;
+ChannelCache::~ChannelCache() { refresh_task_.Stop(); }
 
 ChannelCache::Token ChannelCache::Get(const std::string& endpoint) {
+  {
+    auto channels = channels_.Lock();
+    const auto it = channels->find(endpoint);
+    if (it != channels->end()) return {*this, it->first, it->second};
+  }
+
+  // resolving may take a while, so it is done without the lock
+  auto channel_set = MakeChannelSet(endpoint, ResolveTargets(endpoint));
+
   auto channels = channels_.Lock();
-  const auto [it, _] = channels->try_emplace(endpoint, endpoint, credentials_,
-                                             channel_args_, channel_count_);
+  const auto [it, _] = channels->try_emplace(endpoint, std::move(channel_set));
   return {*this, it->first, it->second};
 }
 
+void ChannelCache::WriteStatistics(utils::statistics::Writer& writer) {
+  const auto channels = channels_.Lock();
+  for (const auto& [endpoint, counted_channel] : *channels) {
+    const auto channel_set = counted_channel.channel_set.Read();
+    writer.ValueWithLabels(*(*channel_set)->balancer,
+                           {"grpc_endpoint", endpoint});
+  }
+}
+
+std::vector<std::string> ChannelCache::ResolveTargets(
+    const std::string& endpoint) const {
+  auto targets = TryResolveTargets(endpoint);
+  if (!targets) return {endpoint};
+  return std::move(*targets);
+}
+
+std::optional<std::vector<std::string>> ChannelCache::TryResolveTargets(
+    const std::string& endpoint) const {
+  if (!resolver_) return std::nullopt;
+
+  const auto host_port = SplitHostPort(endpoint);
+  if (!host_port) return std::nullopt;
+
+  try {
+    const auto addresses = resolver_->Resolve(
+        host_port->host, engine::Deadline::FromDuration(kResolveTimeout));
+
+    std::vector<std::string> targets;
+    targets.reserve(addresses.size());
+    for (const auto& address : addresses) {
+      targets.push_back(MakeTarget(address, host_port->port));
+    }
+    // the order of the addresses does not matter for the balancer
+    std::sort(targets.begin(), targets.end());
+    if (!targets.empty()) return targets;
+  } catch (const std::exception& ex) {
+    LOG_WARNING() << "Failed to resolve gRPC endpoint '" << endpoint
+                  << "': " << ex;
+  }
+  return std::nullopt;
+}
+
+std::shared_ptr<const ChannelSet> ChannelCache::MakeChannelSet(
+    const std::string& endpoint, std::vector<std::string>&& targets) const {
+  auto channel_args = channel_args_;
+  if (targets.size() != 1 || targets.front() != endpoint) {
+    // keep the authority of the endpoint for the per-address channels
+    channel_args.SetString(GRPC_ARG_DEFAULT_AUTHORITY,
+                           ugrpc::impl::ToGrpcString(endpoint));
+  }
+  return std::make_shared<const ChannelSet>(std::move(targets), credentials_,
+                                            channel_args, channel_count_,
+                                            balancer_settings_);
+}
+
+void ChannelCache::RefreshTargets() {
+  std::vector<std::string> endpoints;
+  {
+    const auto channels = channels_.Lock();
+    endpoints.reserve(channels->size());
+    for (const auto& [endpoint, _] : *channels) endpoints.push_back(endpoint);
+  }
+
+  for (const auto& endpoint : endpoints) {
+    // resolving may take a while, so it is done without the lock. The current
+    // channels are kept if the endpoint is not resolved.
+    auto targets = TryResolveTargets(endpoint);
+    if (!targets) continue;
+
+    {
+      const auto channels = channels_.Lock();
+      const auto it = channels->find(endpoint);
+      if (it == channels->end()) continue;
+      const auto channel_set = it->second.channel_set.Read();
+      if ((*channel_set)->targets == *targets) continue;
+    }
+
+    LOG_INFO() << "gRPC endpoint '" << endpoint
+               << "' is resolved to other addresses, recreating its channels";
+    auto channel_set = MakeChannelSet(endpoint, std::move(*targets));
+
+    // the calls in progress keep the previous channels and balancer alive
+    auto channels = channels_.Lock();
+    const auto it = channels->find(endpoint);
+    if (it != channels->end()) {
+      it->second.channel_set.Assign(std::move(channel_set));
+    }
+  }
+}
+
 }  // namespace ugrpc::client::impl
 
 USERVER_NAMESPACE_END
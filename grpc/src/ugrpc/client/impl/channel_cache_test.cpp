@@ -0,0 +1,101 @@
+#include <userver/ugrpc/client/impl/channel_cache.hpp>
+
+#include <grpcpp/security/credentials.h>
+
+#include <userver/clients/dns/config.hpp>
+#include <userver/clients/dns/resolver.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/fs/blocking/temp_file.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/utest/utest.hpp>
+
+using namespace std::chrono_literals;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using ugrpc::client::impl::ChannelCache;
+
+constexpr auto kHosts = "127.0.0.1 grpc-backend\n";
+constexpr auto kScaledHosts =
+    "127.0.0.1 grpc-backend\n127.0.0.2 grpc-backend\n";
+
+constexpr auto kResolveInterval = 10ms;
+
+struct HostsResolver final {
+  HostsResolver()
+      : hosts_file([] {
+          auto file = fs::blocking::TempFile::Create();
+          fs::blocking::RewriteFileContents(file.GetPath(), kHosts);
+          return file;
+        }()),
+        resolver(engine::current_task::GetTaskProcessor(), [this] {
+          clients::dns::ResolverConfig config;
+          config.file_path = hosts_file.GetPath();
+          config.file_update_interval = kResolveInterval;
+          config.network_timeout = utest::kMaxTestWaitTime;
+          return config;
+        }()) {}
+
+  fs::blocking::TempFile hosts_file;
+  clients::dns::Resolver resolver;
+};
+
+ChannelCache MakeChannelCache(clients::dns::Resolver& resolver) {
+  return ChannelCache{grpc::InsecureChannelCredentials(), {},
+                      /*channel_count=*/2, &resolver,
+                      /*balancer_settings=*/{}, kResolveInterval};
+}
+
+}  // namespace
+
+UTEST(GrpcChannelCache, ResolvedEndpoint) {
+  HostsResolver hosts;
+  auto cache = MakeChannelCache(hosts.resolver);
+
+  const auto token = cache.Get("grpc-backend:8080");
+  const auto channel_set = token.GetChannelSet();
+  ASSERT_EQ(channel_set->targets.size(), 1);
+  EXPECT_NE(channel_set->targets.front().find("127.0.0.1:8080"),
+            std::string::npos);
+  EXPECT_EQ(channel_set->channels.size(), 2);
+  EXPECT_EQ(channel_set->balancer->GetSize(), 2);
+}
+
+UTEST(GrpcChannelCache, UnresolvedEndpointIsLeftToGrpc) {
+  HostsResolver hosts;
+  auto cache = MakeChannelCache(hosts.resolver);
+
+  const auto token = cache.Get("unix:/tmp/grpc.sock");
+  const auto channel_set = token.GetChannelSet();
+  ASSERT_EQ(channel_set->targets.size(), 1);
+  EXPECT_EQ(channel_set->targets.front(), "unix:/tmp/grpc.sock");
+}
+
+UTEST(GrpcChannelCache, ReresolvesEndpoint) {
+  HostsResolver hosts;
+  auto cache = MakeChannelCache(hosts.resolver);
+
+  const auto token = cache.Get("grpc-backend:8080");
+  const auto initial = token.GetChannelSet();
+  ASSERT_EQ(initial->targets.size(), 1);
+
+  fs::blocking::RewriteFileContents(hosts.hosts_file.GetPath(), kScaledHosts);
+  const auto deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+  while (token.GetChannelSet() == initial && !deadline.IsReached()) {
+    engine::SleepFor(kResolveInterval);
+  }
+
+  const auto scaled = token.GetChannelSet();
+  ASSERT_EQ(scaled->targets.size(), 2);
+  EXPECT_EQ(scaled->channels.size(), 4);
+  EXPECT_EQ(scaled->balancer->GetSize(), 4);
+  EXPECT_NE(scaled->balancer, initial->balancer);
+
+  // the same addresses keep the channels
+  engine::SleepFor(kResolveInterval * 5);
+  EXPECT_EQ(token.GetChannelSet(), scaled);
+}
+
+USERVER_NAMESPACE_END
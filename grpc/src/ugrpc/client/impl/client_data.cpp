@@ -0,0 +1,37 @@
+#include <userver/ugrpc/client/impl/client_data.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::client::impl {
+
+ClientData::Subchannel ClientData::PickSubchannel() const {
+  auto stubs = stubs_->ReadCopy();
+  auto channel_set = params_.channel_token.GetChannelSet();
+  if (stubs->channel_set != channel_set) {
+    // the endpoint is re-resolved, concurrent callers may recreate the stubs
+    // too, the stubs of the latest ChannelSet win eventually
+    stubs = MakeStubs(std::move(channel_set));
+    stubs_->Assign(stubs);
+  }
+
+  SubchannelLease lease{stubs->channel_set->balancer};
+  const auto index = lease.GetIndex();
+  UASSERT(index < stubs->stubs.size());
+  // the stub keeps its ChannelSet alive till the call is prepared
+  return {std::move(lease), StubPtr(stubs, stubs->stubs[index].get())};
+}
+
+std::shared_ptr<const ClientData::Stubs> ClientData::MakeStubs(
+    std::shared_ptr<const ChannelSet>&& channel_set) const {
+  UASSERT(channel_set);
+  auto stubs = utils::GenerateFixedArray(
+      channel_set->channels.size(), [&](std::size_t index) {
+        return stub_factory_(channel_set->channels[index]);
+      });
+  return std::make_shared<const Stubs>(
+      Stubs{std::move(channel_set), std::move(stubs)});
+}
+
+}  // namespace ugrpc::client::impl
+
+USERVER_NAMESPACE_END
@@ -68,6 +68,7 @@ ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
       value["native-log-level"].As<logging::Level>(config.native_log_level);
   config.channel_count =
       value["channel-count"].As<std::size_t>(config.channel_count);
+  config.balancer = value["balancer"].As<BalancerSettings>(config.balancer);
 
   return config;
 }
@@ -95,6 +96,7 @@ ClientFactorySettings MakeFactorySettings(
       config.channel_args,
       config.native_log_level,
       config.channel_count,
+      config.balancer,
   };
 }
 
@@ -26,6 +26,8 @@ struct ClientFactoryConfig final {
   /// Number of underlying channels that will be created for every client
   /// in this factory.
   std::size_t channel_count{1};
+
+  BalancerSettings balancer{};
 };
 
 ClientFactoryConfig Parse(const yaml_config::YamlConfig& value,
@@ -2,6 +2,8 @@
 
 #include <userver/engine/task/cancel.hpp>
 
+#include <userver/ugrpc/impl/queue_runner.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace ugrpc::impl {
@@ -12,6 +14,8 @@ AsyncMethodInvocation::~AsyncMethodInvocation() { WaitWhileBusy(); }
 
 void AsyncMethodInvocation::Notify(bool ok) noexcept {
   ok_ = ok;
+  queue_statistics_ = GetCurrentQueueStatistics();
+  if (queue_statistics_) notified_at_ = std::chrono::steady_clock::now();
   event_.Send();
 }
 
@@ -43,6 +47,7 @@ AsyncMethodInvocation::WaitStatus AsyncMethodInvocation::WaitUntil(
   }
 
   busy_ = false;
+  AccountResumeLatency();
   return ok_ ? WaitStatus::kOk : WaitStatus::kError;
 }
 
@@ -50,6 +55,14 @@ bool AsyncMethodInvocation::IsReady() const noexcept {
   return event_.IsReady();
 }
 
+void AsyncMethodInvocation::AccountResumeLatency() noexcept {
+  if (!queue_statistics_) return;
+  queue_statistics_->AccountResumeLatency(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - notified_at_));
+  queue_statistics_ = nullptr;
+}
+
 void AsyncMethodInvocation::WaitWhileBusy() {
   if (busy_) {
     engine::TaskCancellationBlocker blocker;
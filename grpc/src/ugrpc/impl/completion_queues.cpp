@@ -0,0 +1,31 @@
+#include <userver/ugrpc/impl/completion_queues.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace ugrpc::impl {
+
+namespace {
+
+std::size_t GetCurrentThreadIndex() noexcept {
+  static std::atomic<std::size_t> threads_count{0};
+  thread_local const std::size_t index = threads_count++;
+  return index;
+}
+
+}  // namespace
+
+grpc::CompletionQueue& CompletionQueues::GetCurrentThreadQueue()
+    const noexcept {
+  UASSERT(!queues.empty());
+  if (queues.size() == 1) return *queues.front();
+  return *queues[GetCurrentThreadIndex() % queues.size()];
+}
+
+}  // namespace ugrpc::impl
+
+USERVER_NAMESPACE_END
@@ -13,9 +13,12 @@ namespace ugrpc::impl {
 
 namespace {
 
-void ProcessQueue(grpc::CompletionQueue& queue,
+thread_local QueueStatistics* current_queue_statistics = nullptr;
+
+void ProcessQueue(grpc::CompletionQueue& queue, QueueStatistics* statistics,
                   engine::SingleUseEvent& completion) noexcept {
   utils::SetCurrentThreadName("grpc-queue");
+  current_queue_statistics = statistics;
 
   void* tag = nullptr;
   bool ok = false;
@@ -31,8 +34,12 @@ void ProcessQueue(grpc::CompletionQueue& queue,
 
 }  // namespace
 
-QueueRunner::QueueRunner(grpc::CompletionQueue& queue) : queue_(queue) {
-  std::thread([this] { ProcessQueue(queue_, completion_); }).detach();
+QueueRunner::QueueRunner(grpc::CompletionQueue& queue,
+                         QueueStatistics* statistics)
+    : queue_(queue), statistics_(statistics) {
+  std::thread([this] {
+    ProcessQueue(queue_, statistics_, completion_);
+  }).detach();
 }
 
 QueueRunner::~QueueRunner() {
@@ -40,6 +47,10 @@ QueueRunner::~QueueRunner() {
   completion_.WaitNonCancellable();
 }
 
+QueueStatistics* GetCurrentQueueStatistics() noexcept {
+  return current_queue_statistics;
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
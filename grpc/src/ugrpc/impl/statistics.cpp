@@ -165,6 +165,18 @@ void DumpMetric(utils::statistics::Writer& writer,
   }
 }
 
+void QueueStatistics::AccountResumeLatency(
+    std::chrono::microseconds latency) noexcept {
+  resume_latencies_.GetCurrentCounter().Account(latency.count());
+  ++events_;
+}
+
+void DumpMetric(utils::statistics::Writer& writer,
+                const QueueStatistics& stats) {
+  writer["resume-latency-us"] = stats.resume_latencies_;
+  writer["events"] = stats.events_;
+}
+
 }  // namespace ugrpc::impl
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,7 @@
 #include <userver/ugrpc/impl/statistics_storage.hpp>
 
+#include <utility>
+
 #include <fmt/format.h>
 
 #include <userver/utils/algo.hpp>
@@ -50,6 +52,15 @@ void StatisticsStorage::ExtendStatistics(utils::statistics::Writer& writer) {
       by_destination = service_stats;
     }
   }
+  if (subchannels_writer_) {
+    auto subchannels = writer["subchannels"];
+    subchannels_writer_(subchannels);
+  }
+}
+
+void StatisticsStorage::SetSubchannelsWriter(SubchannelsWriter writer) {
+  std::lock_guard lock(mutex_);
+  subchannels_writer_ = std::move(writer);
 }
 
 std::uint64_t StatisticsStorage::GetStartedRequests() const {
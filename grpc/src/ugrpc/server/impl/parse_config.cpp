@@ -2,6 +2,8 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <userver/engine/task/task_base.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/logging/component.hpp>
 #include <userver/logging/level_serialization.hpp>
 #include <userver/logging/null_logger.hpp>
@@ -17,6 +19,8 @@ namespace {
 
 constexpr std::string_view kTaskProcessorKey = "task-processor";
 constexpr std::string_view kMiddlewaresKey = "middlewares";
+constexpr std::string_view kArenaInitialBlockSizeKey =
+    "arena-initial-block-size";
 
 template <typename ParserFunc>
 auto ParseOptional(const yaml_config::YamlConfig& service_field,
@@ -53,6 +57,24 @@ std::vector<std::string> ParseMiddlewares(
   return field.As<std::vector<std::string>>();
 }
 
+std::size_t ParseArenaInitialBlockSize(
+    const yaml_config::YamlConfig& field,
+    const components::ComponentContext& /*context*/) {
+  return field.As<std::size_t>(0);
+}
+
+// The services usually run on the default task processor, so the queues are
+// matched to its workers
+int GetServicesWorkerCount(const yaml_config::YamlConfig& service_defaults,
+                           const components::ComponentContext& context) {
+  const auto& task_processor_field = service_defaults[kTaskProcessorKey];
+  auto& task_processor =
+      task_processor_field.IsMissing()
+          ? engine::current_task::GetTaskProcessor()
+          : ParseTaskProcessor(task_processor_field, context);
+  return static_cast<int>(engine::GetWorkerCount(task_processor));
+}
+
 Middlewares FindMiddlewares(const std::vector<std::string>& names,
                             const components::ComponentContext& context) {
   return utils::AsContainer<Middlewares>(
@@ -72,6 +94,9 @@ ServiceDefaults ParseServiceDefaults(
                                        ParseTaskProcessor),
       /*middleware_names=*/
       ParseOptional(value[kMiddlewaresKey], context, ParseMiddlewares),
+      /*arena_initial_block_size=*/
+      ParseOptional(value[kArenaInitialBlockSizeKey], context,
+                    ParseArenaInitialBlockSize),
   };
 }
 
@@ -88,6 +113,10 @@ server::ServiceConfig ParseServiceConfig(
           MergeField(value[kMiddlewaresKey], defaults.middleware_names, context,
                      ParseMiddlewares),
           context),
+      /*arena_initial_block_size=*/
+      MergeField(value[kArenaInitialBlockSizeKey],
+                 defaults.arena_initial_block_size, context,
+                 ParseArenaInitialBlockSize),
   };
 }
 
@@ -96,6 +125,10 @@ ServerConfig ParseServerConfig(const yaml_config::YamlConfig& value,
   ServerConfig config;
   config.port = value["port"].As<std::optional<int>>();
   config.completion_queue_num = value["completion-queue-count"].As<int>(2);
+  if (value["completion-queue-per-worker"].As<bool>(false)) {
+    config.completion_queue_num =
+        GetServicesWorkerCount(value["service-defaults"], context);
+  }
   config.channel_args =
       value["channel-args"].As<decltype(config.channel_args)>({});
   config.native_log_level =
@@ -15,19 +15,22 @@ namespace ugrpc::server::impl {
 namespace {
 
 struct QueueSubHolder final {
-  explicit QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue)
-      : queue(std::move(queue)) {}
+  QueueSubHolder(std::unique_ptr<grpc::ServerCompletionQueue> queue,
+                 ugrpc::impl::QueueStatistics& statistics)
+      : queue(std::move(queue)), queue_runner(*this->queue, &statistics) {}
 
   std::unique_ptr<grpc::ServerCompletionQueue> queue;
-  ugrpc::impl::QueueRunner queue_runner{*queue};
+  ugrpc::impl::QueueRunner queue_runner;
 };
 
 }  // namespace
 
 struct QueueHolder::Impl final {
-  explicit Impl(std::size_t num, grpc::ServerBuilder& server_builder)
-      : queue(utils::GenerateFixedArray(num, [&server_builder](size_t) {
-          return QueueSubHolder(server_builder.AddCompletionQueue());
+  Impl(std::size_t num, grpc::ServerBuilder& server_builder,
+       ugrpc::impl::QueueStatistics& statistics)
+      : queue(utils::GenerateFixedArray(num, [&](size_t) {
+          return QueueSubHolder(server_builder.AddCompletionQueue(),
+                                statistics);
         })) {
     for (auto& subholder : queue)
       queues.queues.push_back(subholder.queue.get());
@@ -37,8 +40,9 @@ struct QueueHolder::Impl final {
   ugrpc::impl::CompletionQueues queues;
 };
 
-QueueHolder::QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder)
-    : impl_(num, server_builder) {}
+QueueHolder::QueueHolder(std::size_t num, grpc::ServerBuilder& server_builder,
+                         ugrpc::impl::QueueStatistics& statistics)
+    : impl_(num, server_builder, statistics) {}
 
 QueueHolder::~QueueHolder() = default;
 
@@ -15,6 +15,7 @@ struct ServiceDefaults final {
   // using boost::optional to easily generalize to references
   boost::optional<engine::TaskProcessor&> task_processor;
   boost::optional<std::vector<std::string>> middleware_names;
+  boost::optional<std::size_t> arena_initial_block_size;
 };
 
 }  // namespace ugrpc::server::impl
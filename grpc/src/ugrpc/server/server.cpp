@@ -16,6 +16,8 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/fixed_array.hpp>
+#include <userver/utils/statistics/storage.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
 #include <ugrpc/impl/logging.hpp>
 #include <ugrpc/impl/to_string.hpp>
@@ -82,6 +84,8 @@ class Server::Impl final {
 
   grpc::CompletionQueue& GetCompletionQueue() noexcept;
 
+  const ugrpc::impl::CompletionQueues& GetCompletionQueues() noexcept;
+
   void Start();
 
   int GetPort() const noexcept;
@@ -107,6 +111,9 @@ class Server::Impl final {
   std::optional<grpc::ServerBuilder> server_builder_;
   std::optional<int> port_;
   std::vector<std::unique_ptr<impl::ServiceWorker>> service_workers_;
+  // must outlive queue_
+  ugrpc::impl::QueueStatistics queue_statistics_;
+  utils::statistics::Entry queue_statistics_holder_;
   std::optional<impl::QueueHolder> queue_;
   std::unique_ptr<grpc::Server> server_;
   mutable engine::Mutex configuration_mutex_;
@@ -135,7 +142,12 @@ Server::Impl::Impl(ServerConfig&& config,
   server_builder_.emplace();
   ApplyChannelArgs(*server_builder_, config);
   queue_.emplace(static_cast<std::size_t>(config.completion_queue_num),
-                 std::ref(*server_builder_));
+                 std::ref(*server_builder_), std::ref(queue_statistics_));
+  queue_statistics_holder_ = statistics_storage.RegisterWriter(
+      "grpc.completion-queues",
+      [this](utils::statistics::Writer& writer) {
+        writer = queue_statistics_;
+      });
 
   if (config.port) AddListeningPort(*config.port);
 }
@@ -174,6 +186,7 @@ void Server::Impl::AddService(ServiceBase& service, ServiceConfig&& config) {
       std::move(config.middlewares),
       access_tskv_logger_,
       config_source_,
+      config.arena_initial_block_size,
   }));
 }
 
@@ -202,6 +215,12 @@ grpc::CompletionQueue& Server::Impl::GetCompletionQueue() noexcept {
   return *queue_->GetQueues().queues[0];
 }
 
+const ugrpc::impl::CompletionQueues&
+Server::Impl::GetCompletionQueues() noexcept {
+  UASSERT(state_ == State::kConfiguration || state_ == State::kActive);
+  return queue_->GetQueues();
+}
+
 void Server::Impl::Start() {
   std::lock_guard lock(configuration_mutex_);
   UASSERT(state_ == State::kConfiguration);
@@ -300,6 +319,10 @@ grpc::CompletionQueue& Server::GetCompletionQueue() noexcept {
   return impl_->GetCompletionQueue();
 }
 
+const ugrpc::impl::CompletionQueues& Server::GetCompletionQueues() noexcept {
+  return impl_->GetCompletionQueues();
+}
+
 void Server::Start() { return impl_->Start(); }
 
 int Server::GetPort() const noexcept { return impl_->GetPort(); }
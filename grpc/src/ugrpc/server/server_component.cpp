@@ -51,6 +51,12 @@ properties:
             completion queue count to create. Should be ~2 times less than worker
             threads for best RPS.
         minimum: 1
+    completion-queue-per-worker:
+        type: boolean
+        description: |
+            create a completion queue per worker thread of the service-defaults
+            task processor, overrides completion-queue-count
+        defaultDescription: false
     channel-args:
         type: object
         description: a map of channel arguments, see gRPC Core docs
@@ -91,6 +97,10 @@ properties:
                 items:
                     type: string
                     description: middleware component name
+            arena-initial-block-size:
+                type: integer
+                description: initial block size of the per-call protobuf Arena, 0 to allocate requests on the heap
+                minimum: 0
 )");
 }
 
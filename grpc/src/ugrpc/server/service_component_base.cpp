@@ -42,6 +42,11 @@ properties:
         items:
             type: string
             description: middleware component name
+    arena-initial-block-size:
+        type: integer
+        description: initial block size of the per-call protobuf Arena, 0 to allocate requests on the heap
+        defaultDescription: uses grpc-server.service-defaults.arena-initial-block-size
+        minimum: 0
 )");
 }
 
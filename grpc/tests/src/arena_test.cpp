@@ -0,0 +1,96 @@
+#include <userver/utest/utest.hpp>
+
+#include <google/protobuf/arena.h>
+
+#include <tests/unit_test_client.usrv.pb.hpp>
+#include <tests/unit_test_service.usrv.pb.hpp>
+#include <userver/ugrpc/tests/service.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr std::size_t kArenaInitialBlockSize = 4096;
+
+class ArenaCheckingService final : public sample::ugrpc::UnitTestServiceBase {
+ public:
+  void SayHello(SayHelloCall& call,
+                sample::ugrpc::GreetingRequest&& request) override {
+    auto* arena = call.GetArena();
+    EXPECT_EQ(request.GetArena(), arena);
+
+    sample::ugrpc::GreetingResponse heap_response;
+    auto* response =
+        arena ? google::protobuf::Arena::CreateMessage<
+                    sample::ugrpc::GreetingResponse>(arena)
+              : &heap_response;
+    response->set_name(arena ? "arena" : "heap");
+    call.Finish(*response);
+  }
+
+  void ReadMany(ReadManyCall& call,
+                sample::ugrpc::StreamGreetingRequest&& request) override {
+    EXPECT_EQ(request.GetArena(), call.GetArena());
+
+    sample::ugrpc::StreamGreetingResponse response;
+    for (int i = 0; i < request.number(); ++i) {
+      response.set_number(i);
+      call.Write(response);
+    }
+    call.Finish();
+  }
+};
+
+class GrpcArena : public ugrpc::tests::ServiceBase {
+ protected:
+  void Start(std::size_t arena_initial_block_size) {
+    SetArenaInitialBlockSize(arena_initial_block_size);
+    RegisterService(service_);
+    StartServer();
+  }
+
+  ~GrpcArena() override { StopServer(); }
+
+ private:
+  ArenaCheckingService service_;
+};
+
+std::string SayHello(sample::ugrpc::UnitTestServiceClient& client) {
+  sample::ugrpc::GreetingRequest request;
+  request.set_name("userver");
+  return client.SayHello(request).Finish().name();
+}
+
+}  // namespace
+
+UTEST_F(GrpcArena, Disabled) {
+  Start(0);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  EXPECT_EQ(SayHello(client), "heap");
+}
+
+UTEST_F(GrpcArena, UnaryCall) {
+  Start(kArenaInitialBlockSize);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  EXPECT_EQ(SayHello(client), "arena");
+  EXPECT_EQ(SayHello(client), "arena");
+}
+
+UTEST_F(GrpcArena, OutputStream) {
+  Start(kArenaInitialBlockSize);
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+
+  sample::ugrpc::StreamGreetingRequest request;
+  request.set_number(3);
+  auto call = client.ReadMany(request);
+
+  sample::ugrpc::StreamGreetingResponse response;
+  int count = 0;
+  while (call.Read(response)) {
+    EXPECT_EQ(response.number(), count);
+    ++count;
+  }
+  EXPECT_EQ(count, 3);
+}
+
+USERVER_NAMESPACE_END
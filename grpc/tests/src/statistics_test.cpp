@@ -108,6 +108,22 @@ UTEST_F(GrpcStatistics, StatsBeforeGet) {
   GetServer().StopDebug();
 }
 
+UTEST_F(GrpcStatistics, CompletionQueues) {
+  auto client = MakeClient<sample::ugrpc::UnitTestServiceClient>();
+  sample::ugrpc::GreetingRequest out;
+  out.set_name("userver");
+  UEXPECT_THROW(client.SayHello(out).Finish(),
+                ugrpc::client::InvalidArgumentError);
+  GetServer().StopDebug();
+
+  // both the client and the server events go through the server queues
+  const auto stats = GetStatistics("grpc.completion-queues");
+  EXPECT_GT(stats.SingleMetric("events").AsRate(), 1);
+  EXPECT_GE(
+      stats.SingleMetric("resume-latency-us", {{"percentile", "p100"}}).AsInt(),
+      0);
+}
+
 UTEST_F_MT(GrpcStatistics, Multithreaded, 2) {
   constexpr int kIterations = 10;
 
@@ -52,6 +52,9 @@ class ServiceBase {
   void AddClientMiddleware(
       std::shared_ptr<const client::MiddlewareFactoryBase> middleware_factory);
 
+  /// Per-call arena of the services can be enabled before RegisterService
+  void SetArenaInitialBlockSize(std::size_t arena_initial_block_size);
+
   void ExtendDynamicConfig(const std::vector<dynamic_config::KeyValue>&);
 
   utils::statistics::Storage& GetStatisticsStorage() {
@@ -65,6 +68,7 @@ class ServiceBase {
   server::Middlewares server_middlewares_;
   client::MiddlewareFactories middleware_factories_;
   bool adding_middlewares_allowed_{true};
+  std::size_t arena_initial_block_size_{0};
   testsuite::GrpcControl testsuite_;
   std::optional<std::string> endpoint_;
   std::optional<client::ClientFactory> client_factory_;
@@ -51,6 +51,7 @@ void ServiceBase::RegisterService(server::ServiceBase& service) {
   server_.AddService(service, server::ServiceConfig{
                                   engine::current_task::GetTaskProcessor(),
                                   server_middlewares_,
+                                  arena_initial_block_size_,
                               });
 }
 
@@ -61,7 +62,7 @@ void ServiceBase::StartServer(
   endpoint_ = fmt::format("[::1]:{}", server_.GetPort());
   client_factory_.emplace(std::move(client_factory_settings),
                           engine::current_task::GetTaskProcessor(),
-                          middleware_factories_, server_.GetCompletionQueue(),
+                          middleware_factories_, server_.GetCompletionQueues(),
                           statistics_storage_, testsuite_,
                           config_storage_.GetSource());
 }
@@ -72,6 +73,11 @@ void ServiceBase::StopServer() noexcept {
   server_.Stop();
 }
 
+void ServiceBase::SetArenaInitialBlockSize(
+    std::size_t arena_initial_block_size) {
+  arena_initial_block_size_ = arena_initial_block_size;
+}
+
 void ServiceBase::ExtendDynamicConfig(
     const std::vector<dynamic_config::KeyValue>& overrides) {
   config_storage_.Extend(overrides);
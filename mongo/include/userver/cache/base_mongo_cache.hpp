@@ -4,6 +4,10 @@
 /// @brief @copybrief components::MongoCache
 
 #include <chrono>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -11,6 +15,7 @@
 #include <userver/cache/caching_component_base.hpp>
 #include <userver/cache/mongo_cache_type_traits.hpp>
 #include <userver/components/component_context.hpp>
+#include <userver/engine/task/task_with_result.hpp>
 #include <userver/formats/bson/document.hpp>
 #include <userver/formats/bson/inline.hpp>
 #include <userver/formats/bson/value_builder.hpp>
@@ -18,6 +23,7 @@
 #include <userver/storages/mongo/operations.hpp>
 #include <userver/storages/mongo/options.hpp>
 #include <userver/tracing/span.hpp>
+#include <userver/utils/async.hpp>
 #include <userver/utils/cpu_relax.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
@@ -34,8 +40,162 @@ namespace impl {
 
 std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 
+struct MongoCacheParseSettings final {
+  std::size_t chunk_size{0};
+  std::size_t max_chunks_in_flight{4};
+  engine::TaskProcessor* task_processor{nullptr};
+};
+
+MongoCacheParseSettings GetMongoCacheParseSettings(const ComponentConfig&,
+                                                   const ComponentContext&);
+
+template <class MongoCacheTraits>
+typename MongoCacheTraits::ObjectType DeserializeObject(
+    const formats::bson::Document& doc) {
+  if constexpr (mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits>) {
+    return MongoCacheTraits::DeserializeObject(doc);
+  }
+  if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
+                    MongoCacheTraits>) {
+    return doc.As<typename MongoCacheTraits::ObjectType>();
+  }
+  UASSERT_MSG(false,
+              "No deserialize operation defined but DeserializeObject invoked");
+}
+
+template <class MongoCacheTraits>
+std::optional<typename MongoCacheTraits::ObjectType> TryDeserializeObject(
+    const formats::bson::Document& doc,
+    cache::UpdateStatisticsScope& stats_scope) {
+  try {
+    return impl::DeserializeObject<MongoCacheTraits>(doc);
+  } catch (const std::exception& e) {
+    LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
+                        << MongoCacheTraits::kName << ", _id="
+                        << doc["_id"].template ConvertTo<std::string>()
+                        << ", what(): " << e;
+    stats_scope.IncreaseDocumentsParseFailures(1);
+
+    if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
+  }
+  return std::nullopt;
+}
+
+template <class MongoCacheTraits>
+void StoreObject(cache::UpdateType type,
+                 typename MongoCacheTraits::DataType& new_cache,
+                 typename MongoCacheTraits::ObjectType&& object) {
+  auto key = (object.*MongoCacheTraits::kKeyField);
+
+  if (type == cache::UpdateType::kIncremental || new_cache.count(key) == 0) {
+    new_cache[key] = std::move(object);
+  } else {
+    LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
+                        << MongoCacheTraits::kName << ", key=" << key;
+  }
+}
+
+template <class MongoCacheTraits>
+std::vector<typename MongoCacheTraits::ObjectType> ParseChunk(
+    const std::vector<formats::bson::Document>& docs,
+    cache::UpdateStatisticsScope& stats_scope) {
+  std::vector<typename MongoCacheTraits::ObjectType> objects;
+  objects.reserve(docs.size());
+  for (const auto& doc : docs) {
+    auto object =
+        impl::TryDeserializeObject<MongoCacheTraits>(doc, stats_scope);
+    if (object) objects.push_back(std::move(*object));
+  }
+  return objects;
+}
+
+/// Decodes the documents of `cursor` one by one in the current task and stores
+/// them into `new_cache`. Returns the number of the documents read.
+template <class MongoCacheTraits, typename Cursor>
+std::size_t ParseSequentially(cache::UpdateType type, Cursor& cursor,
+                              typename MongoCacheTraits::DataType& new_cache,
+                              cache::UpdateStatisticsScope& stats_scope,
+                              utils::CpuRelax& relax) {
+  std::size_t doc_count = 0;
+
+  for (const auto& doc : cursor) {
+    ++doc_count;
+
+    relax.Relax();
+
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    auto object =
+        impl::TryDeserializeObject<MongoCacheTraits>(doc, stats_scope);
+    if (object) {
+      impl::StoreObject<MongoCacheTraits>(type, new_cache, std::move(*object));
+    }
+  }
+  return doc_count;
 }
 
+/// Decodes the documents of `cursor` in chunks of `settings.chunk_size` on
+/// `task_processor` and stores them into `new_cache` in the cursor order.
+/// Returns the number of the documents read.
+template <class MongoCacheTraits, typename Cursor>
+std::size_t ParseInChunks(cache::UpdateType type, Cursor& cursor,
+                          typename MongoCacheTraits::DataType& new_cache,
+                          cache::UpdateStatisticsScope& stats_scope,
+                          utils::CpuRelax& relax,
+                          const MongoCacheParseSettings& settings,
+                          engine::TaskProcessor& task_processor) {
+  using ObjectType = typename MongoCacheTraits::ObjectType;
+  const auto chunk_size = settings.chunk_size;
+  UASSERT(chunk_size > 0);
+  UASSERT(settings.max_chunks_in_flight > 0);
+
+  std::deque<engine::TaskWithResult<std::vector<ObjectType>>> parse_tasks;
+  // chunks are merged in the cursor order, the same as in ParseSequentially
+  const auto merge_oldest_chunk = [&] {
+    auto objects = parse_tasks.front().Get();
+    parse_tasks.pop_front();
+    for (auto& object : objects) {
+      relax.Relax();
+      impl::StoreObject<MongoCacheTraits>(type, new_cache, std::move(object));
+    }
+  };
+  const auto start_chunk = [&](std::vector<formats::bson::Document>&& docs) {
+    while (!parse_tasks.empty() &&
+           (parse_tasks.size() >= settings.max_chunks_in_flight ||
+            parse_tasks.front().IsFinished())) {
+      merge_oldest_chunk();
+    }
+    parse_tasks.push_back(utils::Async(
+        task_processor, "mongo_cache_parse_chunk",
+        [&stats_scope, docs = std::move(docs)] {
+          return impl::ParseChunk<MongoCacheTraits>(docs, stats_scope);
+        }));
+  };
+
+  std::size_t doc_count = 0;
+  std::vector<formats::bson::Document> docs;
+  docs.reserve(chunk_size);
+
+  // Fetching the next batch from the cursor overlaps with decoding of the
+  // previous chunks
+  for (const auto& doc : cursor) {
+    ++doc_count;
+    stats_scope.IncreaseDocumentsReadCount(1);
+
+    docs.push_back(doc);
+    if (docs.size() < chunk_size) continue;
+
+    start_chunk(std::exchange(docs, {}));
+    docs.reserve(chunk_size);
+  }
+  if (!docs.empty()) start_chunk(std::move(docs));
+
+  while (!parse_tasks.empty()) merge_oldest_chunk();
+  return doc_count;
+}
+
+}  // namespace impl
+
 // clang-format off
 
 /// @ingroup userver_components
@@ -52,6 +212,17 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(const ComponentConfig&);
 /// Name | Description | Default value
 /// ---- | ----------- | -------------
 /// update-correction | adjusts incremental updates window to overlap with previous update | 0
+/// parse-chunk-size | number of documents decoded by a single task, 0 to decode all the documents sequentially in the update task | 0
+/// parse-task-processor | the name of the TaskProcessor for decoding the chunks of documents | task processor of the cache
+/// parse-max-chunks-in-flight | max number of chunks being decoded at once | 4
+///
+/// ### Parallel parsing
+/// With non-zero `parse-chunk-size` the update task only reads documents from
+/// the cursor and hands them over in chunks to the decoding tasks. The cursor
+/// requests the next batch of documents while the previous ones are being
+/// decoded. Decoded chunks are merged into the cache in the order of the
+/// cursor, so the duplicate keys are resolved exactly as in the sequential
+/// mode. DeserializeObject of the traits must be thread-safe in this mode.
 ///
 /// ## Traits example:
 /// All fields below (except for function overrides) are mandatory.
@@ -139,8 +310,8 @@ class MongoCache
               const std::chrono::system_clock::time_point& now,
               cache::UpdateStatisticsScope& stats_scope) override;
 
-  typename MongoCacheTraits::ObjectType DeserializeObject(
-      const formats::bson::Document& doc) const;
+  using ObjectType = typename MongoCacheTraits::ObjectType;
+  using DataType = typename MongoCacheTraits::DataType;
 
   storages::mongo::operations::Find GetFindOperation(
       cache::UpdateType type,
@@ -154,6 +325,7 @@ class MongoCache
   const std::shared_ptr<CollectionsType> mongo_collections_;
   const storages::mongo::Collection* const mongo_collection_;
   const std::chrono::system_clock::duration correction_;
+  const impl::MongoCacheParseSettings parse_settings_;
   std::size_t cpu_relax_iterations_{0};
 };
 
@@ -172,7 +344,8 @@ MongoCache<MongoCacheTraits>::MongoCache(const ComponentConfig& config,
               .template GetCollectionForLibrary<CollectionsType>()),
       mongo_collection_(std::addressof(
           mongo_collections_.get()->*MongoCacheTraits::kMongoCollectionsField)),
-      correction_(impl::GetMongoCacheUpdateCorrection(config)) {
+      correction_(impl::GetMongoCacheUpdateCorrection(config)),
+      parse_settings_(impl::GetMongoCacheParseSettings(config, context)) {
   [[maybe_unused]] mongo_cache::impl::CheckTraits<MongoCacheTraits>
       check_traits;
 
@@ -226,36 +399,15 @@ void MongoCache<MongoCacheTraits>::Update(
   scope.Reset(kFetchAndParseStage);
 
   utils::CpuRelax relax{cpu_relax_iterations_, &scope};
-  std::size_t doc_count = 0;
-
-  for (const auto& doc : cursor) {
-    ++doc_count;
-
-    relax.Relax();
-
-    stats_scope.IncreaseDocumentsReadCount(1);
-
-    try {
-      auto object = DeserializeObject(doc);
-      auto key = (object.*MongoCacheTraits::kKeyField);
-
-      if (type == cache::UpdateType::kIncremental ||
-          new_cache->count(key) == 0) {
-        (*new_cache)[key] = std::move(object);
-      } else {
-        LOG_LIMITED_ERROR() << "Found duplicate key for 2 items in cache "
-                            << MongoCacheTraits::kName << ", key=" << key;
-      }
-    } catch (const std::exception& e) {
-      LOG_LIMITED_ERROR() << "Failed to deserialize cache item of cache "
-                          << MongoCacheTraits::kName << ", _id="
-                          << doc["_id"].template ConvertTo<std::string>()
-                          << ", what(): " << e;
-      stats_scope.IncreaseDocumentsParseFailures(1);
-
-      if (!MongoCacheTraits::kAreInvalidDocumentsSkipped) throw;
-    }
-  }
+  const auto doc_count =
+      parse_settings_.chunk_size > 0
+          ? impl::ParseInChunks<MongoCacheTraits>(
+                type, cursor, *new_cache, stats_scope, relax, parse_settings_,
+                parse_settings_.task_processor
+                    ? *parse_settings_.task_processor
+                    : this->GetCacheTaskProcessor())
+          : impl::ParseSequentially<MongoCacheTraits>(
+                type, cursor, *new_cache, stats_scope, relax);
 
   const auto elapsed_time = scope.ElapsedTotal(kFetchAndParseStage);
   if (elapsed_time > kCpuRelaxThreshold) {
@@ -274,21 +426,6 @@ void MongoCache<MongoCacheTraits>::Update(
   stats_scope.Finish(size);
 }
 
-template <class MongoCacheTraits>
-typename MongoCacheTraits::ObjectType
-MongoCache<MongoCacheTraits>::DeserializeObject(
-    const formats::bson::Document& doc) const {
-  if constexpr (mongo_cache::impl::kHasDeserializeObject<MongoCacheTraits>) {
-    return MongoCacheTraits::DeserializeObject(doc);
-  }
-  if constexpr (mongo_cache::impl::kHasDefaultDeserializeObject<
-                    MongoCacheTraits>) {
-    return doc.As<typename MongoCacheTraits::ObjectType>();
-  }
-  UASSERT_MSG(false,
-              "No deserialize operation defined but DeserializeObject invoked");
-}
-
 template <class MongoCacheTraits>
 storages::mongo::operations::Find
 MongoCache<MongoCacheTraits>::GetFindOperation(
@@ -1,6 +1,7 @@
 #include <userver/cache/base_mongo_cache.hpp>
 
 #include <userver/components/component_config.hpp>
+#include <userver/components/component_context.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -12,6 +13,28 @@ std::chrono::milliseconds GetMongoCacheUpdateCorrection(
   return config["update-correction"].As<std::chrono::milliseconds>(0);
 }
 
+MongoCacheParseSettings GetMongoCacheParseSettings(
+    const ComponentConfig& config, const ComponentContext& context) {
+  MongoCacheParseSettings settings;
+  settings.chunk_size =
+      config["parse-chunk-size"].As<std::size_t>(settings.chunk_size);
+  settings.max_chunks_in_flight = config["parse-max-chunks-in-flight"]
+                                      .As<std::size_t>(
+                                          settings.max_chunks_in_flight);
+  if (settings.max_chunks_in_flight == 0) {
+    throw std::logic_error(
+        "'parse-max-chunks-in-flight' must be positive in config of '" +
+        components::GetCurrentComponentName(config) + "' cache");
+  }
+
+  const auto task_processor_name =
+      config["parse-task-processor"].As<std::optional<std::string>>();
+  if (task_processor_name) {
+    settings.task_processor = &context.GetTaskProcessor(*task_processor_name);
+  }
+  return settings;
+}
+
 std::string GetMongoCacheSchema() {
   return R"(
 type: object
@@ -22,6 +45,22 @@ properties:
         type: string
         description: adjusts incremental updates window to overlap with previous update
         defaultDescription: 0
+    parse-chunk-size:
+        type: integer
+        description: |
+            number of documents decoded by a single task, 0 to decode all
+            the documents sequentially in the update task
+        defaultDescription: 0
+        minimum: 0
+    parse-task-processor:
+        type: string
+        description: the name of the TaskProcessor for decoding the chunks of documents
+        defaultDescription: task processor of the cache
+    parse-max-chunks-in-flight:
+        type: integer
+        description: max number of chunks being decoded at once
+        defaultDescription: 4
+        minimum: 1
 )";
 }
 
@@ -0,0 +1,194 @@
+#include <userver/cache/base_mongo_cache.hpp>
+
+#include <atomic>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/cache/cache_statistics.hpp>
+#include <userver/cache/update_type.hpp>
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/sleep.hpp>
+#include <userver/formats/bson/document.hpp>
+#include <userver/formats/bson/inline.hpp>
+#include <userver/utest/utest.hpp>
+#include <userver/utils/cpu_relax.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+struct ParsedItem {
+  int key{0};
+  int value{0};
+
+  bool operator==(const ParsedItem& other) const {
+    return key == other.key && value == other.value;
+  }
+};
+
+struct ParseTraits {
+  static constexpr std::string_view kName = "parse-test-cache";
+  using ObjectType = ParsedItem;
+  static constexpr auto kKeyField = &ParsedItem::key;
+  using KeyType = int;
+  using DataType = std::unordered_map<KeyType, ObjectType>;
+  static constexpr bool kAreInvalidDocumentsSkipped = true;
+
+  static ObjectType DeserializeObject(const formats::bson::Document& doc) {
+    return {doc["key"].As<int>(), doc["value"].As<int>()};
+  }
+};
+
+struct StrictParseTraits : ParseTraits {
+  static constexpr bool kAreInvalidDocumentsSkipped = false;
+};
+
+// Tracks how many documents are being decoded at once, with one document per
+// chunk that is the count of the chunks in flight
+struct SlowParseTraits : ParseTraits {
+  static inline std::size_t expected_max_in_flight{0};
+  static inline std::atomic<std::size_t> in_flight{0};
+  static inline std::atomic<std::size_t> max_in_flight{0};
+
+  static ObjectType DeserializeObject(const formats::bson::Document& doc) {
+    const auto current = ++in_flight;
+    auto max = max_in_flight.load();
+    while (max < current &&
+           !max_in_flight.compare_exchange_weak(max, current)) {
+    }
+    // the first chunks wait for each other, so that the limit is reached
+    // without relying on timings
+    const auto deadline =
+        engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+    while (max_in_flight < expected_max_in_flight && !deadline.IsReached()) {
+      engine::SleepFor(std::chrono::milliseconds{1});
+    }
+    engine::SleepFor(std::chrono::milliseconds{1});
+    --in_flight;
+    return ParseTraits::DeserializeObject(doc);
+  }
+};
+
+formats::bson::Document MakeItem(int id, int key, int value) {
+  return formats::bson::MakeDoc("_id", id, "key", key, "value", value);
+}
+
+formats::bson::Document MakeInvalidItem(int id) {
+  return formats::bson::MakeDoc("_id", id, "key", "not a number");
+}
+
+std::vector<formats::bson::Document> MakeItems(std::size_t count) {
+  std::vector<formats::bson::Document> docs;
+  for (int i = 0; i < static_cast<int>(count); ++i) {
+    docs.push_back(MakeItem(i, i, i * 10));
+  }
+  return docs;
+}
+
+struct ParseResult {
+  ParseTraits::DataType data;
+  std::size_t doc_count{0};
+  std::size_t read_count{0};
+  std::size_t parse_failures{0};
+};
+
+// Parses sequentially if chunk_size is 0
+template <typename Traits = ParseTraits>
+ParseResult Parse(std::vector<formats::bson::Document> docs,
+                  std::size_t chunk_size,
+                  cache::UpdateType type = cache::UpdateType::kFull,
+                  std::size_t max_chunks_in_flight = 4) {
+  cache::impl::Statistics stats;
+  ParseResult result;
+  {
+    cache::UpdateStatisticsScope stats_scope{stats, type};
+    utils::CpuRelax relax{0, nullptr};
+    components::impl::MongoCacheParseSettings settings;
+    settings.chunk_size = chunk_size;
+    settings.max_chunks_in_flight = max_chunks_in_flight;
+
+    result.doc_count =
+        chunk_size == 0
+            ? components::impl::ParseSequentially<Traits>(
+                  type, docs, result.data, stats_scope, relax)
+            : components::impl::ParseInChunks<Traits>(
+                  type, docs, result.data, stats_scope, relax, settings,
+                  engine::current_task::GetTaskProcessor());
+    stats_scope.Finish(result.data.size());
+  }
+
+  const auto& update_stats = type == cache::UpdateType::kFull
+                                 ? stats.full_update
+                                 : stats.incremental_update;
+  result.read_count = update_stats.documents_read_count;
+  result.parse_failures = update_stats.documents_parse_failures;
+  return result;
+}
+
+}  // namespace
+
+UTEST(MongoCacheParseInChunks, ChunkBoundaries) {
+  constexpr std::size_t kChunkSize = 4;
+  for (const std::size_t count : {std::size_t{0}, std::size_t{1}, kChunkSize,
+                                  kChunkSize + 1}) {
+    const auto result = Parse(MakeItems(count), kChunkSize);
+    EXPECT_EQ(result.doc_count, count);
+    EXPECT_EQ(result.read_count, count);
+    EXPECT_EQ(result.parse_failures, 0);
+    ASSERT_EQ(result.data.size(), count);
+    for (int i = 0; i < static_cast<int>(count); ++i) {
+      EXPECT_EQ(result.data.at(i), (ParsedItem{i, i * 10}));
+    }
+  }
+}
+
+UTEST(MongoCacheParseInChunks, DuplicateKeysAcrossChunks) {
+  // every key appears in several chunks with different values
+  std::vector<formats::bson::Document> docs;
+  for (int i = 0; i < 20; ++i) docs.push_back(MakeItem(i, i % 7, i));
+
+  for (const auto type :
+       {cache::UpdateType::kFull, cache::UpdateType::kIncremental}) {
+    const auto sequential = Parse(docs, 0, type);
+    const auto chunked = Parse(docs, 3, type);
+    EXPECT_EQ(chunked.doc_count, docs.size());
+    EXPECT_EQ(chunked.data, sequential.data);
+  }
+
+  // the first document wins in the full update, the last one otherwise
+  EXPECT_EQ(Parse(docs, 3).data.at(1), (ParsedItem{1, 1}));
+  EXPECT_EQ(Parse(docs, 3, cache::UpdateType::kIncremental).data.at(1),
+            (ParsedItem{1, 15}));
+}
+
+UTEST(MongoCacheParseInChunks, ParseFailures) {
+  std::vector<formats::bson::Document> docs;
+  for (int i = 0; i < 10; ++i) {
+    docs.push_back(i % 3 == 0 ? MakeInvalidItem(i) : MakeItem(i, i, i));
+  }
+
+  const auto result = Parse(docs, 2);
+  EXPECT_EQ(result.doc_count, 10);
+  EXPECT_EQ(result.read_count, 10);
+  EXPECT_EQ(result.parse_failures, 4);
+  EXPECT_EQ(result.data.size(), 6);
+  EXPECT_EQ(result.data.count(3), 0);
+
+  UEXPECT_THROW(Parse<StrictParseTraits>(docs, 2), std::exception);
+}
+
+UTEST_MT(MongoCacheParseInChunks, MaxChunksInFlight, 4) {
+  for (const std::size_t max_chunks_in_flight : {1, 2, 3}) {
+    SlowParseTraits::expected_max_in_flight = max_chunks_in_flight;
+    SlowParseTraits::max_in_flight = 0;
+
+    const auto result = Parse<SlowParseTraits>(
+        MakeItems(16), 1, cache::UpdateType::kFull, max_chunks_in_flight);
+    EXPECT_EQ(result.data.size(), 16);
+    // the limit is reached and is never exceeded
+    EXPECT_EQ(SlowParseTraits::max_in_flight.load(), max_chunks_in_flight);
+  }
+}
+
+USERVER_NAMESPACE_END
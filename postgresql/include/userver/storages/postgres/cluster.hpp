@@ -4,6 +4,7 @@
 /// @brief @copybrief storages::postgres::Cluster
 
 #include <memory>
+#include <string_view>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/dynamic_config/source.hpp>
@@ -194,6 +195,26 @@ class Cluster {
   ResultSet Execute(ClusterHostTypeFlags flags,
                     OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
+
+  /// @brief Execute independent statements in a single network round trip at
+  /// host of specified type.
+  /// @note You must specify at least one role from ClusterHostType here
+  ///
+  /// Each statement runs in its own auto-commit transaction, a failed
+  /// statement doesn't affect the other ones. Errors of the statements are
+  /// reported via the corresponding PipelinedResult, connection errors are
+  /// thrown.
+  ///
+  /// @snippet storages/postgres/tests/pipeline_pgtest.cpp Pipeline sample
+  PipelinedResults ExecuteBatch(ClusterHostTypeFlags flags,
+                                const Pipeline& pipeline);
+
+  /// @brief Execute independent statements in a single network round trip
+  /// with specified host selection rules and command control settings.
+  /// @note You must specify at least one role from ClusterHostType here
+  PipelinedResults ExecuteBatch(ClusterHostTypeFlags flags,
+                                OptionalCommandControl statement_cmd_ctl,
+                                const Pipeline& pipeline);
   /// @}
 
   /// @brief Listen for notifications on channel
@@ -228,7 +249,8 @@ class Cluster {
   void SetStatementMetricsSettings(const StatementMetricsSettings& settings);
 
  private:
-  detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
+  detail::NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl,
+                               std::string_view statement);
 
   OptionalCommandControl GetQueryCmdCtl(const std::string& query_name) const;
   OptionalCommandControl GetHandlersCmdCtl(
@@ -251,7 +273,7 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-  auto ntrx = Start(flags, statement_cmd_ctl);
+  auto ntrx = Start(flags, statement_cmd_ctl, query.Statement());
   return ntrx.Execute(statement_cmd_ctl, query, args...);
 }
 
@@ -4,6 +4,7 @@
 
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/pipeline.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
 #include <userver/storages/postgres/result_set.hpp>
@@ -64,6 +65,12 @@ class NonTransaction {
   /// Suspends coroutine for execution.
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const std::string& statement, const ParameterStore& store);
+
+  /// Execute independent statements in a single network round trip.
+  ///
+  /// Suspends coroutine for execution.
+  PipelinedResults ExecutePipelined(OptionalCommandControl statement_cmd_ctl,
+                                    const Pipeline& pipeline);
   /// @}
  private:
   ResultSet DoExecute(const Query& query, const detail::QueryParameters& params,
@@ -24,8 +24,15 @@ struct RowTag {};
 /// @snippet storages/postgres/tests/composite_types_pgtest.cpp FieldTagSippet
 struct FieldTag {};
 
+/// @brief Tag type to request decoding a result set column by column into
+/// contiguous buffers before assembling user's row types.
+///
+/// @snippet storages/postgres/tests/result_set_pgtest.cpp ColumnarTagSnippet
+struct ColumnarTag {};
+
 constexpr RowTag kRowTag;
 constexpr FieldTag kFieldTag;
+constexpr ColumnarTag kColumnarTag;
 
 namespace io {
 
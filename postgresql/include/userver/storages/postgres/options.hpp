@@ -184,10 +184,15 @@ struct PoolSettings {
   /// Limits number of concurrent establishing connections (0 - unlimited)
   size_t connecting_limit{kDefaultConnectingLimit};
 
+  /// Prefer idle connections that have already prepared the statement when
+  /// acquiring a connection for a single statement execution
+  bool prepared_statement_affinity{false};
+
   bool operator==(const PoolSettings& rhs) const {
     return min_size == rhs.min_size && max_size == rhs.max_size &&
            max_queue_size == rhs.max_queue_size &&
-           connecting_limit == rhs.connecting_limit;
+           connecting_limit == rhs.connecting_limit &&
+           prepared_statement_affinity == rhs.prepared_statement_affinity;
   }
 };
 
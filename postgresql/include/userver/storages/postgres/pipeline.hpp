@@ -0,0 +1,95 @@
+#pragma once
+
+/// @file userver/storages/postgres/pipeline.hpp
+/// @brief @copybrief storages::postgres::Pipeline
+
+#include <cstddef>
+#include <exception>
+#include <variant>
+#include <vector>
+
+#include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/query.hpp>
+#include <userver/storages/postgres/result_set.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+/// @ingroup userver_containers
+///
+/// @brief A list of independent statements to be sent to the database in a
+/// single network round trip.
+///
+/// Statements are executed in order. Each of them is followed by a
+/// synchronization point, so a failed statement doesn't prevent the following
+/// ones from being executed. Inside a transaction a failure aborts the
+/// transaction and the following statements fail as well, exactly as with
+/// sequential Transaction::Execute calls.
+///
+/// Parameters are stored the same way as in ParameterStore, so currently only
+/// built-in types are supported.
+///
+/// @snippet storages/postgres/tests/pipeline_pgtest.cpp Pipeline sample
+class Pipeline final {
+ public:
+  /// @cond
+  struct Statement {
+    Query query;
+    ParameterStore params;
+  };
+  /// @endcond
+
+  Pipeline() = default;
+  Pipeline(const Pipeline&) = delete;
+  Pipeline(Pipeline&&) noexcept = default;
+  Pipeline& operator=(const Pipeline&) = delete;
+  Pipeline& operator=(Pipeline&&) noexcept = default;
+
+  /// @brief Appends a statement with the arguments
+  template <typename... Args>
+  Pipeline& Add(const Query& query, const Args&... args) {
+    ParameterStore params;
+    (params.PushBack(args), ...);
+    return Add(query, std::move(params));
+  }
+
+  /// @brief Appends a statement with stored parameters
+  Pipeline& Add(const Query& query, ParameterStore params);
+
+  std::size_t Size() const noexcept { return statements_.size(); }
+  bool IsEmpty() const noexcept { return statements_.empty(); }
+
+  /// @cond
+  const std::vector<Statement>& GetStatements() const noexcept {
+    return statements_;
+  }
+  /// @endcond
+
+ private:
+  std::vector<Statement> statements_;
+};
+
+/// @brief Outcome of a single statement of a Pipeline
+class PipelinedResult final {
+ public:
+  explicit PipelinedResult(ResultSet result);
+  explicit PipelinedResult(std::exception_ptr error);
+
+  /// Whether the statement has failed
+  bool HasError() const noexcept;
+
+  /// @brief Returns the result set of the statement
+  /// @throws the exception the statement has failed with
+  const ResultSet& Get() const;
+
+ private:
+  std::variant<ResultSet, std::exception_ptr> result_;
+};
+
+/// Outcomes of a Pipeline statements in the order of the statements
+using PipelinedResults = std::vector<PipelinedResult>;
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -11,12 +11,14 @@
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <userver/storages/postgres/exceptions.hpp>
 #include <userver/storages/postgres/io/supported_types.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
+#include <userver/storages/postgres/string_column.hpp>
 
 #include <userver/storages/postgres/detail/const_data_iterator.hpp>
 
@@ -173,6 +175,29 @@ namespace storages::postgres {
 ///
 /// @todo Interface for copying a ResultSet to an output iterator.
 ///
+/// @par Columnar extraction
+///
+/// Large result sets (e.g. cache loads) can be decoded column by column: each
+/// column is read in a single pass over the result set into a contiguous
+/// buffer, without constructing row and field accessors for every value.
+/// Integer columns are byte-swapped in place, textual columns may be copied
+/// into a single buffer.
+///
+/// @code
+/// auto ids = result.AsColumn<Bigint>(0);
+/// auto names = result.GetStringColumn(1);
+///
+/// // A row type of std::vector or StringColumn members receives all columns
+/// struct FooBarColumns {
+///   std::vector<Bigint> foo;
+///   StringColumn bar;
+/// };
+/// auto columns = result.AsColumns<FooBarColumns>();
+///
+/// // The columns are decoded first, then moved into the rows
+/// auto foobars = result.AsContainer<std::vector<FooBar>>(kColumnarTag);
+/// @endcode
+///
 /// @par Non-select query results
 ///
 /// @todo Process non-select result and provide interface. Do the docs.
@@ -676,6 +701,30 @@ class ResultSet {
   Container AsContainer() const;
   template <typename Container>
   Container AsContainer(RowTag) const;
+  /// @brief Extract data into a container of row types decoding the result
+  /// set column by column.
+  /// @throws FieldTupleMismatch if the row type size does not match the
+  /// number of fields
+  template <typename Container>
+  Container AsContainer(ColumnarTag) const;
+
+  /// @brief Extract a single column into a vector in a single pass.
+  /// @throws FieldIndexOutOfBounds if index is out of bounds
+  /// @throws FieldValueIsNull on null values, unless T is nullable
+  template <typename T>
+  std::vector<T> AsColumn(size_type column) const;
+
+  /// @brief Extract a textual column into a single buffer.
+  /// @throws FieldIndexOutOfBounds if index is out of bounds
+  /// @throws FieldValueIsNull on null values
+  StringColumn GetStringColumn(size_type column) const;
+
+  /// @brief Extract all the columns into a row type, every member of which is
+  /// either a std::vector or a StringColumn.
+  /// @throws FieldTupleMismatch if the row type size does not match the
+  /// number of fields
+  template <typename Columns>
+  Columns AsColumns() const;
 
   /// @brief Extract first row into user type.
   /// A single row result set is expected, will throw an exception when result
@@ -703,6 +752,25 @@ class ResultSet {
   void FillBufferCategories(const UserTypes& types);
   void SetBufferCategoriesFrom(const ResultSet&);
 
+  void CheckColumnIndex(size_type column) const;
+  bool ReadIntegralColumn(size_type column, Smallint* out) const;
+  bool ReadIntegralColumn(size_type column, Integer* out) const;
+  bool ReadIntegralColumn(size_type column, Bigint* out) const;
+
+  template <typename T>
+  void ReadColumnTo(size_type column, std::vector<T>& to) const {
+    to = AsColumn<T>(column);
+  }
+  void ReadColumnTo(size_type column, StringColumn& to) const {
+    to = GetStringColumn(column);
+  }
+
+  template <typename Row, std::size_t... Indexes>
+  void ReadColumnsToRows(std::vector<Row>& rows,
+                         std::index_sequence<Indexes...>) const;
+  template <std::size_t Index, typename Row>
+  void ReadColumnToRows(std::vector<Row>& rows) const;
+
   template <typename T, typename Tag>
   friend class TypedResultSet;
   friend class ConnectionImpl;
@@ -992,6 +1060,94 @@ Container ResultSet::AsContainer(RowTag) const {
   return c;
 }
 
+template <typename Container>
+Container ResultSet::AsContainer(ColumnarTag) const {
+  detail::AssertSaneTypeToDeserialize<Container>();
+  using ValueType = typename Container::value_type;
+  using RowType = io::RowType<ValueType>;
+  if (FieldCount() != RowType::size) {
+    throw FieldTupleMismatch{FieldCount(), RowType::size};
+  }
+
+  std::vector<ValueType> rows(Size());
+  ReadColumnsToRows(rows, typename RowType::IndexSequence{});
+  if constexpr (std::is_same_v<Container, std::vector<ValueType>>) {
+    return rows;
+  } else {
+    Container c;
+    if constexpr (io::traits::kCanReserve<Container>) {
+      c.reserve(rows.size());
+    }
+    auto inserter = io::traits::Inserter(c);
+    for (auto& row : rows) {
+      *inserter = std::move(row);
+      ++inserter;
+    }
+    return c;
+  }
+}
+
+template <typename T>
+std::vector<T> ResultSet::AsColumn(size_type column) const {
+  detail::AssertSaneTypeToDeserialize<T>();
+  CheckColumnIndex(column);
+
+  std::vector<T> result(Size());
+  if constexpr (std::is_same_v<T, Smallint> || std::is_same_v<T, Integer> ||
+                std::is_same_v<T, Bigint>) {
+    if (ReadIntegralColumn(column, result.data())) return result;
+  }
+
+  for (size_type row = 0; row < result.size(); ++row) {
+    const FieldView field{*pimpl_, row, column};
+    if constexpr (std::is_same_v<T, bool>) {
+      // std::vector<bool> elements are not addressable
+      bool value{};
+      field.To(value);
+      result[row] = value;
+    } else {
+      field.To(result[row]);
+    }
+  }
+  return result;
+}
+
+template <typename Columns>
+Columns ResultSet::AsColumns() const {
+  detail::AssertSaneTypeToDeserialize<Columns>();
+  using RowType = io::RowType<Columns>;
+  if (FieldCount() != RowType::size) {
+    throw FieldTupleMismatch{FieldCount(), RowType::size};
+  }
+
+  Columns columns;
+  std::apply(
+      [this](auto&... column) {
+        size_type index = 0;
+        (ReadColumnTo(index++, column), ...);
+      },
+      RowType::GetTuple(columns));
+  return columns;
+}
+
+template <typename Row, std::size_t... Indexes>
+void ResultSet::ReadColumnsToRows(std::vector<Row>& rows,
+                                  std::index_sequence<Indexes...>) const {
+  (ReadColumnToRows<Indexes>(rows), ...);
+}
+
+template <std::size_t Index, typename Row>
+void ResultSet::ReadColumnToRows(std::vector<Row>& rows) const {
+  using RowType = io::RowType<Row>;
+  using FieldType =
+      std::decay_t<std::tuple_element_t<Index, typename RowType::TupleType>>;
+
+  auto column = AsColumn<FieldType>(Index);
+  for (size_type row = 0; row < rows.size(); ++row) {
+    std::get<Index>(RowType::GetTuple(rows[row])) = std::move(column[row]);
+  }
+}
+
 template <typename T>
 auto ResultSet::AsSingleRow() const {
   return AsSingleRow<T>(kFieldTag);
@@ -42,6 +42,8 @@ struct TransactionStatistics {
   Counter error_execute_total = 0;
   /// Timeout while executing query
   Counter execute_timeout = 0;
+  /// Number of executions that reused an already prepared statement
+  Counter prepared_reuse_total = 0;
   /// Duplicate prepared statements
   /// This is not a hard error, the prepared statements are quite reusable due
   /// to pretty uniqueness of names. Nevertheless we would like to see them to
@@ -86,6 +88,12 @@ struct ConnectionStatistics {
   Counter error_timeout = 0;
   /// Number of maximum allowed waiting requests
   Counter max_queue_size = 0;
+  /// Number of acquisitions for a statement that got a connection with the
+  /// statement prepared, see PoolSettings::prepared_statement_affinity
+  Counter prepared_affinity_hit = 0;
+  /// Number of acquisitions for a statement that had to fall back to a
+  /// connection without the statement prepared
+  Counter prepared_affinity_miss = 0;
 
   /// Prepared statements count min-max-avg
   MmaAccumulator prepared_statements;
@@ -161,6 +169,9 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     connection.prepared_statements =
         stats.connection.prepared_statements.GetStatsForPeriod();
     connection.max_queue_size = stats.connection.max_queue_size;
+    connection.prepared_affinity_hit = stats.connection.prepared_affinity_hit;
+    connection.prepared_affinity_miss =
+        stats.connection.prepared_affinity_miss;
 
     transaction.total = stats.transaction.total;
     transaction.commit_total = stats.transaction.commit_total;
@@ -172,6 +183,7 @@ struct InstanceStatisticsNonatomic : InstanceStatisticsNonatomicBase {
     transaction.portal_bind_total = stats.transaction.portal_bind_total;
     transaction.error_execute_total = stats.transaction.error_execute_total;
     transaction.execute_timeout = stats.transaction.execute_timeout;
+    transaction.prepared_reuse_total = stats.transaction.prepared_reuse_total;
     transaction.duplicate_prepared_statements =
         stats.transaction.duplicate_prepared_statements;
     transaction.total_percentile =
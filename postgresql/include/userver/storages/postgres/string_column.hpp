@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file userver/storages/postgres/string_column.hpp
+/// @brief @copybrief storages::postgres::StringColumn
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+class ResultSet;
+
+/// @brief Values of a textual result set column stored in a single buffer.
+///
+/// Does not reference the result set it was extracted from, see
+/// ResultSet::GetStringColumn.
+class StringColumn final {
+ public:
+  using size_type = std::size_t;
+
+  size_type Size() const noexcept { return offsets_.size() - 1; }
+  bool IsEmpty() const noexcept { return Size() == 0; }
+
+  std::string_view operator[](size_type index) const {
+    UASSERT(index < Size());
+    return std::string_view{arena_}.substr(
+        offsets_[index], offsets_[index + 1] - offsets_[index]);
+  }
+
+ private:
+  friend class ResultSet;
+
+  std::string arena_;
+  // offsets_[i] and offsets_[i + 1] are the bounds of the i-th value
+  std::vector<size_type> offsets_{0};
+};
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/storages/postgres/detail/time_types.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/pipeline.hpp>
 #include <userver/storages/postgres/portal.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/storages/postgres/query.hpp>
@@ -211,6 +212,23 @@ class Transaction {
   ResultSet Execute(OptionalCommandControl statement_cmd_ctl,
                     const Query& query, const ParameterStore& store);
 
+  /// Execute independent statements in a single network round trip.
+  ///
+  /// Suspends coroutine for execution. Errors of the statements are reported
+  /// via the corresponding PipelinedResult, connection errors are thrown.
+  ///
+  /// @snippet storages/postgres/tests/pipeline_pgtest.cpp Pipeline sample
+  PipelinedResults ExecutePipelined(const Pipeline& pipeline) {
+    return ExecutePipelined(OptionalCommandControl{}, pipeline);
+  }
+
+  /// Execute independent statements in a single network round trip with
+  /// command control applied to the whole pipeline.
+  ///
+  /// Suspends coroutine for execution.
+  PipelinedResults ExecutePipelined(OptionalCommandControl statement_cmd_ctl,
+                                    const Pipeline& pipeline);
+
   /// Execute statement that uses an array of arguments splitting that array in
   /// chunks and executing the statement with a chunk of arguments.
   ///
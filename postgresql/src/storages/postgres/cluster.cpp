@@ -94,8 +94,9 @@ void Cluster::SetStatementMetricsSettings(
 }
 
 detail::NonTransaction Cluster::Start(ClusterHostTypeFlags flags,
-                                      OptionalCommandControl cmd_ctl) {
-  return pimpl_->Start(flags, cmd_ctl);
+                                      OptionalCommandControl cmd_ctl,
+                                      std::string_view statement) {
+  return pimpl_->Start(flags, cmd_ctl, statement);
 }
 
 OptionalCommandControl Cluster::GetQueryCmdCtl(
@@ -120,10 +121,26 @@ ResultSet Cluster::Execute(ClusterHostTypeFlags flags,
     statement_cmd_ctl = GetQueryCmdCtl(query.GetName()->GetUnderlying());
   }
   statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
-  auto ntrx = Start(flags, statement_cmd_ctl);
+  auto ntrx = Start(flags, statement_cmd_ctl, query.Statement());
   return ntrx.Execute(statement_cmd_ctl, query.Statement(), store);
 }
 
+PipelinedResults Cluster::ExecuteBatch(ClusterHostTypeFlags flags,
+                                      const Pipeline& pipeline) {
+  return ExecuteBatch(flags, OptionalCommandControl{}, pipeline);
+}
+
+PipelinedResults Cluster::ExecuteBatch(ClusterHostTypeFlags flags,
+                                      OptionalCommandControl statement_cmd_ctl,
+                                      const Pipeline& pipeline) {
+  if (pipeline.IsEmpty()) return {};
+  statement_cmd_ctl = GetHandlersCmdCtl(statement_cmd_ctl);
+  // pipelined statements are not prepared, so there is no statement to pick
+  // a connection by
+  auto ntrx = Start(flags, statement_cmd_ctl, {});
+  return ntrx.ExecutePipelined(statement_cmd_ctl, pipeline);
+}
+
 }  // namespace storages::postgres
 
 USERVER_NAMESPACE_END
@@ -318,6 +318,10 @@ properties:
         type: integer
         description: limit for concurrent establishing connections number per pool (0 - unlimited)
         defaultDescription: 0
+    prepared_statement_affinity:
+        type: boolean
+        description: prefer idle connections that have already prepared the statement
+        defaultDescription: false
     connlimit_mode:
         type: string
         enum:
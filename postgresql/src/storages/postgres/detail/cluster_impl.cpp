@@ -271,13 +271,14 @@ Transaction ClusterImpl::Begin(ClusterHostTypeFlags flags,
 }
 
 NonTransaction ClusterImpl::Start(ClusterHostTypeFlags flags,
-                                  OptionalCommandControl cmd_ctl) {
+                                  OptionalCommandControl cmd_ctl,
+                                  std::string_view statement) {
   if (!(flags & kClusterHostRolesMask)) {
     throw LogicError(
         "Host role must be specified for execution of a single statement");
   }
   LOG_TRACE() << "Requested single statement on " << flags;
-  return FindPool(flags)->Start(cmd_ctl);
+  return FindPool(flags)->Start(cmd_ctl, statement);
 }
 
 NotifyScope ClusterImpl::Listen(std::string_view channel,
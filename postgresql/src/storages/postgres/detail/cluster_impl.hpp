@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
@@ -45,7 +46,8 @@ class ClusterImpl {
   Transaction Begin(ClusterHostTypeFlags, const TransactionOptions&,
                     OptionalCommandControl);
 
-  NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl);
+  NonTransaction Start(ClusterHostTypeFlags, OptionalCommandControl,
+                       std::string_view statement = {});
 
   NotifyScope Listen(std::string_view channel, OptionalCommandControl);
 
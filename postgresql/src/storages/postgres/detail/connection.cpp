@@ -123,6 +123,11 @@ ResultSet Connection::Execute(CommandControl statement_cmd_ctl,
                  OptionalCommandControl{statement_cmd_ctl});
 }
 
+PipelinedResults Connection::ExecutePipelined(
+    const Pipeline& pipeline, OptionalCommandControl statement_cmd_ctl) {
+  return pimpl_->ExecutePipelined(pipeline, std::move(statement_cmd_ctl));
+}
+
 Connection::StatementId Connection::PortalBind(
     const std::string& statement, const std::string& portal_name,
     const detail::QueryParameters& params,
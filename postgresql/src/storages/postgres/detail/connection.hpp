@@ -20,6 +20,7 @@
 #include <userver/storages/postgres/notify.hpp>
 #include <userver/storages/postgres/options.hpp>
 #include <userver/storages/postgres/parameter_store.hpp>
+#include <userver/storages/postgres/pipeline.hpp>
 #include <userver/storages/postgres/result_set.hpp>
 #include <userver/storages/postgres/transaction.hpp>
 
@@ -80,6 +81,8 @@ class Connection {
     SmallCounter out_of_trx : 1;
     /// Number of parsed queries
     Counter parse_total{0};
+    /// Number of executions that reused an already prepared statement
+    Counter prepared_reuse_total{0};
     /// Number of query executions (calls to `Execute`)
     Counter execute_total{0};
     /// Total number of replies
@@ -227,6 +230,10 @@ class Connection {
   ResultSet Execute(CommandControl statement_cmd_ctl, const Query& query,
                     const ParameterStore& store);
 
+  /// Send the statements in a single pipeline, see Pipeline
+  PipelinedResults ExecutePipelined(const Pipeline& pipeline,
+                                    OptionalCommandControl statement_cmd_ctl);
+
   StatementId PortalBind(const std::string& statement,
                          const std::string& portal_name,
                          const detail::QueryParameters& params,
@@ -368,6 +368,40 @@ ResultSet ConnectionImpl::ExecuteCommand(
   return ExecuteCommand(query, params, deadline);
 }
 
+PipelinedResults ConnectionImpl::ExecutePipelined(
+    const Pipeline& pipeline, OptionalCommandControl statement_cmd_ctl) {
+  CheckBusy();
+  if (pipeline.IsEmpty()) return {};
+
+  auto deadline =
+      testsuite_pg_ctl_.MakeExecuteDeadline(ExecuteTimeout(statement_cmd_ctl));
+  SetStatementTimeout(std::move(statement_cmd_ctl));
+
+#if LIBPQ_HAS_PIPELINING
+  return SendPipelined(pipeline, deadline);
+#else
+  // Without pipelining support the statements cost a round trip each, but
+  // keep the same per-statement error semantics
+  PipelinedResults results;
+  results.reserve(pipeline.Size());
+  for (const auto& statement : pipeline.GetStatements()) {
+    try {
+      results.emplace_back(ExecuteCommand(
+          statement.query,
+          detail::QueryParameters{statement.params.GetInternalData()},
+          deadline));
+    } catch (const ConnectionError&) {
+      throw;
+    } catch (const ConnectionInterrupted&) {
+      throw;
+    } catch (const std::exception&) {
+      results.emplace_back(std::current_exception());
+    }
+  }
+  return results;
+#endif
+}
+
 void ConnectionImpl::Begin(const TransactionOptions& options,
                            SteadyClock::time_point trx_start_time,
                            OptionalCommandControl trx_cmd_ctl) {
@@ -711,6 +745,7 @@ const ConnectionImpl::PreparedStatementInfo& ConnectionImpl::PrepareStatement(
   auto* statement_info = prepared_.Get(query_id);
   if (statement_info) {
     LOG_TRACE() << "Query " << statement << " is already prepared.";
+    ++stats_.prepared_reuse_total;
     return *statement_info;
   }
 
@@ -868,6 +903,69 @@ void ConnectionImpl::SendCommandNoPrepare(const Query& query,
   conn_wrapper_.SendQuery(query.Statement(), params, scope);
 }
 
+PipelinedResults ConnectionImpl::SendPipelined(const Pipeline& pipeline,
+                                               engine::Deadline deadline) {
+  CheckDeadlineReached(deadline);
+  const TimeoutDuration network_timeout =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          deadline.TimeLeft());
+  tracing::Span span{scopes::kPipeline};
+  conn_wrapper_.FillSpanTags(span, {network_timeout, GetStatementTimeout()});
+  span.AddTag("pipeline_size", pipeline.Size());
+  auto scope = span.CreateScopeTime();
+
+  // Commands sent without waiting for their results, e.g. BEGIN in pipeline
+  // mode, must not be mistaken for results of the pipelined statements
+  if (IsPipelineActive() &&
+      GetConnectionState() == ConnectionState::kTranActive) {
+    conn_wrapper_.WaitResult(deadline, scope, nullptr);
+  }
+
+  const bool is_pipeline_entered = !IsPipelineActive();
+  if (is_pipeline_entered) conn_wrapper_.EnterPipelineMode();
+
+  const auto& statements = pipeline.GetStatements();
+  PipelinedResults results;
+  try {
+    scope.Reset(scopes::kExec);
+    for (std::size_t i = 0; i < statements.size(); ++i) {
+      // the last sync is sent on flush
+      if (i > 0) conn_wrapper_.SendPipelineSync();
+      const auto& statement = statements[i];
+      conn_wrapper_.SendQuery(
+          statement.query.Statement(),
+          detail::QueryParameters{statement.params.GetInternalData()}, scope);
+    }
+    stats_.execute_total += statements.size();
+    results = conn_wrapper_.WaitPipelinedResults(deadline, statements.size(),
+                                                 scope);
+  } catch (const std::exception& ex) {
+    span.AddTag(tracing::kErrorFlag, true);
+    stats_.error_execute_total += statements.size();
+    // the pipeline state is unknown, the connection can't be reused
+    if (is_pipeline_entered) conn_wrapper_.MarkAsBroken();
+    throw;
+  }
+  if (is_pipeline_entered) conn_wrapper_.ExitPipelineMode();
+
+  for (auto& result : results) {
+    if (result.HasError()) {
+      ++stats_.error_execute_total;
+      continue;
+    }
+    auto res = result.Get();
+    if (res.FieldCount()) ++stats_.reply_total;
+    if (res.IsEmpty()) continue;
+    try {
+      FillBufferCategories(res);
+    } catch (const std::exception&) {
+      result = PipelinedResult{std::current_exception()};
+    }
+  }
+  stats_.last_execute_finish = SteadyClock::now();
+  return results;
+}
+
 void ConnectionImpl::SetParameter(std::string_view name, std::string_view value,
                                   Connection::ParameterScope scope,
                                   engine::Deadline deadline) {
@@ -71,6 +71,9 @@ class ConnectionImpl {
                            const detail::QueryParameters& params,
                            OptionalCommandControl statement_cmd_ctl);
 
+  PipelinedResults ExecutePipelined(const Pipeline& pipeline,
+                                    OptionalCommandControl statement_cmd_ctl);
+
   void Begin(const TransactionOptions& options,
              SteadyClock::time_point trx_start_time,
              OptionalCommandControl trx_cmd_ctl = {});
@@ -165,6 +168,9 @@ class ConnectionImpl {
   void SendCommandNoPrepare(const Query& query, const QueryParameters& params,
                             engine::Deadline deadline);
 
+  PipelinedResults SendPipelined(const Pipeline& pipeline,
+                                 engine::Deadline deadline);
+
   void SetParameter(std::string_view name, std::string_view value,
                     Connection::ParameterScope scope,
                     engine::Deadline deadline);
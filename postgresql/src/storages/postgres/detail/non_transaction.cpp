@@ -25,6 +25,11 @@ ResultSet NonTransaction::Execute(OptionalCommandControl statement_cmd_ctl,
                    statement_cmd_ctl);
 }
 
+PipelinedResults NonTransaction::ExecutePipelined(
+    OptionalCommandControl statement_cmd_ctl, const Pipeline& pipeline) {
+  return conn_->ExecutePipelined(pipeline, std::move(statement_cmd_ctl));
+}
+
 ResultSet NonTransaction::DoExecute(const Query& query,
                                     const detail::QueryParameters& params,
                                     OptionalCommandControl statement_cmd_ctl) {
@@ -489,6 +489,16 @@ void PGConnectionWrapper::Flush(Deadline deadline) {
   }
 }
 
+void PGConnectionWrapper::SendPipelineSync() {
+#if LIBPQ_HAS_PIPELINING
+  UASSERT(IsPipelineActive());
+  CheckError<CommandError>("PQpipelineSync", PQpipelineSync(conn_));
+  ++pipeline_sync_counter_;
+#else
+  UINVARIANT(false, "Pipeline mode is not supported");
+#endif
+}
+
 void PGConnectionWrapper::HandlePipelineSync() {
   if (!pipeline_sync_counter_) {
     MarkAsBroken();
@@ -562,6 +572,60 @@ ResultSet PGConnectionWrapper::WaitResult(Deadline deadline,
   return MakeResult(std::move(handle));
 }
 
+PipelinedResults PGConnectionWrapper::WaitPipelinedResults(
+    Deadline deadline, std::size_t count, tracing::ScopeTime& scope) {
+  UASSERT(IsPipelineActive());
+  scope.Reset(scopes::kLibpqWaitResult);
+  Flush(deadline);
+
+  PipelinedResults results;
+  results.reserve(count);
+  auto handle = MakeResultHandle(nullptr);
+  auto null_res_counter{0};
+  do {
+    // Results of a statement are terminated by a null result
+    while (auto* pg_res = ReadResult(deadline, nullptr)) {
+      null_res_counter = 0;
+      auto next_handle = MakeResultHandle(pg_res);
+#if LIBPQ_HAS_PIPELINING
+      const auto status = PQresultStatus(pg_res);
+      if (status == PGRES_PIPELINE_SYNC) {
+        HandlePipelineSync();
+        continue;
+      }
+      if (status == PGRES_PIPELINE_ABORTED) {
+        results.emplace_back(std::make_exception_ptr(RuntimeError{
+            "Statement skipped due to a failure earlier in the pipeline"}));
+        continue;
+      }
+#endif
+      handle = std::move(next_handle);
+    }
+    if (handle) {
+      try {
+        results.emplace_back(MakeResult(std::move(handle)));
+      } catch (const ConnectionError&) {
+        throw;
+      } catch (const std::exception&) {
+        results.emplace_back(std::current_exception());
+      }
+      handle = MakeResultHandle(nullptr);
+    }
+    // Same issue as with WaitResult
+    if (++null_res_counter > 2) {
+      MarkAsBroken();
+      pipeline_sync_counter_ = 0;
+    }
+  } while (IsSyncingPipeline() && PQstatus(conn_) != CONNECTION_BAD);
+
+  if (results.size() != count) {
+    MarkAsBroken();
+    throw ConnectionError{fmt::format(
+        "Got {} results for {} pipelined statements", results.size(), count)};
+  }
+  return results;
+}
+
 Notification PGConnectionWrapper::WaitNotify(Deadline deadline) {
   auto notify = std::unique_ptr<PGnotify, decltype(&PQfreemem)>(
       PQnotifies(conn_), &PQfreemem);
@@ -17,6 +17,7 @@
 #include <userver/engine/semaphore.hpp>
 #include <userver/storages/postgres/dsn.hpp>
 #include <userver/storages/postgres/notify.hpp>
+#include <userver/storages/postgres/pipeline.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -70,6 +71,13 @@ class PGConnectionWrapper {
   /// Check if pipeline mode is currently enabled
   bool IsPipelineActive() const;
 
+  /// @brief Wrapper for PQpipelineSync, separates the statements sent so far
+  /// from the following ones, so that a failure of a statement doesn't abort
+  /// the following ones.
+  ///
+  /// Requires pipeline mode to be active.
+  void SendPipelineSync();
+
   /// @brief Close the connection on a background task processor.
   [[nodiscard]] engine::Task Close();
 
@@ -108,6 +116,12 @@ class PGConnectionWrapper {
   ResultSet WaitResult(Deadline deadline, tracing::ScopeTime&,
                        const PGresult* description);
 
+  /// @brief Wait for results of `count` statements sent in pipeline mode.
+  /// Statement errors are returned per statement, connection errors are
+  /// thrown.
+  PipelinedResults WaitPipelinedResults(Deadline deadline, std::size_t count,
+                                        tracing::ScopeTime&);
+
   /// @brief Wait for notification
   Notification WaitNotify(Deadline deadline);
 
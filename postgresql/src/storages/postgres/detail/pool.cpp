@@ -84,6 +84,7 @@ ConnectionPool::ConnectionPool(
       conn_settings_{conn_settings},
       bg_task_processor_{bg_task_processor},
       queue_{settings.max_size},
+      affinity_{std::max(std::size_t{1}, settings.max_size)},
       size_semaphore_{settings.max_size},
       connecting_semaphore_{settings.connecting_limit
                                 ? settings.connecting_limit
@@ -202,13 +203,23 @@ void ConnectionPool::Init(InitMode mode) {
   StartMaintainTask();
 }
 
-ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline) {
+ConnectionPtr ConnectionPool::Acquire(engine::Deadline deadline,
+                                      std::string_view statement) {
   // Obtain smart pointer first to prolong lifetime of this object
   auto shared_this = shared_from_this();
 
+  std::optional<std::size_t> statement_hash;
+  if (!statement.empty()) {
+    const auto settings = settings_.Read();
+    if (settings->prepared_statement_affinity) {
+      statement_hash = std::hash<std::string_view>{}(statement);
+    }
+  }
+
   auto config = GetConfigSource().GetSnapshot();
   CheckDeadlineIsExpired(config);
-  ConnectionPtr connection{Pop(deadline), std::move(shared_this)};
+  ConnectionPtr connection{Pop(deadline, statement_hash),
+                           std::move(shared_this)};
   ++stats_.connection.used;
   CheckDeadlineIsExpired(config);
 
@@ -227,6 +238,7 @@ void ConnectionPool::AccountConnectionStats(Connection::Statistics conn_stats) {
   stats_.transaction.rollback_total += conn_stats.rollback_total;
   stats_.transaction.out_of_trx_total += conn_stats.out_of_trx;
   stats_.transaction.parse_total += conn_stats.parse_total;
+  stats_.transaction.prepared_reuse_total += conn_stats.prepared_reuse_total;
   stats_.transaction.execute_total += conn_stats.execute_total;
   stats_.transaction.reply_total += conn_stats.reply_total;
   stats_.transaction.portal_bind_total += conn_stats.portal_bind_total;
@@ -311,11 +323,12 @@ Transaction ConnectionPool::Begin(const TransactionOptions& options,
   return Transaction{std::move(conn), options, trx_cmd_ctl, trx_start_time};
 }
 
-NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl) {
+NonTransaction ConnectionPool::Start(OptionalCommandControl cmd_ctl,
+                                    std::string_view statement) {
   const auto start_time = detail::SteadyClock::now();
   const auto deadline =
       testsuite_pg_ctl_.MakeExecuteDeadline(GetExecuteTimeout(cmd_ctl));
-  auto conn = Acquire(deadline);
+  auto conn = Acquire(deadline, statement);
   UASSERT(conn);
   return NonTransaction{std::move(conn), start_time};
 }
@@ -350,6 +363,8 @@ void ConnectionPool::SetSettings(const PoolSettings& settings) {
   if (*reader == settings) return;
   if (reader->max_size != max_connections) {
     size_semaphore_.SetCapacity(max_connections);
+    auto affinity = affinity_.Lock();
+    affinity->affinity.SetMaxSlots(max_connections);
   }
   if (reader->connecting_limit != settings.connecting_limit)
     connecting_semaphore_.SetCapacity(settings.connecting_limit
@@ -491,7 +506,10 @@ void ConnectionPool::Push(Connection* connection) {
     return;
   }
 
-  if (queue_.push(connection)) {
+  const auto settings = settings_.Read();
+  if (settings->prepared_statement_affinity && PushAffine(connection)) {
+    conn_available_.NotifyOne();
+  } else if (queue_.push(connection)) {
     conn_available_.NotifyOne();
   } else {
     // TODO Reflect this as a statistics error
@@ -501,7 +519,8 @@ void ConnectionPool::Push(Connection* connection) {
   }
 }
 
-Connection* ConnectionPool::Pop(engine::Deadline deadline) {
+Connection* ConnectionPool::Pop(engine::Deadline deadline,
+                                std::optional<std::size_t> statement) {
   if (engine::current_task::ShouldCancel()) {
     throw PoolError("Task was cancelled before trying to get a connection");
   }
@@ -513,7 +532,7 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   Stopwatch st{stats_.acquire_percentile};
   Connection* connection = nullptr;
   auto conn_settings = conn_settings_.Read();
-  while (queue_.pop(connection)) {
+  while ((connection = TryPop(statement))) {
     if (connection->GetSettings().version < conn_settings->version) {
       DropOutdatedConnection(connection);
       continue;
@@ -540,8 +559,9 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   {
     std::unique_lock<engine::Mutex> lock{wait_mutex_};
     // Wait for a connection
-    if (conn_available_.WaitUntil(lock, deadline,
-                                  [&] { return queue_.pop(connection); })) {
+    if (conn_available_.WaitUntil(lock, deadline, [&] {
+          return (connection = TryPop(statement)) != nullptr;
+        })) {
       return connection;
     }
   }
@@ -554,9 +574,81 @@ Connection* ConnectionPool::Pop(engine::Deadline deadline) {
   throw PoolError("No available connections found", db_name_);
 }
 
-void ConnectionPool::Clear() {
+Connection* ConnectionPool::TryPop(std::optional<std::size_t> statement) {
+  if (affine_idle_count_.load(std::memory_order_relaxed) != 0) {
+    if (auto* connection = PopAffine(statement)) return connection;
+  }
+
   Connection* connection = nullptr;
-  while (queue_.pop(connection)) {
+  return queue_.pop(connection) ? connection : nullptr;
+}
+
+bool ConnectionPool::PushAffine(Connection* connection) {
+  const bool caches_statements =
+      connection->GetSettings().prepared_statements ==
+      ConnectionSettings::kCachePreparedStatements;
+
+  auto state = affinity_.Lock();
+  auto& affine = state->slots[connection];
+  if (affine.slot == PreparedStatementAffinity::kNoSlot) {
+    affine.slot = state->affinity.OccupySlot();
+    if (affine.slot == PreparedStatementAffinity::kNoSlot) {
+      state->slots.erase(connection);
+      return false;
+    }
+    if (state->idle.size() <= affine.slot) {
+      state->idle.resize(state->affinity.GetMaxSlots());
+    }
+  }
+
+  // the statement the connection was acquired for is prepared by now
+  if (affine.statement && caches_statements) {
+    state->affinity.MarkPrepared(affine.slot, *affine.statement);
+  }
+  affine.statement.reset();
+
+  state->affinity.MarkIdle(affine.slot);
+  state->idle[affine.slot] = connection;
+  ++affine_idle_count_;
+  return true;
+}
+
+Connection* ConnectionPool::PopAffine(std::optional<std::size_t> statement) {
+  auto state = affinity_.Lock();
+  const auto acquired = state->affinity.AcquireIdle(statement);
+  if (!acquired) return nullptr;
+  --affine_idle_count_;
+
+  auto* connection = std::exchange(state->idle[acquired->slot], nullptr);
+  UASSERT(connection);
+  state->slots[connection].statement = statement;
+
+  if (statement) {
+    if (acquired->is_prepared) {
+      ++stats_.connection.prepared_affinity_hit;
+    } else {
+      ++stats_.connection.prepared_affinity_miss;
+    }
+  }
+  return connection;
+}
+
+void ConnectionPool::ForgetAffineConnection(Connection* connection) {
+  auto state = affinity_.Lock();
+  const auto it = state->slots.find(connection);
+  if (it == state->slots.end()) return;
+
+  const auto slot = it->second.slot;
+  if (state->idle[slot] == connection) {
+    state->idle[slot] = nullptr;
+    --affine_idle_count_;
+  }
+  state->affinity.FreeSlot(slot);
+  state->slots.erase(it);
+}
+
+void ConnectionPool::Clear() {
+  while (auto* connection = TryPop(std::nullopt)) {
     delete connection;
   }
   close_task_storage_.CancelAndWait();
@@ -597,6 +689,7 @@ void ConnectionPool::CleanupConnection(Connection* connection) {
 }
 
 void ConnectionPool::DeleteConnection(Connection* connection) {
+  ForgetAffineConnection(connection);
   delete connection;
   ++stats_.connection.drop_total;
 }
@@ -620,7 +713,7 @@ void ConnectionPool::DropOutdatedConnection(Connection* connection) {
 Connection* ConnectionPool::AcquireImmediate() {
   Connection* conn = nullptr;
   auto conn_settings = conn_settings_.Read();
-  while (queue_.pop(conn)) {
+  while ((conn = TryPop(std::nullopt))) {
     if (conn->GetSettings().version < conn_settings->version) {
       DropOutdatedConnection(conn);
       continue;
@@ -2,12 +2,17 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/lockfree/queue.hpp>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/dynamic_config/source.hpp>
 #include <userver/engine/condition_variable.hpp>
 #include <userver/engine/semaphore.hpp>
@@ -33,6 +38,7 @@
 
 #include <storages/postgres/detail/connection.hpp>
 #include <storages/postgres/detail/pg_impl_types.hpp>
+#include <storages/postgres/detail/prepared_affinity.hpp>
 #include <storages/postgres/detail/statement_timings_storage.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -68,14 +74,18 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
       const congestion_control::v2::LinearController::StaticConfig& cc_config,
       dynamic_config::Source config_source);
 
-  [[nodiscard]] ConnectionPtr Acquire(engine::Deadline);
+  /// @param statement the statement the connection is acquired for, if
+  /// known; used to prefer the connections that have it prepared
+  [[nodiscard]] ConnectionPtr Acquire(engine::Deadline,
+                                      std::string_view statement = {});
   void Release(Connection* connection);
 
   const InstanceStatistics& GetStatistics() const;
   [[nodiscard]] Transaction Begin(const TransactionOptions& options,
                                   OptionalCommandControl trx_cmd_ctl = {});
 
-  [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {});
+  [[nodiscard]] NonTransaction Start(OptionalCommandControl cmd_ctl = {},
+                                     std::string_view statement = {});
 
   NotifyScope Listen(std::string_view channel,
                      OptionalCommandControl cmd_ctl = {});
@@ -110,7 +120,12 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   void CheckMinPoolSizeUnderflow();
 
   void Push(Connection* connection);
-  Connection* Pop(engine::Deadline);
+  Connection* Pop(engine::Deadline, std::optional<std::size_t> statement);
+  Connection* TryPop(std::optional<std::size_t> statement);
+
+  bool PushAffine(Connection* connection);
+  Connection* PopAffine(std::optional<std::size_t> statement);
+  void ForgetAffineConnection(Connection* connection);
 
   void Clear();
 
@@ -130,6 +145,20 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
 
   void CheckUserTypes();
 
+  struct AffineSlot {
+    std::size_t slot{PreparedStatementAffinity::kNoSlot};
+    /// Statement the connection was acquired for
+    std::optional<std::size_t> statement;
+  };
+
+  struct AffinityState {
+    explicit AffinityState(std::size_t max_slots) : affinity(max_slots) {}
+
+    PreparedStatementAffinity affinity;
+    std::unordered_map<Connection*, AffineSlot> slots;
+    std::vector<Connection*> idle;
+  };
+
   using RecentCounter = USERVER_NAMESPACE::utils::statistics::RecentPeriod<
       USERVER_NAMESPACE::utils::statistics::RelaxedCounter<size_t>, size_t>;
 
@@ -146,6 +175,9 @@ class ConnectionPool : public std::enable_shared_from_this<ConnectionPool> {
   engine::Mutex wait_mutex_;
   engine::ConditionVariable conn_available_;
   boost::lockfree::queue<Connection*> queue_;
+  // idle connections with prepared statement affinity enabled
+  concurrent::Variable<AffinityState, std::mutex> affinity_;
+  std::atomic<std::size_t> affine_idle_count_{0};
   engine::Semaphore size_semaphore_;
   engine::Semaphore connecting_semaphore_;
   std::atomic<size_t> wait_count_;
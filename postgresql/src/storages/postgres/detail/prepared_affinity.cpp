@@ -0,0 +1,134 @@
+#include <storages/postgres/detail/prepared_affinity.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+namespace {
+
+using Word = std::uint64_t;
+constexpr std::size_t kBits = std::numeric_limits<Word>::digits;
+
+bool IsSet(const std::vector<Word>& bitmap, std::size_t bit) noexcept {
+  return (bitmap[bit / kBits] >> (bit % kBits)) & 1;
+}
+
+void Set(std::vector<Word>& bitmap, std::size_t bit) noexcept {
+  bitmap[bit / kBits] |= Word{1} << (bit % kBits);
+}
+
+void Reset(std::vector<Word>& bitmap, std::size_t bit) noexcept {
+  bitmap[bit / kBits] &= ~(Word{1} << (bit % kBits));
+}
+
+}  // namespace
+
+PreparedStatementAffinity::PreparedStatementAffinity(std::size_t max_slots)
+    : max_slots_(max_slots) {
+  UINVARIANT(max_slots_ > 0, "Affinity requires at least one slot");
+  occupied_.resize(GetWordsCount());
+  idle_.resize(GetWordsCount());
+}
+
+void PreparedStatementAffinity::SetMaxSlots(std::size_t max_slots) {
+  if (max_slots <= max_slots_) return;
+
+  max_slots_ = max_slots;
+  const auto words = GetWordsCount();
+  occupied_.resize(words);
+  idle_.resize(words);
+  for (auto& [_, bitmap] : prepared_) bitmap.resize(words);
+}
+
+std::size_t PreparedStatementAffinity::OccupySlot() {
+  for (std::size_t slot = 0; slot < max_slots_; ++slot) {
+    if (!IsSet(occupied_, slot)) {
+      Set(occupied_, slot);
+      return slot;
+    }
+  }
+  return kNoSlot;
+}
+
+void PreparedStatementAffinity::FreeSlot(std::size_t slot) {
+  UASSERT(slot < max_slots_ && IsSet(occupied_, slot));
+  Reset(occupied_, slot);
+  if (IsSet(idle_, slot)) {
+    Reset(idle_, slot);
+    --idle_count_;
+  }
+  for (auto& [_, bitmap] : prepared_) Reset(bitmap, slot);
+}
+
+void PreparedStatementAffinity::MarkIdle(std::size_t slot) {
+  UASSERT(slot < max_slots_ && IsSet(occupied_, slot));
+  UASSERT(!IsSet(idle_, slot));
+  Set(idle_, slot);
+  ++idle_count_;
+}
+
+void PreparedStatementAffinity::MarkPrepared(std::size_t slot,
+                                             StatementHash statement) {
+  UASSERT(slot < max_slots_ && IsSet(occupied_, slot));
+  if (prepared_.size() >= kMaxStatements && !prepared_.count(statement)) {
+    prepared_.clear();
+  }
+
+  auto& bitmap = prepared_[statement];
+  if (bitmap.empty()) bitmap.resize(GetWordsCount());
+  Set(bitmap, slot);
+}
+
+std::optional<PreparedStatementAffinity::Acquired>
+PreparedStatementAffinity::AcquireIdle(std::optional<StatementHash> statement) {
+  if (!idle_count_) return std::nullopt;
+
+  Acquired result;
+  if (statement) {
+    const auto it = prepared_.find(*statement);
+    if (it != prepared_.end()) {
+      result.slot = FindFromCursor(it->second, &idle_);
+      result.is_prepared = result.slot != kNoSlot;
+    }
+  }
+  if (result.slot == kNoSlot) result.slot = FindFromCursor(idle_, nullptr);
+  UASSERT(result.slot != kNoSlot);
+
+  Reset(idle_, result.slot);
+  --idle_count_;
+  cursor_ = (result.slot + 1) % max_slots_;
+  return result;
+}
+
+std::size_t PreparedStatementAffinity::FindFromCursor(
+    const Bitmap& bitmap, const Bitmap* mask) const noexcept {
+  const auto words = GetWordsCount();
+  const auto start_word = cursor_ / kWordBits;
+  const auto start_bit = cursor_ % kWordBits;
+
+  // the first word is visited twice: bits after the cursor go first, bits
+  // before the cursor go last
+  for (std::size_t i = 0; i <= words; ++i) {
+    const auto word_index = (start_word + i) % words;
+    auto word = bitmap[word_index];
+    if (mask) word &= (*mask)[word_index];
+    if (i == 0) {
+      word &= ~Word{0} << start_bit;
+    } else if (i == words) {
+      word &= ~(~Word{0} << start_bit);
+    }
+
+    if (word) return word_index * kWordBits + __builtin_ctzll(word);
+  }
+  return kNoSlot;
+}
+
+std::size_t PreparedStatementAffinity::GetWordsCount() const noexcept {
+  return (max_slots_ + kWordBits - 1) / kWordBits;
+}
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres::detail {
+
+/// @brief Tracks idle pool slots and the statements prepared on them
+///
+/// Every pooled connection occupies a slot, for every statement seen the
+/// tracker keeps a bitmap of slots whose connections have prepared it. Idle
+/// slots that prepared the requested statement are preferred, slots are
+/// handed out round-robin otherwise so that no connection is starved or
+/// overused.
+///
+/// Bitmaps are a hint: a connection may have evicted the statement from its
+/// own cache already, that only costs an extra Parse.
+///
+/// Not thread-safe.
+class PreparedStatementAffinity final {
+ public:
+  using StatementHash = std::size_t;
+
+  static constexpr std::size_t kNoSlot =
+      std::numeric_limits<std::size_t>::max();
+
+  /// Upper bound of the tracked statements count, all of the bitmaps are
+  /// dropped if it is exceeded
+  static constexpr std::size_t kMaxStatements = 4096;
+
+  struct Acquired {
+    std::size_t slot{kNoSlot};
+    /// Whether the slot has prepared the requested statement
+    bool is_prepared{false};
+  };
+
+  explicit PreparedStatementAffinity(std::size_t max_slots);
+
+  std::size_t GetMaxSlots() const noexcept { return max_slots_; }
+
+  /// Grows the slots count, never shrinks it
+  void SetMaxSlots(std::size_t max_slots);
+
+  /// @returns a free slot for a new connection or kNoSlot if there is none
+  std::size_t OccupySlot();
+
+  /// Frees the slot and forgets the statements prepared on it
+  void FreeSlot(std::size_t slot);
+
+  void MarkIdle(std::size_t slot);
+
+  void MarkPrepared(std::size_t slot, StatementHash statement);
+
+  std::size_t GetIdleCount() const noexcept { return idle_count_; }
+
+  /// Takes an idle slot, prefers the ones that have prepared `statement`
+  std::optional<Acquired> AcquireIdle(std::optional<StatementHash> statement);
+
+ private:
+  using Word = std::uint64_t;
+  using Bitmap = std::vector<Word>;
+
+  static constexpr std::size_t kWordBits = std::numeric_limits<Word>::digits;
+
+  std::size_t FindFromCursor(const Bitmap& bitmap,
+                             const Bitmap* mask) const noexcept;
+  std::size_t GetWordsCount() const noexcept;
+
+  std::size_t max_slots_;
+  Bitmap occupied_;
+  Bitmap idle_;
+  std::size_t idle_count_{0};
+  std::size_t cursor_{0};
+  std::unordered_map<StatementHash, Bitmap> prepared_;
+};
+
+}  // namespace storages::postgres::detail
+
+USERVER_NAMESPACE_END
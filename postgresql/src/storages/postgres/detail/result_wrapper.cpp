@@ -1,12 +1,16 @@
 #include <storages/postgres/detail/result_wrapper.hpp>
 
+#include <cstring>
+
 #include <fmt/compile.h>
 #include <fmt/format.h>
 #include <boost/container/small_vector.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/stacktrace/stacktrace.hpp>
 
 #include <userver/logging/log.hpp>
 #include <userver/logging/stacktrace_cache.hpp>
+#include <userver/utils/assert.hpp>
 
 #include <storages/postgres/detail/pg_message_severity.hpp>
 #include <userver/storages/postgres/io/traits.hpp>
@@ -144,6 +148,12 @@ bool AddTypeBufferCategories(std::size_t n_fields,
   return true;
 }
 
+template <typename T>
+constexpr io::PredefinedOids kIntegralTypeOid =
+    sizeof(T) == sizeof(Smallint)  ? io::PredefinedOids::kInt2
+    : sizeof(T) == sizeof(Integer) ? io::PredefinedOids::kInt4
+                                   : io::PredefinedOids::kInt8;
+
 }  // namespace
 
 struct ResultWrapper::CachedFieldBufferCategories final {
@@ -281,15 +291,76 @@ std::size_t ResultWrapper::GetFieldLength(std::size_t row,
 
 io::FieldBuffer ResultWrapper::GetFieldBuffer(std::size_t row,
                                               std::size_t col) const {
+  CheckBinaryFormat(col);
+  return io::FieldBuffer{IsFieldNull(row, col), GetFieldBufferCategory(col),
+                         GetFieldLength(row, col),
+                         reinterpret_cast<const std::uint8_t*>(
+                             PQgetvalue(handle_.get(), row, col))};
+}
+
+bool ResultWrapper::ReadIntegralColumn(std::size_t col, Smallint* out) const {
+  return DoReadIntegralColumn(col, out);
+}
+
+bool ResultWrapper::ReadIntegralColumn(std::size_t col, Integer* out) const {
+  return DoReadIntegralColumn(col, out);
+}
+
+bool ResultWrapper::ReadIntegralColumn(std::size_t col, Bigint* out) const {
+  return DoReadIntegralColumn(col, out);
+}
+
+void ResultWrapper::ReadStringColumn(std::size_t col, std::string& arena,
+                                     std::vector<std::size_t>& offsets) const {
+  CheckBinaryFormat(col);
+  auto* res = handle_.get();
+  const auto row_count = RowCount();
+
+  std::size_t total_length = 0;
+  for (std::size_t row = 0; row < row_count; ++row) {
+    if (PQgetisnull(res, row, col)) {
+      throw FieldValueIsNull{col, GetFieldName(col), arena};
+    }
+    total_length += PQgetlength(res, row, col);
+  }
+
+  arena.reserve(arena.size() + total_length);
+  offsets.reserve(offsets.size() + row_count);
+  for (std::size_t row = 0; row < row_count; ++row) {
+    arena.append(PQgetvalue(res, row, col), PQgetlength(res, row, col));
+    offsets.push_back(arena.size());
+  }
+}
+
+void ResultWrapper::CheckBinaryFormat(std::size_t col) const {
   if (PQfformat(handle_.get(), col) != io::kPgBinaryDataFormat) {
     throw ResultSetError{
         fmt::format("Column with index {} has text format\n", col) +
         logging::stacktrace_cache::to_string(boost::stacktrace::stacktrace{})};
   }
-  return io::FieldBuffer{IsFieldNull(row, col), GetFieldBufferCategory(col),
-                         GetFieldLength(row, col),
-                         reinterpret_cast<const std::uint8_t*>(
-                             PQgetvalue(handle_.get(), row, col))};
+}
+
+template <typename T>
+bool ResultWrapper::DoReadIntegralColumn(std::size_t col, T* out) const {
+  if (GetFieldTypeOid(col) != static_cast<Oid>(kIntegralTypeOid<T>)) {
+    return false;
+  }
+  CheckBinaryFormat(col);
+
+  // Values are scattered over the PGresult, so the loop is bound by loads
+  // rather than by the byte swap itself
+  auto* res = handle_.get();
+  const auto row_count = RowCount();
+  for (std::size_t row = 0; row < row_count; ++row) {
+    if (PQgetisnull(res, row, col)) {
+      throw FieldValueIsNull{col, GetFieldName(col), T{}};
+    }
+    UASSERT(static_cast<std::size_t>(PQgetlength(res, row, col)) == sizeof(T));
+    T value;
+    std::memcpy(&value, PQgetvalue(res, row, col), sizeof(T));
+    out[row] = boost::endian::big_to_native(value);
+  }
+  return true;
 }
 
 std::string ResultWrapper::GetErrorMessage() const {
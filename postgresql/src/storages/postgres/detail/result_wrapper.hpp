@@ -2,7 +2,9 @@
 
 #include <libpq-fe.h>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include <userver/storages/postgres/postgres_fwd.hpp>
 
@@ -48,6 +50,22 @@ class ResultWrapper {
   io::FieldBuffer GetFieldBuffer(std::size_t row, std::size_t col) const;
   //@}
 
+  //@{
+  /** @name Columnar data access */
+  /// Decodes a column of int2/int4/int8 matching the size of `out` elements.
+  /// @returns false if the column type does not match, `out` is untouched
+  /// @throws FieldValueIsNull if the column contains a null
+  bool ReadIntegralColumn(std::size_t col, Smallint* out) const;
+  bool ReadIntegralColumn(std::size_t col, Integer* out) const;
+  bool ReadIntegralColumn(std::size_t col, Bigint* out) const;
+
+  /// Appends values of the column to `arena` one after another, `offsets`
+  /// receive the end offset of every value
+  /// @throws FieldValueIsNull if the column contains a null
+  void ReadStringColumn(std::size_t col, std::string& arena,
+                        std::vector<std::size_t>& offsets) const;
+  //@}
+
   //@{
   /** @name Message result */
   // TODO Consider splitting these methods into a separate class
@@ -76,6 +94,12 @@ class ResultWrapper {
   struct CachedFieldBufferCategories;
   USERVER_NAMESPACE::utils::FastPimpl<CachedFieldBufferCategories, 88, 8>
       cached_buffer_categories_;
+
+ private:
+  void CheckBinaryFormat(std::size_t col) const;
+
+  template <typename T>
+  bool DoReadIntegralColumn(std::size_t col, T* out) const;
 };
 
 inline ResultWrapper::ResultHandle MakeResultHandle(PGresult* pg_res) {
@@ -20,6 +20,8 @@ const std::string kPrepare = "pg_prepare";
 const std::string kBind = "pg_bind";
 /// Execute query, driver level
 const std::string kExec = "pg_exec";
+/// Execute several statements in a pipeline, top driver level
+const std::string kPipeline = "pg_pipeline";
 
 // libpq stages
 /// libpq async connect stage
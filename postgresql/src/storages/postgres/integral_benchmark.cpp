@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 
 #include <limits>
+#include <vector>
 
 #include <storages/postgres/detail/connection.hpp>
 
@@ -53,6 +54,29 @@ BENCHMARK_F(PgConnection, Int64Roundtrip)(benchmark::State& state) {
   });
 }
 
+constexpr const char* kBigintColumnQuery =
+    "select i::bigint from generate_series(1, 10000) as i";
+
+BENCHMARK_F(PgConnection, Int64ColumnAsContainer)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(kBigintColumnQuery);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.AsContainer<std::vector<pg::Bigint>>());
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+BENCHMARK_F(PgConnection, Int64ColumnAsColumn)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(kBigintColumnQuery);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.AsColumn<pg::Bigint>(0));
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#include <userver/storages/postgres/pipeline.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace storages::postgres {
+
+Pipeline& Pipeline::Add(const Query& query, ParameterStore params) {
+  statements_.push_back({query, std::move(params)});
+  return *this;
+}
+
+PipelinedResult::PipelinedResult(ResultSet result)
+    : result_(std::move(result)) {}
+
+PipelinedResult::PipelinedResult(std::exception_ptr error)
+    : result_(std::move(error)) {
+  UASSERT(std::get<std::exception_ptr>(result_));
+}
+
+bool PipelinedResult::HasError() const noexcept {
+  return std::holds_alternative<std::exception_ptr>(result_);
+}
+
+const ResultSet& PipelinedResult::Get() const {
+  if (const auto* error = std::get_if<std::exception_ptr>(&result_)) {
+    std::rethrow_exception(*error);
+  }
+  return std::get<ResultSet>(result_);
+}
+
+}  // namespace storages::postgres
+
+USERVER_NAMESPACE_END
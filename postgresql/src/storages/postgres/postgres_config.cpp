@@ -116,6 +116,9 @@ PoolSettings ParsePoolSettings(const ConfigType& config) {
       config["max_queue_size"].template As<size_t>(result.max_queue_size);
   result.connecting_limit =
       config["connecting_limit"].template As<size_t>(result.connecting_limit);
+  result.prepared_statement_affinity =
+      config["prepared_statement_affinity"].template As<bool>(
+          result.prepared_statement_affinity);
 
   if (result.max_size == 0)
     throw InvalidConfig{"max_pool_size must be greater than 0"};
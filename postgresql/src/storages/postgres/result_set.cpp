@@ -252,6 +252,29 @@ void ResultSet::SetBufferCategoriesFrom(const ResultSet& dsc) {
   pimpl_->SetTypeBufferCategories(*dsc.pimpl_);
 }
 
+StringColumn ResultSet::GetStringColumn(size_type column) const {
+  CheckColumnIndex(column);
+  StringColumn result;
+  pimpl_->ReadStringColumn(column, result.arena_, result.offsets_);
+  return result;
+}
+
+void ResultSet::CheckColumnIndex(size_type column) const {
+  if (column >= FieldCount()) throw FieldIndexOutOfBounds{column};
+}
+
+bool ResultSet::ReadIntegralColumn(size_type column, Smallint* out) const {
+  return pimpl_->ReadIntegralColumn(column, out);
+}
+
+bool ResultSet::ReadIntegralColumn(size_type column, Integer* out) const {
+  return pimpl_->ReadIntegralColumn(column, out);
+}
+
+bool ResultSet::ReadIntegralColumn(size_type column, Bigint* out) const {
+  return pimpl_->ReadIntegralColumn(column, out);
+}
+
 Row::size_type Row::IndexOfName(const std::string& name) const {
   return res_->IndexOfName(name);
 }
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <storages/postgres/detail/connection.hpp>
+
+#include <storages/postgres/util_benchmark.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+namespace pg = storages::postgres;
+using namespace pg::bench;
+
+struct CacheRow {
+  pg::Bigint id;
+  pg::Integer revision;
+  std::string name;
+};
+
+constexpr const char* kCacheRowsQuery =
+    "select i::bigint, (i % 1000)::integer, 'name_' || i "
+    "from generate_series(1, 10000) as i";
+
+BENCHMARK_F(PgConnection, ResultAsContainerByRows)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(kCacheRowsQuery);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          res.AsContainer<std::vector<CacheRow>>(pg::kRowTag));
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+BENCHMARK_F(PgConnection, ResultAsContainerByColumns)
+(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(kCacheRowsQuery);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(
+          res.AsContainer<std::vector<CacheRow>>(pg::kColumnarTag));
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+BENCHMARK_F(PgConnection, ResultStringColumn)(benchmark::State& state) {
+  RunStandalone(state, [this, &state] {
+    const auto res = GetConnection().Execute(kCacheRowsQuery);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(res.GetStringColumn(2));
+    }
+    state.SetItemsProcessed(state.iterations() * res.Size());
+  });
+}
+
+}  // namespace
+
+USERVER_NAMESPACE_END
@@ -32,6 +32,7 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
   }
   if (auto query = writer["queries"]) {
     query["parsed"] = stats.transaction.parse_total;
+    query["prepared-reused"] = stats.transaction.prepared_reuse_total;
     query["portals-bound"] = stats.transaction.portal_bind_total;
     query["executed"] = stats.transaction.execute_total;
     query["replies"] = stats.transaction.reply_total;
@@ -54,6 +55,10 @@ void DumpMetric(USERVER_NAMESPACE::utils::statistics::Writer& writer,
     errors.ValueWithLabels(stats.connection.error_timeout,
                            {kPostgresqlError, "connection-timeout"});
   }
+  if (auto affinity = writer["prepared-affinity"]) {
+    affinity["hit"] = stats.connection.prepared_affinity_hit;
+    affinity["miss"] = stats.connection.prepared_affinity_miss;
+  }
   writer["prepared-per-connection"] = stats.connection.prepared_statements;
   writer["roundtrip-time"] = stats.topology.roundtrip_time;
   writer["replication-lag"] = stats.topology.replication_lag;
@@ -0,0 +1,87 @@
+#include <storages/postgres/tests/util_pgtest.hpp>
+
+#include <storages/postgres/detail/connection.hpp>
+#include <userver/storages/postgres/exceptions.hpp>
+#include <userver/storages/postgres/pipeline.hpp>
+#include <userver/storages/postgres/transaction.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace pg = storages::postgres;
+
+UTEST_P(PostgreConnection, PipelineEmpty) {
+  CheckConnection(GetConn());
+
+  const pg::Pipeline pipeline;
+  pg::PipelinedResults results;
+  UEXPECT_NO_THROW(results = GetConn()->ExecutePipelined(pipeline, {}));
+  EXPECT_TRUE(results.empty());
+}
+
+UTEST_P(PostgreConnection, PipelineResults) {
+  CheckConnection(GetConn());
+
+  pg::Pipeline pipeline;
+  pipeline.Add("select $1::integer", 1)
+      .Add("select 1 / $1::integer", 0)
+      .Add("select $1::text, $2::bigint", std::string{"foo"}, pg::Bigint{2})
+      .Add("select generate_series(1, 3)");
+
+  pg::PipelinedResults results;
+  UEXPECT_NO_THROW(results = GetConn()->ExecutePipelined(pipeline, {}));
+  ASSERT_EQ(4, results.size());
+
+  ASSERT_FALSE(results[0].HasError());
+  EXPECT_EQ(1, results[0].Get().AsSingleRow<int>());
+
+  // A failed statement doesn't abort the following ones
+  EXPECT_TRUE(results[1].HasError());
+  UEXPECT_THROW(results[1].Get(), pg::DataException);
+
+  ASSERT_FALSE(results[2].HasError());
+  EXPECT_EQ((std::tuple<std::string, pg::Bigint>{"foo", 2}),
+            (results[2].Get().Front().As<std::string, pg::Bigint>()));
+
+  ASSERT_FALSE(results[3].HasError());
+  EXPECT_EQ(3, results[3].Get().Size());
+
+  // The connection is usable afterwards
+  EXPECT_EQ(pg::ConnectionState::kIdle, GetConn()->GetState());
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = GetConn()->Execute("select 1"));
+  EXPECT_EQ(1, res.AsSingleRow<int>());
+}
+
+UTEST_P(PostgreConnection, PipelineInTransaction) {
+  CheckConnection(GetConn());
+
+  pg::Transaction trx{std::move(GetConn()), pg::TransactionOptions{}};
+
+  /// [Pipeline sample]
+  pg::Pipeline pipeline;
+  pipeline.Add("select $1::integer", 1).Add("select $1::integer", 2);
+
+  const auto results = trx.ExecutePipelined(pipeline);
+  for (const auto& result : results) {
+    // throws if the statement has failed
+    const auto& res = result.Get();
+    EXPECT_EQ(1, res.Size());
+  }
+  /// [Pipeline sample]
+  ASSERT_EQ(2, results.size());
+  EXPECT_EQ(2, results[1].Get().AsSingleRow<int>());
+
+  pg::Pipeline failing;
+  failing.Add("select 1 / 0").Add("select 1");
+  pg::PipelinedResults failed;
+  UEXPECT_NO_THROW(failed = trx.ExecutePipelined(failing));
+  ASSERT_EQ(2, failed.size());
+  // The transaction is aborted by the first failure
+  EXPECT_TRUE(failed[0].HasError());
+  EXPECT_TRUE(failed[1].HasError());
+  UEXPECT_THROW(failed[1].Get(), pg::Error);
+
+  UEXPECT_NO_THROW(trx.Rollback());
+}
+
+USERVER_NAMESPACE_END
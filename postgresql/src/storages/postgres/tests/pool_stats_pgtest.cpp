@@ -285,6 +285,30 @@ UTEST_F(PostgrePoolStats, MaxPreparedCacheSize) {
             conn_settings.max_prepared_cache_size);
 }
 
+UTEST_F(PostgrePoolStats, PreparedStatementAffinity) {
+  pg::PoolSettings pool_settings{2, 10, 10};
+  pool_settings.prepared_statement_affinity = true;
+
+  auto pool = pg::detail::ConnectionPool::Create(
+      GetDsnFromEnv(), nullptr, GetTaskProcessor(), "",
+      storages::postgres::InitMode::kSync, pool_settings,
+      kCachePreparedStatements, {}, GetTestCmdCtls(), {}, {}, {},
+      dynamic_config::GetDefaultSource());
+
+  const std::string statement = "select 1";
+  for (int i = 0; i < 5; ++i) {
+    auto conn = pool->Acquire(MakeDeadline(), statement);
+    CheckConnection(conn);
+    UEXPECT_NO_THROW(conn->Execute(statement));
+  }
+
+  const auto& stats = pool->GetStatistics();
+  EXPECT_EQ(stats.connection.prepared_affinity_miss, 1);
+  EXPECT_EQ(stats.connection.prepared_affinity_hit, 4);
+  EXPECT_EQ(stats.transaction.parse_total, 1);
+  EXPECT_EQ(stats.transaction.prepared_reuse_total, 4);
+}
+
 }  // namespace
 
 USERVER_NAMESPACE_END
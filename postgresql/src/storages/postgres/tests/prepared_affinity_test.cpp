@@ -0,0 +1,96 @@
+#include <storages/postgres/detail/prepared_affinity.hpp>
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using Affinity = storages::postgres::detail::PreparedStatementAffinity;
+
+constexpr Affinity::StatementHash kStatement = 42;
+constexpr Affinity::StatementHash kOtherStatement = 43;
+
+}  // namespace
+
+TEST(PostgrePreparedAffinity, Slots) {
+  Affinity affinity{2};
+  EXPECT_EQ(affinity.OccupySlot(), 0);
+  EXPECT_EQ(affinity.OccupySlot(), 1);
+  EXPECT_EQ(affinity.OccupySlot(), Affinity::kNoSlot);
+
+  affinity.FreeSlot(0);
+  EXPECT_EQ(affinity.OccupySlot(), 0);
+
+  affinity.SetMaxSlots(100);
+  EXPECT_EQ(affinity.GetMaxSlots(), 100);
+  EXPECT_EQ(affinity.OccupySlot(), 2);
+
+  affinity.SetMaxSlots(10);
+  EXPECT_EQ(affinity.GetMaxSlots(), 100);
+}
+
+TEST(PostgrePreparedAffinity, PrefersPrepared) {
+  Affinity affinity{100};
+  for (std::size_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(affinity.OccupySlot(), i);
+    affinity.MarkIdle(i);
+  }
+  affinity.MarkPrepared(70, kStatement);
+  affinity.MarkPrepared(71, kOtherStatement);
+
+  for (int i = 0; i < 10; ++i) {
+    const auto acquired = affinity.AcquireIdle(kStatement);
+    ASSERT_TRUE(acquired);
+    EXPECT_EQ(acquired->slot, 70);
+    EXPECT_TRUE(acquired->is_prepared);
+    affinity.MarkIdle(acquired->slot);
+  }
+
+  // falls back while the only prepared slot is busy
+  ASSERT_EQ(affinity.AcquireIdle(kStatement)->slot, 70);
+  const auto fallback = affinity.AcquireIdle(kStatement);
+  ASSERT_TRUE(fallback);
+  EXPECT_NE(fallback->slot, 70);
+  EXPECT_FALSE(fallback->is_prepared);
+  EXPECT_EQ(affinity.GetIdleCount(), 98);
+}
+
+TEST(PostgrePreparedAffinity, FairFallback) {
+  constexpr std::size_t kSlots = 130;
+  Affinity affinity{kSlots};
+  for (std::size_t i = 0; i < kSlots; ++i) {
+    affinity.OccupySlot();
+    affinity.MarkIdle(i);
+  }
+
+  // every idle slot is handed out before any of them is reused
+  std::set<std::size_t> seen;
+  for (std::size_t i = 0; i < kSlots; ++i) {
+    const auto acquired = affinity.AcquireIdle(std::nullopt);
+    ASSERT_TRUE(acquired);
+    EXPECT_FALSE(acquired->is_prepared);
+    seen.insert(acquired->slot);
+    affinity.MarkIdle(acquired->slot);
+  }
+  EXPECT_EQ(seen.size(), kSlots);
+}
+
+TEST(PostgrePreparedAffinity, FreeSlotForgetsStatements) {
+  Affinity affinity{4};
+  for (std::size_t i = 0; i < 4; ++i) affinity.OccupySlot();
+  affinity.MarkPrepared(3, kStatement);
+  affinity.FreeSlot(3);
+  EXPECT_EQ(affinity.OccupySlot(), 3);
+
+  affinity.MarkIdle(3);
+  const auto acquired = affinity.AcquireIdle(kStatement);
+  ASSERT_TRUE(acquired);
+  EXPECT_EQ(acquired->slot, 3);
+  EXPECT_FALSE(acquired->is_prepared);
+  EXPECT_FALSE(affinity.AcquireIdle(kStatement));
+}
+
+USERVER_NAMESPACE_END
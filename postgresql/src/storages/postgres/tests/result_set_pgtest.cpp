@@ -6,6 +6,26 @@ USERVER_NAMESPACE_BEGIN
 
 namespace pg = storages::postgres;
 
+namespace {
+
+struct ColumnarRow {
+  pg::Bigint id;
+  std::string name;
+  std::optional<pg::Integer> value;
+};
+
+struct ColumnarColumns {
+  std::vector<pg::Bigint> id;
+  pg::StringColumn name;
+  std::vector<std::optional<pg::Integer>> value;
+};
+
+constexpr const char* kColumnarQuery =
+    "select i::bigint, 'name' || i, nullif(i, 2)::integer "
+    "from generate_series(1, 3) as i";
+
+}  // namespace
+
 UTEST_P(PostgreConnection, EmptyResult) {
   CheckConnection(GetConn());
 
@@ -147,4 +167,54 @@ UTEST_P(PostgreConnection, ResultAsOptionalSingleRow) {
   UEXPECT_THROW(res.AsOptionalSingleRow<int>(), pg::NonSingleRowResultSet);
 }
 
+UTEST_P(PostgreConnection, ResultAsColumn) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = GetConn()->Execute(kColumnarQuery));
+  ASSERT_EQ(3, res.Size());
+
+  EXPECT_EQ(res.AsColumn<pg::Bigint>(0), (std::vector<pg::Bigint>{1, 2, 3}));
+  EXPECT_EQ(res.AsColumn<std::string>(1),
+            (std::vector<std::string>{"name1", "name2", "name3"}));
+  EXPECT_EQ(res.AsColumn<std::optional<pg::Integer>>(2),
+            (std::vector<std::optional<pg::Integer>>{1, std::nullopt, 3}));
+
+  UEXPECT_THROW(res.AsColumn<pg::Integer>(2), pg::FieldValueIsNull);
+  UEXPECT_THROW(res.AsColumn<pg::Bigint>(3), pg::FieldIndexOutOfBounds);
+
+  const auto names = res.GetStringColumn(1);
+  ASSERT_EQ(3, names.Size());
+  EXPECT_EQ("name1", names[0]);
+  EXPECT_EQ("name2", names[1]);
+  EXPECT_EQ("name3", names[2]);
+  UEXPECT_THROW(res.GetStringColumn(2), pg::FieldValueIsNull);
+}
+
+UTEST_P(PostgreConnection, ResultAsColumns) {
+  CheckConnection(GetConn());
+
+  pg::ResultSet res{nullptr};
+  UEXPECT_NO_THROW(res = GetConn()->Execute(kColumnarQuery));
+
+  const auto columns = res.AsColumns<ColumnarColumns>();
+  EXPECT_EQ(columns.id, (std::vector<pg::Bigint>{1, 2, 3}));
+  ASSERT_EQ(3, columns.name.Size());
+  EXPECT_EQ("name3", columns.name[2]);
+  EXPECT_EQ(columns.value,
+            (std::vector<std::optional<pg::Integer>>{1, std::nullopt, 3}));
+
+  /// [ColumnarTagSnippet]
+  auto rows = res.AsContainer<std::vector<ColumnarRow>>(pg::kColumnarTag);
+  /// [ColumnarTagSnippet]
+  ASSERT_EQ(3, rows.size());
+  EXPECT_EQ(2, rows[1].id);
+  EXPECT_EQ("name2", rows[1].name);
+  EXPECT_FALSE(rows[1].value.has_value());
+  EXPECT_EQ(3, rows[2].value);
+
+  UEXPECT_THROW(res.AsColumns<std::tuple<std::vector<pg::Bigint>>>(),
+                pg::FieldTupleMismatch);
+}
+
 USERVER_NAMESPACE_END
@@ -51,6 +51,19 @@ ResultSet Transaction::Execute(OptionalCommandControl statement_cmd_ctl,
                    statement_cmd_ctl);
 }
 
+PipelinedResults Transaction::ExecutePipelined(
+    OptionalCommandControl statement_cmd_ctl, const Pipeline& pipeline) {
+  if (!conn_) {
+    LOG_LIMITED_ERROR() << "Execute called after transaction finished"
+                        << logging::LogExtra::Stacktrace();
+    throw NotInTransaction("Transaction handle is not valid");
+  }
+  auto source = conn_.GetConfigSource();
+  if (source) CheckDeadlineIsExpired(source->GetSnapshot());
+
+  return conn_->ExecutePipelined(pipeline, std::move(statement_cmd_ctl));
+}
+
 Portal Transaction::MakePortal(OptionalCommandControl statement_cmd_ctl,
                                const Query& query,
                                const ParameterStore& store) {
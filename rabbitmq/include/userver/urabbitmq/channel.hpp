@@ -15,6 +15,34 @@ namespace urabbitmq {
 
 class ConnectionPtr;
 
+namespace impl {
+class ResponseAwaiter;
+}  // namespace impl
+
+/// @brief Pending broker confirmation of a message published with
+/// `ReliableChannel::PublishReliableAsync`.
+///
+/// Holds one of the `max_in_flight_requests` slots of the channel connection
+/// until destroyed, must not outlive the `ReliableChannel`.
+class PublishConfirmation final {
+ public:
+  ~PublishConfirmation();
+
+  PublishConfirmation(PublishConfirmation&& other) noexcept;
+
+  /// @brief Waits for the broker to confirm the message.
+  /// Throws if the broker rejected the message, the channel broke or the
+  /// deadline was reached.
+  void Wait(engine::Deadline deadline);
+
+ private:
+  friend class ReliableChannel;
+
+  explicit PublishConfirmation(impl::ResponseAwaiter&& awaiter);
+
+  std::unique_ptr<impl::ResponseAwaiter> awaiter_;
+};
+
 /// @brief Publisher interface for the broker.
 /// You may use this class to publish your messages.
 ///
@@ -77,6 +105,19 @@ class ReliableChannel final : IReliableChannelInterface {
                     deadline);
   }
 
+  /// @brief Publishes the message without waiting for the broker to confirm
+  /// it, so that many messages could be in flight at once.
+  ///
+  /// Waits for a free in-flight slot if `max_in_flight_requests` messages of
+  /// the channel are still pending, so destroy or wait the confirmations in
+  /// the order of publishing. The broker confirms messages of the channel in
+  /// order as well.
+  ///
+  /// @snippet tests/publish_consume_rmqtest.cpp  Publish reliable async sample
+  [[nodiscard]] PublishConfirmation PublishReliableAsync(
+      const Exchange& exchange, const std::string& routing_key,
+      const std::string& message, MessageType type, engine::Deadline deadline);
+
  private:
   utils::FastPimpl<ConnectionPtr, 32, 8> impl_;
 };
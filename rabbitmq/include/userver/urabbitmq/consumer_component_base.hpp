@@ -34,10 +34,12 @@ namespace urabbitmq {
 /// @snippet samples/rabbitmq_service/static_config.yaml  RabbitMQ consumer sample - static config
 ///
 /// ## Static options:
-/// Name             | Description
-/// rabbit_name      | Name of the RabbitMQ component to use for consumption
-/// queue            | Name of the queue to consume from
-/// prefetch_count   | prefetch_count for the consumer, limits the amount of in-flight messages
+/// Name               | Description
+/// rabbit_name        | Name of the RabbitMQ component to use for consumption
+/// queue              | Name of the queue to consume from
+/// prefetch_count     | prefetch_count for the consumer, limits the amount of in-flight messages
+/// ack_batch_size     | number of processed messages acknowledged with a single `basic.ack`, 1 by default
+/// ack_flush_interval | max time the batched acknowledgements wait to be sent, 100ms by default
 ///
 // clang-format on
 class ConsumerComponentBase : public components::LoggableComponentBase {
@@ -3,7 +3,9 @@
 /// @file userver/urabbitmq/consumer_settings.hpp
 /// @brief Consumer settings.
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 
 #include <userver/urabbitmq/typedefs.hpp>
 
@@ -24,6 +26,19 @@ struct ConsumerSettings final {
   /// Settings this value to 1 basically makes a consumer synchronous, which
   /// could be of use for some workloads
   std::uint16_t prefetch_count;
+
+  /// Number of processed messages to acknowledge with a single `basic.ack`
+  /// (with `multiple` flag set). Messages are processed concurrently, so only
+  /// the contiguous range of the earliest processed deliveries is acknowledged
+  /// at once.
+  ///
+  /// Should be noticeably less than `prefetch_count`, otherwise the broker
+  /// stops delivering and acknowledgements are sent only by
+  /// `ack_flush_interval`. 1 acknowledges every message on its own.
+  std::size_t ack_batch_size{1};
+
+  /// Max time the batched acknowledgements wait to be sent
+  std::chrono::milliseconds ack_flush_interval{100};
 };
 
 }  // namespace urabbitmq
@@ -1,6 +1,8 @@
 #include "utils_rmqtest.hpp"
 
+#include <deque>
 #include <optional>
+#include <unordered_set>
 
 #include <userver/engine/sleep.hpp>
 #include <userver/utils/uuid4.hpp>
@@ -75,6 +77,47 @@ class ThrowingConsumer final : public urabbitmq::ConsumerBase {
   engine::ConditionVariable cond_;
 };
 
+// Fails the odd messages on their first delivery
+class FlakyConsumer final : public urabbitmq::ConsumerBase {
+ public:
+  using urabbitmq::ConsumerBase::ConsumerBase;
+  ~FlakyConsumer() override { Stop(); }
+
+  void Process(std::string message) override {
+    if (std::stoul(message) % 2 == 1) {
+      auto failed = failed_.Lock();
+      if (failed->insert(message).second) {
+        throw std::runtime_error{"first delivery of " + message};
+      }
+    }
+
+    if (++consumed_ == expected_consumed_) {
+      event_.Send();
+    }
+  }
+
+  void ExpectConsume(size_t count) { expected_consumed_ = count; }
+
+  size_t Wait() {
+    [[maybe_unused]] auto res = event_.WaitForEventFor(utest::kMaxTestWaitTime);
+    return consumed_;
+  }
+
+ private:
+  concurrent::Variable<std::unordered_set<std::string>> failed_;
+  std::atomic<size_t> expected_consumed_{0};
+  std::atomic<size_t> consumed_{0};
+  engine::SingleConsumerEvent event_;
+};
+
+void PublishMessages(const ClientWrapper& client, size_t messages_count) {
+  for (size_t i = 0; i < messages_count; ++i) {
+    client->PublishReliable(
+        client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+        urabbitmq::MessageType::kTransient, client.GetDeadline());
+  }
+}
+
 }  // namespace
 
 UTEST(Consumer, CreateOnInvalidQueueWorks) {
@@ -234,4 +277,73 @@ UTEST(Consumer, ForDifferentQueuesWork) {
       .RemoveQueue(second_queue, client.GetDeadline());
 }
 
+UTEST(Consumer, BatchedAcksWork) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{
+      client.GetQueue(), 20, 8, std::chrono::milliseconds{50}};
+
+  const size_t messages_count = 1000;
+  PublishMessages(client, messages_count);
+
+  Consumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+  EXPECT_EQ(consumer.Wait().size(), messages_count);
+  consumer.Stop();
+
+  // everything is acked, nothing is redelivered
+  Consumer second_consumer{client.Get(), settings};
+  second_consumer.Start();
+  engine::InterruptibleSleepFor(std::chrono::milliseconds{200});
+  second_consumer.Stop();
+  EXPECT_TRUE(second_consumer.Get().empty());
+}
+
+UTEST(Consumer, BatchedAcksWithRequeuesWork) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const urabbitmq::ConsumerSettings settings{
+      client.GetQueue(), 20, 8, std::chrono::milliseconds{50}};
+
+  const size_t messages_count = 200;
+  PublishMessages(client, messages_count);
+
+  FlakyConsumer consumer{client.Get(), settings};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+  EXPECT_EQ(consumer.Wait(), messages_count);
+}
+
+UTEST(ReliableChannel, PublishReliableAsyncWorks) {
+  ClientWrapper client{};
+  client.SetupRmqEntities();
+  const size_t messages_count = 1000;
+
+  /// [Publish reliable async sample]
+  // not more than max_in_flight_requests of the client
+  const size_t max_in_flight = 5;
+  auto channel = client->GetReliableChannel(client.GetDeadline());
+
+  std::deque<urabbitmq::PublishConfirmation> in_flight;
+  for (size_t i = 0; i < messages_count; ++i) {
+    if (in_flight.size() == max_in_flight) {
+      in_flight.front().Wait(client.GetDeadline());
+      in_flight.pop_front();
+    }
+    in_flight.push_back(channel.PublishReliableAsync(
+        client.GetExchange(), client.GetRoutingKey(), std::to_string(i),
+        urabbitmq::MessageType::kTransient, client.GetDeadline()));
+  }
+  for (auto& confirmation : in_flight) {
+    confirmation.Wait(client.GetDeadline());
+  }
+  /// [Publish reliable async sample]
+
+  Consumer consumer{client.Get(), {client.GetQueue(), 10}};
+  consumer.ExpectConsume(messages_count);
+  consumer.Start();
+  EXPECT_EQ(consumer.Wait().size(), messages_count);
+}
+
 USERVER_NAMESPACE_END
@@ -1,12 +1,36 @@
 #include <userver/urabbitmq/channel.hpp>
 
+#include <userver/utils/assert.hpp>
+
 #include <urabbitmq/connection_helper.hpp>
 #include <urabbitmq/connection_ptr.hpp>
+#include <urabbitmq/impl/response_awaiter.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace urabbitmq {
 
+PublishConfirmation::PublishConfirmation(impl::ResponseAwaiter&& awaiter)
+    : awaiter_{std::make_unique<impl::ResponseAwaiter>(std::move(awaiter))} {
+  // the moved-out awaiter has nothing to wait for
+  awaiter.Ignore();
+  // The span would become the parent of unrelated spans of the caller while
+  // the confirmation is pending, so it covers only the publishing itself
+  awaiter_->ResetSpan();
+}
+
+PublishConfirmation::~PublishConfirmation() {
+  if (awaiter_) awaiter_->Ignore();
+}
+
+PublishConfirmation::PublishConfirmation(PublishConfirmation&& other) noexcept =
+    default;
+
+void PublishConfirmation::Wait(engine::Deadline deadline) {
+  UINVARIANT(awaiter_, "Waiting for a moved-out PublishConfirmation");
+  awaiter_->Wait(deadline);
+}
+
 Channel::Channel(ConnectionPtr&& channel) : impl_{std::move(channel)} {}
 
 Channel::~Channel() = default;
@@ -44,6 +68,13 @@ void ReliableChannel::PublishReliable(const Exchange& exchange,
       .Wait(deadline);
 }
 
+PublishConfirmation ReliableChannel::PublishReliableAsync(
+    const Exchange& exchange, const std::string& routing_key,
+    const std::string& message, MessageType type, engine::Deadline deadline) {
+  return PublishConfirmation{ConnectionHelper::PublishReliable(
+      *impl_, exchange, routing_key, message, type, deadline)};
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
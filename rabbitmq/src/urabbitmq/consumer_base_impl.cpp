@@ -28,6 +28,8 @@ ConsumerBaseImpl::ConsumerBaseImpl(ConnectionPtr&& connection,
     : dispatcher_{engine::current_task::GetTaskProcessor()},
       queue_name_{settings.queue.GetUnderlying()},
       prefetch_count_{settings.prefetch_count},
+      ack_batch_size_{settings.ack_batch_size},
+      ack_flush_interval_{settings.ack_flush_interval},
       connection_ptr_{std::move(connection)},
       channel_{connection_ptr_->GetChannel()} {
   // We take ownership of the connection, because if it remains pooled
@@ -43,6 +45,11 @@ void ConsumerBaseImpl::Start(DispatchCallback cb) {
 
   dispatch_callback_ = std::move(cb);
 
+  if (ack_batch_size_ > 1) {
+    ack_flush_task_.Start(fmt::format("consumer_acks_{}", queue_name_),
+                          {ack_flush_interval_}, [this] { FlushAcks(); });
+  }
+
   LOG_INFO() << "Starting a consumer for '" << queue_name_ << "' queue";
 
   channel_.SetupConsumer(
@@ -79,6 +86,13 @@ void ConsumerBaseImpl::Stop() {
   // Cancel all the active dispatched tasks
   bts_.CancelAndWait();
 
+  ack_flush_task_.Stop();
+  try {
+    FlushAcks();
+  } catch (const std::exception&) {
+    // Unacked messages will be requeued by RabbitMQ
+  }
+
   // Destroy the connection: at this point all the remaining tasks are stopped,
   // consumer is either stopped or in unknown state - that could happen if we
   // didn't receive onSuccess callback yet.
@@ -98,6 +112,9 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
   std::string trace_id = message.headers().get("u-trace-id");
   std::string message_data{message.body(), message.bodySize()};
 
+  uint64_t no_delivery_tag = 0;
+  first_delivery_tag_.compare_exchange_strong(no_delivery_tag, delivery_tag);
+
   bts_.Detach(engine::AsyncNoSpan(
       dispatcher_, [this, message = std::move(message_data),
                     span_name = std::move(span_name),
@@ -114,12 +131,7 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
         }
 
         try {
-          if (success) {
-            channel_.Ack(delivery_tag, {});
-            channel_.AccountMessageConsumed();
-          } else {
-            channel_.Reject(delivery_tag, true, {});
-          }
+          Settle(delivery_tag, success);
         } catch (const std::exception& ex) {
           LOG_WARNING()
               << "Failed to " << (success ? "ack" : "requeue")
@@ -128,6 +140,76 @@ void ConsumerBaseImpl::OnMessage(const AMQP::Message& message,
       }));
 }
 
+void ConsumerBaseImpl::Settle(uint64_t delivery_tag, bool success) {
+  if (ack_batch_size_ > 1) {
+    SettleBatched(delivery_tag, success);
+  } else if (success) {
+    channel_.Ack(delivery_tag, false, {});
+  } else {
+    channel_.Reject(delivery_tag, true, {});
+  }
+
+  if (success) {
+    channel_.AccountMessageConsumed();
+  }
+}
+
+void ConsumerBaseImpl::SettleBatched(uint64_t delivery_tag, bool success) {
+  // The requeue is sent before the delivery joins the settled range, so that
+  // an ack with `multiple` flag never covers it
+  if (!success) {
+    try {
+      channel_.Reject(delivery_tag, true, {});
+    } catch (const std::exception&) {
+      // The delivery still joins the range, otherwise the batched acks would
+      // stop at it forever. The requeue fails only if the channel is broken,
+      // and RabbitMQ requeues the unacked deliveries of a closed channel.
+      MarkSettled(delivery_tag, false);
+      throw;
+    }
+  }
+
+  MarkSettled(delivery_tag, success);
+}
+
+void ConsumerBaseImpl::MarkSettled(uint64_t delivery_tag, bool acked) {
+  auto pending = pending_acks_.Lock();
+  if (pending->settled_up_to == 0) {
+    pending->settled_up_to = first_delivery_tag_.load() - 1;
+  }
+
+  auto& settled_ahead = pending->settled_ahead;
+  settled_ahead.emplace(delivery_tag, acked);
+  for (auto it = settled_ahead.begin();
+       it != settled_ahead.end() && it->first == pending->settled_up_to + 1;
+       it = settled_ahead.erase(it)) {
+    ++pending->settled_up_to;
+    if (it->second) {
+      pending->ack_up_to = it->first;
+      ++pending->acks_count;
+    }
+  }
+
+  if (pending->acks_count >= ack_batch_size_) {
+    SendAcks(*pending);
+  }
+}
+
+void ConsumerBaseImpl::FlushAcks() {
+  auto pending = pending_acks_.Lock();
+  SendAcks(*pending);
+}
+
+void ConsumerBaseImpl::SendAcks(PendingAcks& pending) {
+  // Sent under the lock: an ack with `multiple` flag for an already acked
+  // delivery tag is a channel error
+  if (pending.ack_up_to == 0) return;
+
+  channel_.Ack(pending.ack_up_to, true, {});
+  pending.ack_up_to = 0;
+  pending.acks_count = 0;
+}
+
 }  // namespace urabbitmq
 
 USERVER_NAMESPACE_END
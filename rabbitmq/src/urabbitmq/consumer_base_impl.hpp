@@ -1,9 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
 
 #include <userver/concurrent/background_task_storage.hpp>
+#include <userver/concurrent/variable.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/utils/periodic_task.hpp>
 
 #include <urabbitmq/connection_ptr.hpp>
 
@@ -32,12 +37,31 @@ class ConsumerBaseImpl final {
   bool IsBroken() const;
 
  private:
+  // Deliveries that are settled (acked or requeued) but whose acks are not
+  // sent to the broker yet
+  struct PendingAcks final {
+    // every delivery up to this tag is settled
+    uint64_t settled_up_to{0};
+    // the latest acked delivery up to settled_up_to, 0 if none is pending
+    uint64_t ack_up_to{0};
+    std::size_t acks_count{0};
+    // deliveries settled out of order, delivery tag -> whether it is acked
+    std::map<uint64_t, bool> settled_ahead;
+  };
+
   void OnMessage(const AMQP::Message& message, uint64_t delivery_tag);
+  void Settle(uint64_t delivery_tag, bool success);
+  void SettleBatched(uint64_t delivery_tag, bool success);
+  void MarkSettled(uint64_t delivery_tag, bool acked);
+  void FlushAcks();
+  void SendAcks(PendingAcks& pending);
   void Stop();
 
   engine::TaskProcessor& dispatcher_;
   const std::string queue_name_;
   uint16_t prefetch_count_;
+  const std::size_t ack_batch_size_;
+  const std::chrono::milliseconds ack_flush_interval_;
 
   ConnectionPtr connection_ptr_;
   impl::AmqpChannel& channel_;
@@ -48,6 +72,12 @@ class ConsumerBaseImpl final {
 
   std::atomic<bool> stopped_{false};
 
+  // Delivery tags of a channel are sequential, but the channel might have
+  // received deliveries before the consumer was set up
+  std::atomic<uint64_t> first_delivery_tag_{0};
+  concurrent::Variable<PendingAcks> pending_acks_;
+  utils::PeriodicTask ack_flush_task_;
+
   // Underlying channel errored, just restart the consumer
   // (consumer_base polls this and destructs+constructs us if we broke)
   std::atomic<bool> broken_{false};
@@ -17,7 +17,16 @@ ConsumerSettings Parse(const yaml_config::YamlConfig& config,
   settings.queue = Queue{config["queue"].As<std::string>()};
   settings.prefetch_count = config["prefetch_count"].As<uint16_t>();
 
+  settings.ack_batch_size =
+      config["ack_batch_size"].As<std::size_t>(settings.ack_batch_size);
+  settings.ack_flush_interval =
+      config["ack_flush_interval"].As<std::chrono::milliseconds>(
+          settings.ack_flush_interval);
+
   UINVARIANT(settings.prefetch_count > 0, "prefetch_count is set to zero");
+  UINVARIANT(settings.ack_batch_size > 0, "ack_batch_size is set to zero");
+  UINVARIANT(settings.ack_flush_interval.count() > 0,
+             "ack_flush_interval is not positive");
 
   return settings;
 }
@@ -76,6 +85,15 @@ properties:
     prefetch_count:
         type: integer
         description: prefetch_count for the consumer
+    ack_batch_size:
+        type: integer
+        description: number of processed messages acknowledged at once
+        defaultDescription: 1
+        minimum: 1
+    ack_flush_interval:
+        type: string
+        description: max time the batched acknowledgements wait to be sent
+        defaultDescription: 100ms
 )");
 }
 
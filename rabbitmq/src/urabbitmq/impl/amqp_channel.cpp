@@ -180,10 +180,11 @@ void AmqpChannel::Publish(const Exchange& exchange,
   // We don't account publish here, because there's no way to ensure success
 }
 
-void AmqpChannel::Ack(uint64_t delivery_tag, engine::Deadline deadline) {
+void AmqpChannel::Ack(uint64_t delivery_tag, bool multiple,
+                      engine::Deadline deadline) {
   // No way to acknowledge success, no way to handle synchronous errors
   auto channel = conn_.GetChannel(deadline);
-  channel->ack(delivery_tag);
+  channel->ack(delivery_tag, multiple ? AMQP::multiple : 0);
 }
 
 void AmqpChannel::Reject(uint64_t delivery_tag, bool requeue,
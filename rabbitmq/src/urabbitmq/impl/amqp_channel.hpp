@@ -57,7 +57,7 @@ class AmqpChannel final {
                const std::string& message, MessageType type,
                engine::Deadline deadline);
 
-  void Ack(uint64_t delivery_tag, engine::Deadline deadline);
+  void Ack(uint64_t delivery_tag, bool multiple, engine::Deadline deadline);
 
   void Reject(uint64_t delivery_tag, bool requeue, engine::Deadline deadline);
 
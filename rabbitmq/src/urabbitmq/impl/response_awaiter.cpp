@@ -28,6 +28,8 @@ void ResponseAwaiter::SetSpan(tracing::Span&& span) {
   span_.emplace(std::move(span));
 }
 
+void ResponseAwaiter::ResetSpan() noexcept { span_.reset(); }
+
 void ResponseAwaiter::Wait(engine::Deadline deadline) const {
 #ifndef NDEBUG
   awaited_ = true;
@@ -35,6 +37,12 @@ void ResponseAwaiter::Wait(engine::Deadline deadline) const {
   GetWrapper()->Wait(deadline);
 }
 
+void ResponseAwaiter::Ignore() const noexcept {
+#ifndef NDEBUG
+  awaited_ = true;
+#endif
+}
+
 const std::shared_ptr<DeferredWrapper>& ResponseAwaiter::GetWrapper() const {
   return wrapper_;
 }
@@ -21,8 +21,13 @@ class ResponseAwaiter final {
   ResponseAwaiter(ResponseAwaiter&& other) noexcept;
 
   void SetSpan(tracing::Span&& span);
+  // Finishes the span right away, without waiting for the response
+  void ResetSpan() noexcept;
   void Wait(engine::Deadline deadline) const;
 
+  // Marks the response as deliberately not awaited
+  void Ignore() const noexcept;
+
   const std::shared_ptr<DeferredWrapper>& GetWrapper() const;
 
  private:
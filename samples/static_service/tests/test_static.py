@@ -27,3 +27,75 @@ async def test_hidden_file(service_client, service_source_dir):
     response = await service_client.get('/dir1/.hidden_file.txt')
     assert response.status == 404
     assert response.content.decode() == 'File not found'
+
+
+# Disable precompressed variants for byte-exact checks
+IDENTITY = {'Accept-Encoding': 'identity'}
+
+
+async def test_etag(service_client):
+    response = await service_client.get('/index.html', headers=IDENTITY)
+    assert response.status == 200
+    etag = response.headers['ETag']
+
+    response = await service_client.get(
+        '/index.html', headers={**IDENTITY, 'If-None-Match': etag},
+    )
+    assert response.status == 304
+    assert response.headers['ETag'] == etag
+    assert response.content == b''
+
+    response = await service_client.get(
+        '/index.html', headers={**IDENTITY, 'If-None-Match': '"other"'},
+    )
+    assert response.status == 200
+
+
+async def test_range(service_client, service_source_dir):
+    content = (service_source_dir / 'public' / 'index.html').read_bytes()
+
+    response = await service_client.get(
+        '/index.html', headers={**IDENTITY, 'Range': 'bytes=1-5'},
+    )
+    assert response.status == 206
+    assert response.headers['Content-Range'] == f'bytes 1-5/{len(content)}'
+    assert response.content == content[1:6]
+
+    response = await service_client.get(
+        '/index.html', headers={**IDENTITY, 'Range': 'bytes=-4'},
+    )
+    assert response.status == 206
+    assert response.content == content[-4:]
+
+    response = await service_client.get(
+        '/index.html', headers={**IDENTITY, 'Range': f'bytes={len(content)}-'},
+    )
+    assert response.status == 416
+    assert response.headers['Content-Range'] == f'bytes */{len(content)}'
+
+    response = await service_client.get(
+        '/index.html', headers={**IDENTITY, 'Range': 'bytes=0-1,3-4'},
+    )
+    assert response.status == 200
+    assert response.content == content
+
+
+async def test_precompressed(service_client, service_source_dir):
+    public = service_source_dir / 'public'
+
+    response = await service_client.get(
+        '/index.html', headers={'Accept-Encoding': 'gzip'},
+    )
+    assert response.status == 200
+    assert response.headers['Content-Type'] == 'text/html'
+    assert response.headers['Vary'] == 'Accept-Encoding'
+    assert response.headers['Content-Encoding'] == 'gzip'
+    # the client decodes the body
+    assert response.content == (public / 'index.html').read_bytes()
+
+    response = await service_client.get(
+        '/index.html', headers={'Accept-Encoding': 'gzip;q=0, identity'},
+    )
+    assert response.status == 200
+    assert 'Content-Encoding' not in response.headers
+    assert response.content == (public / 'index.html').read_bytes()
@@ -3,7 +3,12 @@
 /// @file userver/utils/trivial_map.hpp
 /// @brief Bidirectional map|sets over string literals or other trivial types.
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -326,22 +331,30 @@ class SwitchBySecond final {
   SearchState<Second, First> state_;
 };
 
-template <typename First, typename Second>
+// Each Case() increments the Size, so that the count of Case's is known at
+// compile time from the type of the result
+template <typename First, typename Second, std::size_t Size>
 class SwitchTypesDetected final {
  public:
   using first_type = First;
   using second_type = Second;
+  static constexpr std::size_t kSize = Size;
 
-  constexpr SwitchTypesDetected& Case(First, Second) noexcept { return *this; }
+  constexpr auto Case(First, Second) noexcept {
+    return SwitchTypesDetected<First, Second, Size + 1>{};
+  }
 };
 
-template <typename First>
-class SwitchTypesDetected<First, void> final {
+template <typename First, std::size_t Size>
+class SwitchTypesDetected<First, void, Size> final {
  public:
   using first_type = First;
   using second_type = void;
+  static constexpr std::size_t kSize = Size;
 
-  constexpr SwitchTypesDetected& Case(First) noexcept { return *this; }
+  constexpr auto Case(First) noexcept {
+    return SwitchTypesDetected<First, void, Size + 1>{};
+  }
 };
 
 class SwitchTypesDetector final {
@@ -356,7 +369,7 @@ class SwitchTypesDetector final {
     using second_type =
         std::conditional_t<std::is_convertible_v<Second, std::string_view>,
                            std::string_view, Second>;
-    return SwitchTypesDetected<first_type, second_type>{};
+    return SwitchTypesDetected<first_type, second_type, 1>{};
   }
 
   template <typename First>
@@ -364,7 +377,7 @@ class SwitchTypesDetector final {
     using first_type =
         std::conditional_t<std::is_convertible_v<First, std::string_view>,
                            std::string_view, First>;
-    return SwitchTypesDetected<first_type, void>{};
+    return SwitchTypesDetected<first_type, void, 1>{};
   }
 };
 
@@ -481,6 +494,532 @@ class CaseFirstIndexer final {
   std::size_t index_ = 0;
 };
 
+// Perfect hashing of string Case's, see TrivialBiMap docs.
+//
+// While the compiler inlines the Case chain, it dispatches on the string
+// length and is faster than hashing unless many Case's share a length. Long
+// Case chains are often left not inlined and are searched linearly. With
+// GCC -O2, ns per 10 lookups, Case chain vs the index:
+//   37 keys with 3 lengths and a common prefix:    19 vs 81
+//   32 keys of the same length:                    42 vs 53
+//   48 keys of the same length:                    70 vs 52
+//   64 keys, 2 per length, inlined:                19 vs 61
+//   64 HTTP header names, not inlined:            316 vs 52
+//   96 keys, 3 per length:                        223 vs 60
+//
+// The index is built if this count of Case's share a length...
+inline constexpr std::size_t kPerfectHashMinSize = 48;
+// ...or for any lengths starting from this count of Case's
+inline constexpr std::size_t kPerfectHashAnyLengthsSize = 64;
+
+inline constexpr std::uint64_t kPerfectHashMultiplier = 0x9e3779b97f4a7c15;
+
+constexpr std::uint64_t PerfectHashStep(std::uint64_t hash,
+                                       std::uint64_t word) noexcept {
+  hash = (hash ^ word) * kPerfectHashMultiplier;
+  return hash ^ (hash >> 32);
+}
+
+// Lowercases ASCII letters in all the 8 bytes of `word` at once
+constexpr std::uint64_t AsciiToLowerWord(std::uint64_t word) noexcept {
+  constexpr std::uint64_t kOnes = 0x0101010101010101;
+  const auto heptets = word & (0x7f * kOnes);
+  const auto is_ge_a = heptets + (0x80 - 'A') * kOnes;
+  const auto is_gt_z = heptets + (0x80 - 'Z' - 1) * kOnes;
+  const auto is_upper = is_ge_a & ~is_gt_z & ~word & (0x80 * kOnes);
+  return word | (is_upper >> 2);
+}
+
+// Little-endian load of N bytes starting from `pos`
+template <std::size_t N>
+constexpr std::uint64_t PerfectHashLoadBytes(std::string_view value,
+                                             std::size_t pos) noexcept {
+  static_assert(N <= 8);
+  std::uint64_t word = 0;
+  if (__builtin_is_constant_evaluated()) {
+    for (std::size_t i = 0; i < N; ++i) {
+      word |= std::uint64_t{static_cast<unsigned char>(value[pos + i])}
+              << (i * 8);
+    }
+  } else {
+    std::memcpy(&word, value.data() + pos, N);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+  }
+  return word;
+}
+
+template <bool ICase>
+constexpr std::uint64_t PerfectHashLoad(std::string_view value,
+                                        std::size_t pos) noexcept {
+  const auto word = PerfectHashLoadBytes<8>(value, pos);
+  return ICase ? AsciiToLowerWord(word) : word;
+}
+
+// Packs all the bytes of a string shorter than 8 bytes into a word, the
+// mapping is unique for each size
+template <bool ICase>
+constexpr std::uint64_t PerfectHashLoadShort(std::string_view value) noexcept {
+  const auto size = value.size();
+  UASSERT(size < 8);
+  std::uint64_t word = 0;
+  if (size >= 4) {
+    word = PerfectHashLoadBytes<4>(value, 0) |
+           (PerfectHashLoadBytes<4>(value, size - 4) << 32);
+  } else if (size != 0) {
+    word = PerfectHashLoadBytes<1>(value, 0) |
+           (PerfectHashLoadBytes<1>(value, size / 2) << 8) |
+           (PerfectHashLoadBytes<1>(value, size - 1) << 16);
+  }
+  return ICase ? AsciiToLowerWord(word) : word;
+}
+
+// MurmurHash3 finalizer
+constexpr std::uint64_t PerfectHashMix(std::uint64_t hash) noexcept {
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccd;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53;
+  return hash ^ (hash >> 33);
+}
+
+template <bool ICase>
+constexpr std::uint64_t PerfectHashString(std::string_view value,
+                                          std::uint64_t seed) noexcept {
+  const auto size = value.size();
+  auto hash = PerfectHashStep(seed, size);
+  if (size < 8) {
+    return PerfectHashMix(
+        PerfectHashStep(hash, PerfectHashLoadShort<ICase>(value)));
+  }
+
+  for (std::size_t pos = 0; pos + 8 < size; pos += 8) {
+    hash = PerfectHashStep(hash, PerfectHashLoad<ICase>(value, pos));
+  }
+  // The last word overlaps with the previous one if the size is not a
+  // multiple of 8
+  return PerfectHashMix(
+      PerfectHashStep(hash, PerfectHashLoad<ICase>(value, size - 8)));
+}
+
+// Word by word comparison, `key` must be in lower case for ICase
+template <bool ICase>
+constexpr bool PerfectHashEqual(std::string_view key,
+                                std::string_view value) noexcept {
+  const auto size = key.size();
+  if (size != value.size()) return false;
+  if (size < 8) {
+    return PerfectHashLoadShort<false>(key) ==
+           PerfectHashLoadShort<ICase>(value);
+  }
+
+  for (std::size_t pos = 0; pos + 8 < size; pos += 8) {
+    if (PerfectHashLoad<false>(key, pos) !=
+        PerfectHashLoad<ICase>(value, pos)) {
+      return false;
+    }
+  }
+  return PerfectHashLoad<false>(key, size - 8) ==
+         PerfectHashLoad<ICase>(value, size - 8);
+}
+
+constexpr std::size_t PerfectHashCeilPow2(std::size_t value) noexcept {
+  std::size_t result = 1;
+  while (result < value) result *= 2;
+  return result;
+}
+
+// Index over a column of Case's that is not a string. Such columns are
+// searched via the Case's, compilers optimize those into a switch.
+template <typename Key, std::size_t Size>
+class PerfectHashIndex final {
+ public:
+  constexpr void Build(const std::array<Key, Size>&) noexcept {}
+
+  constexpr bool IsBuilt() const noexcept { return false; }
+
+  constexpr bool IsCaseInsensitive() const noexcept { return false; }
+
+  constexpr std::size_t Find(const std::array<Key, Size>&,
+                             Key) const noexcept {
+    return kInvalidSize;
+  }
+
+  constexpr std::size_t FindICase(const std::array<Key, Size>&,
+                                  std::string_view) const noexcept {
+    return kInvalidSize;
+  }
+};
+
+// CHD ('compress, hash and displace') perfect hash over a string column of
+// Case's: the hash of a key selects a bucket, the displacement of the bucket
+// is combined with the hash to select a slot, the slot holds the index of the
+// Case. Displacements are searched at compile time starting from the biggest
+// buckets, so that each key gets its own slot. If some keys could not be
+// separated, the search is repeated with another hash seed.
+//
+// The index is not built if the Case chain is expected to be faster, see
+// kPerfectHashMinSize. If all the keys are in lower case, the hash ignores the
+// case of ASCII letters and the same index serves case insensitive lookups.
+template <std::size_t Size>
+class PerfectHashIndex<std::string_view, Size> final {
+ public:
+  constexpr void Build(
+      const std::array<std::string_view, Size>& keys) noexcept {
+    if (Size < kPerfectHashAnyLengthsSize &&
+        MaxSameLengthKeys(keys) < kPerfectHashMinSize) {
+      return;
+    }
+
+    bool icase = true;
+    for (const auto key : keys) {
+      if (HasUppercaseAscii(key)) icase = false;
+    }
+
+    for (std::uint64_t seed = 0; seed < kMaxSeeds; ++seed) {
+      if (TryBuild(keys, icase, seed)) {
+        seed_ = seed;
+        mode_ = icase ? Mode::kCaseInsensitive : Mode::kCaseSensitive;
+        return;
+      }
+    }
+  }
+
+  constexpr bool IsBuilt() const noexcept { return mode_ != Mode::kNone; }
+
+  constexpr bool IsCaseInsensitive() const noexcept {
+    return mode_ == Mode::kCaseInsensitive;
+  }
+
+  constexpr std::size_t Find(const std::array<std::string_view, Size>& keys,
+                             std::string_view value) const noexcept {
+    UASSERT(IsBuilt());
+    const auto hash = IsCaseInsensitive()
+                          ? PerfectHashString<true>(value, seed_)
+                          : PerfectHashString<false>(value, seed_);
+    const auto index = slots_[Slot(hash)];
+    if (index == kEmpty || !PerfectHashEqual<false>(keys[index], value)) {
+      return kInvalidSize;
+    }
+    return index;
+  }
+
+  constexpr std::size_t FindICase(
+      const std::array<std::string_view, Size>& keys,
+      std::string_view value) const noexcept {
+    UASSERT(IsCaseInsensitive());
+    const auto index = slots_[Slot(PerfectHashString<true>(value, seed_))];
+    if (index == kEmpty || !PerfectHashEqual<true>(keys[index], value)) {
+      return kInvalidSize;
+    }
+    return index;
+  }
+
+ private:
+  enum class Mode : std::uint8_t {
+    kNone,
+    kCaseSensitive,
+    kCaseInsensitive,
+  };
+
+  using SlotValue =
+      std::conditional_t<(Size < 0xff), std::uint8_t, std::uint16_t>;
+  static_assert(Size < 0xffff, "Too many Case's in a TrivialBiMap");
+
+  static constexpr SlotValue kEmpty = std::numeric_limits<SlotValue>::max();
+  static constexpr std::size_t kBuckets = (PerfectHashCeilPow2(Size) + 1) / 2;
+  static constexpr std::size_t kSlots = PerfectHashCeilPow2(Size) * 2;
+  static constexpr std::uint64_t kMaxSeeds = 16;
+  // Keeps the compile time search within the default constexpr limits
+  static constexpr std::uint32_t kMaxDisplacement =
+      std::min<std::size_t>(kSlots * 16, 1 << 16);
+
+  // The bucket is selected by the low bits of the hash, the slot is computed
+  // from the high bits: (f1 + d1 + d0 * f2) mod kSlots, where the
+  // displacement is d0 * kSlots + d1
+  static constexpr std::size_t SlotFor(std::uint64_t hash,
+                                       std::uint32_t displacement) noexcept {
+    const auto f1 = hash >> 32;
+    const auto f2 = (hash >> 16) | 1;
+    const auto d0 = displacement / kSlots;
+    const auto d1 = displacement % kSlots;
+    return (f1 + d1 + d0 * f2) & (kSlots - 1);
+  }
+
+  constexpr std::size_t Slot(std::uint64_t hash) const noexcept {
+    return SlotFor(hash, displacements_[hash & (kBuckets - 1)]);
+  }
+
+  static constexpr std::size_t MaxSameLengthKeys(
+      const std::array<std::string_view, Size>& keys) noexcept {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < Size; ++i) {
+      std::size_t count = 0;
+      for (const auto key : keys) {
+        if (key.size() == keys[i].size()) ++count;
+      }
+      result = std::max(result, count);
+    }
+    return result;
+  }
+
+  constexpr bool TryBuild(const std::array<std::string_view, Size>& keys,
+                          bool icase, std::uint64_t seed) noexcept {
+    std::array<std::uint64_t, Size> hashes{};
+    std::array<std::size_t, kBuckets + 1> bucket_begins{};
+    for (std::size_t i = 0; i < Size; ++i) {
+      hashes[i] = icase ? PerfectHashString<true>(keys[i], seed)
+                        : PerfectHashString<false>(keys[i], seed);
+      ++bucket_begins[(hashes[i] & (kBuckets - 1)) + 1];
+    }
+
+    // Counting sort of the Case indices by buckets, the order of Case's
+    // within a bucket is kept
+    std::size_t max_bucket_size = 0;
+    for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+      max_bucket_size = std::max(max_bucket_size, bucket_begins[bucket + 1]);
+      bucket_begins[bucket + 1] += bucket_begins[bucket];
+    }
+    std::array<std::size_t, Size> sorted{};
+    std::array<std::size_t, kBuckets> bucket_fill{};
+    for (std::size_t i = 0; i < Size; ++i) {
+      const auto bucket = hashes[i] & (kBuckets - 1);
+      sorted[bucket_begins[bucket] + bucket_fill[bucket]++] = i;
+    }
+
+    for (auto& slot : slots_) slot = kEmpty;
+    for (auto size = max_bucket_size; size > 0; --size) {
+      for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+        const auto begin = bucket_begins[bucket];
+        if (bucket_begins[bucket + 1] - begin != size) continue;
+        if (!PlaceBucket(bucket, keys, hashes, sorted, begin, begin + size)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  constexpr bool PlaceBucket(std::size_t bucket,
+                             const std::array<std::string_view, Size>& keys,
+                             const std::array<std::uint64_t, Size>& hashes,
+                             const std::array<std::size_t, Size>& sorted,
+                             std::size_t begin, std::size_t end) noexcept {
+    std::array<std::size_t, Size> members{};
+    std::size_t members_count = 0;
+    for (auto i = begin; i < end; ++i) {
+      bool is_duplicate = false;
+      for (std::size_t j = 0; j < members_count && !is_duplicate; ++j) {
+        const auto other = members[j];
+        if (hashes[sorted[i]] != hashes[other]) continue;
+        // Different keys with the same hash can not be told apart
+        if (keys[sorted[i]] != keys[other]) return false;
+        // Lookups return the first matching Case
+        is_duplicate = true;
+      }
+      if (!is_duplicate) members[members_count++] = sorted[i];
+    }
+
+    std::array<std::size_t, Size> member_slots{};
+    for (std::uint32_t displacement = 0; displacement < kMaxDisplacement;
+         ++displacement) {
+      bool is_placed = true;
+      for (std::size_t i = 0; i < members_count && is_placed; ++i) {
+        const auto slot = SlotFor(hashes[members[i]], displacement);
+        is_placed = slots_[slot] == kEmpty;
+        for (std::size_t j = 0; j < i && is_placed; ++j) {
+          is_placed = member_slots[j] != slot;
+        }
+        member_slots[i] = slot;
+      }
+      if (!is_placed) continue;
+
+      displacements_[bucket] = displacement;
+      for (std::size_t i = 0; i < members_count; ++i) {
+        slots_[member_slots[i]] = static_cast<SlotValue>(members[i]);
+      }
+      return true;
+    }
+
+    return false;
+  }
+
+  std::uint64_t seed_{0};
+  std::array<std::uint32_t, kBuckets> displacements_{};
+  std::array<SlotValue, kSlots> slots_{};
+  Mode mode_{Mode::kNone};
+};
+
+template <typename First, typename Second, std::size_t Size>
+class CaseCollector final {
+ public:
+  constexpr CaseCollector& Case(First first, Second second) noexcept {
+    UASSERT(size_ < Size);
+    firsts_[size_] = first;
+    seconds_[size_] = second;
+    ++size_;
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetFirsts() const noexcept {
+    return firsts_;
+  }
+
+  constexpr const std::array<Second, Size>& GetSeconds() const noexcept {
+    return seconds_;
+  }
+
+ private:
+  std::array<First, Size> firsts_{};
+  std::array<Second, Size> seconds_{};
+  std::size_t size_{0};
+};
+
+template <typename First, std::size_t Size>
+class CaseCollector<First, void, Size> final {
+ public:
+  constexpr CaseCollector& Case(First first) noexcept {
+    UASSERT(size_ < Size);
+    firsts_[size_] = first;
+    ++size_;
+    return *this;
+  }
+
+  constexpr const std::array<First, Size>& GetFirsts() const noexcept {
+    return firsts_;
+  }
+
+ private:
+  std::array<First, Size> firsts_{};
+  std::size_t size_{0};
+};
+
+// Types that could be stored in the Case columns of a constexpr PerfectHash*
+template <typename T>
+inline constexpr bool kIsPerfectHashColumn =
+    std::is_same_v<T, std::string_view> || std::is_arithmetic_v<T> ||
+    std::is_enum_v<T>;
+
+template <typename First, typename Second, std::size_t Size>
+inline constexpr bool kUsePerfectHashBiMap =
+    Size >= kPerfectHashMinSize &&
+    (std::is_same_v<First, std::string_view> ||
+     std::is_same_v<Second, std::string_view>) &&
+    kIsPerfectHashColumn<First> && kIsPerfectHashColumn<Second>;
+
+template <typename First, std::size_t Size>
+inline constexpr bool kUsePerfectHashSet =
+    Size >= kPerfectHashMinSize && std::is_same_v<First, std::string_view>;
+
+class NoPerfectHash final {
+ public:
+  template <typename BuilderFunc>
+  constexpr explicit NoPerfectHash(const BuilderFunc&) noexcept {}
+};
+
+template <typename First, typename Second, std::size_t Size>
+class PerfectHashBiMap final {
+ public:
+  template <typename BuilderFunc>
+  constexpr explicit PerfectHashBiMap(const BuilderFunc& func) noexcept {
+    const auto cases =
+        func([]() { return CaseCollector<First, Second, Size>{}; });
+    firsts_ = cases.GetFirsts();
+    seconds_ = cases.GetSeconds();
+    first_index_.Build(firsts_);
+    second_index_.Build(seconds_);
+  }
+
+  constexpr bool HasFirstIndex() const noexcept {
+    return first_index_.IsBuilt();
+  }
+
+  constexpr bool HasFirstICaseIndex() const noexcept {
+    return first_index_.IsCaseInsensitive();
+  }
+
+  constexpr bool HasSecondIndex() const noexcept {
+    return second_index_.IsBuilt();
+  }
+
+  constexpr bool HasSecondICaseIndex() const noexcept {
+    return second_index_.IsCaseInsensitive();
+  }
+
+  constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
+    return ToSecond(first_index_.Find(firsts_, value));
+  }
+
+  constexpr std::optional<Second> TryFindICaseByFirst(
+      std::string_view value) const noexcept {
+    return ToSecond(first_index_.FindICase(firsts_, value));
+  }
+
+  constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
+    return ToFirst(second_index_.Find(seconds_, value));
+  }
+
+  constexpr std::optional<First> TryFindICaseBySecond(
+      std::string_view value) const noexcept {
+    return ToFirst(second_index_.FindICase(seconds_, value));
+  }
+
+ private:
+  constexpr std::optional<First> ToFirst(std::size_t index) const noexcept {
+    if (index == kInvalidSize) return std::nullopt;
+    return firsts_[index];
+  }
+
+  constexpr std::optional<Second> ToSecond(std::size_t index) const noexcept {
+    if (index == kInvalidSize) return std::nullopt;
+    return seconds_[index];
+  }
+
+  std::array<First, Size> firsts_{};
+  std::array<Second, Size> seconds_{};
+  PerfectHashIndex<First, Size> first_index_{};
+  PerfectHashIndex<Second, Size> second_index_{};
+};
+
+template <std::size_t Size>
+class PerfectHashSet final {
+ public:
+  template <typename BuilderFunc>
+  constexpr explicit PerfectHashSet(const BuilderFunc& func) noexcept {
+    firsts_ =
+        func([]() { return CaseCollector<std::string_view, void, Size>{}; })
+            .GetFirsts();
+    index_.Build(firsts_);
+  }
+
+  constexpr bool HasIndex() const noexcept { return index_.IsBuilt(); }
+
+  constexpr bool HasICaseIndex() const noexcept {
+    return index_.IsCaseInsensitive();
+  }
+
+  constexpr std::optional<std::size_t> GetIndex(
+      std::string_view value) const noexcept {
+    return ToOptional(index_.Find(firsts_, value));
+  }
+
+  constexpr std::optional<std::size_t> GetIndexICase(
+      std::string_view value) const noexcept {
+    return ToOptional(index_.FindICase(firsts_, value));
+  }
+
+ private:
+  static constexpr std::optional<std::size_t> ToOptional(
+      std::size_t index) noexcept {
+    if (index == kInvalidSize) return std::nullopt;
+    return index;
+  }
+
+  std::array<std::string_view, Size> firsts_{};
+  PerfectHashIndex<std::string_view, Size> index_{};
+};
+
 }  // namespace impl
 
 /// @ingroup userver_universal userver_containers
@@ -493,7 +1032,7 @@ class CaseFirstIndexer final {
 /// utils::TrivialBiMap and utils::TrivialSet are known to outperform
 /// std::unordered_map if:
 /// * there's 32 or less elements in map/set
-/// * or keys are string literals and all of them differ in length.
+/// * or keys are string literals.
 ///
 /// Implementation of string search is \b very efficient due to
 /// modern compilers optimize it to a switch by input string
@@ -503,6 +1042,14 @@ class CaseFirstIndexer final {
 /// The same story with integral or enum mappings - compiler optimizes them
 /// into a switch and it usually takes O(1) to find the match.
 ///
+/// Mappings with 64 or more Case statements over string literals, or with 48
+/// or more string literals of the same length, also get a perfect hash index
+/// that is built in the constructor. Lookups by such string columns stay O(1)
+/// where the switch by length is not effective. Declare such mappings
+/// `constexpr` to build the index at compile time. If all the keys of such a
+/// column are lower case, the same index is used for the case insensitive
+/// lookups.
+///
 /// @snippet universal/src/utils/trivial_map_test.cpp  sample bidir bimap
 ///
 /// For a single value Case statements see @ref utils::TrivialSet.
@@ -521,7 +1068,8 @@ class TrivialBiMap final {
   using MappedTypeFor =
       std::conditional_t<std::is_convertible_v<T, First>, Second, First>;
 
-  constexpr TrivialBiMap(BuilderFunc&& func) noexcept : func_(std::move(func)) {
+  constexpr TrivialBiMap(BuilderFunc&& func) noexcept
+      : func_(std::move(func)), perfect_hash_(func_) {
     static_assert(std::is_empty_v<BuilderFunc>,
                   "Mapping function should not capture variables");
     static_assert(std::is_trivially_copyable_v<First>,
@@ -534,12 +1082,22 @@ class TrivialBiMap final {
   }
 
   constexpr std::optional<Second> TryFindByFirst(First value) const noexcept {
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasFirstIndex()) {
+        return perfect_hash_.TryFindByFirst(value);
+      }
+    }
     return func_(
                [value]() { return impl::SwitchByFirst<First, Second>{value}; })
         .Extract();
   }
 
   constexpr std::optional<First> TryFindBySecond(Second value) const noexcept {
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasSecondIndex()) {
+        return perfect_hash_.TryFindBySecond(value);
+      }
+    }
     return func_(
                [value]() { return impl::SwitchBySecond<First, Second>{value}; })
         .Extract();
@@ -564,6 +1122,11 @@ class TrivialBiMap final {
   /// string literal.
   constexpr std::optional<Second> TryFindICaseByFirst(
       std::string_view value) const noexcept {
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasFirstICaseIndex()) {
+        return perfect_hash_.TryFindICaseByFirst(value);
+      }
+    }
     return func_([value]() { return impl::SwitchByFirstICase<Second>{value}; })
         .Extract();
   }
@@ -574,6 +1137,11 @@ class TrivialBiMap final {
   /// string literal.
   constexpr std::optional<First> TryFindICaseBySecond(
       std::string_view value) const noexcept {
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasSecondICaseIndex()) {
+        return perfect_hash_.TryFindICaseBySecond(value);
+      }
+    }
     return func_([value]() { return impl::SwitchBySecondICase<First>{value}; })
         .Extract();
   }
@@ -644,7 +1212,14 @@ class TrivialBiMap final {
   }
 
  private:
+  static constexpr bool kUsePerfectHash =
+      impl::kUsePerfectHashBiMap<First, Second, TypesPair::kSize>;
+  using PerfectHash = std::conditional_t<
+      kUsePerfectHash, impl::PerfectHashBiMap<First, Second, TypesPair::kSize>,
+      impl::NoPerfectHash>;
+
   const BuilderFunc func_;
+  const PerfectHash perfect_hash_;
 };
 
 template <typename BuilderFunc>
@@ -665,7 +1240,8 @@ class TrivialSet final {
   using First = typename TypesPair::first_type;
   using Second = typename TypesPair::second_type;
 
-  constexpr TrivialSet(BuilderFunc&& func) noexcept : func_(std::move(func)) {
+  constexpr TrivialSet(BuilderFunc&& func) noexcept
+      : func_(std::move(func)), perfect_hash_(func_) {
     static_assert(std::is_empty_v<BuilderFunc>,
                   "Mapping function should not capture variables");
     static_assert(std::is_trivially_copyable_v<First>,
@@ -675,6 +1251,11 @@ class TrivialSet final {
   }
 
   constexpr bool Contains(First value) const noexcept {
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasIndex()) {
+        return perfect_hash_.GetIndex(value).has_value();
+      }
+    }
     return func_(
                [value]() { return impl::SwitchByFirst<First, Second>{value}; })
         .Extract();
@@ -684,6 +1265,11 @@ class TrivialSet final {
     static_assert(std::is_convertible_v<First, std::string_view>,
                   "ContainsICase works only with std::string_view");
 
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasICaseIndex()) {
+        return perfect_hash_.GetIndexICase(value).has_value();
+      }
+    }
     return func_([value]() { return impl::SwitchByFirstICase<void>{value}; })
         .Extract();
   }
@@ -704,11 +1290,22 @@ class TrivialSet final {
   /// Returns index of the value in Case parameters or std::nullopt if no such
   /// value.
   constexpr std::optional<std::size_t> GetIndex(First value) const {
+    if constexpr (kUsePerfectHash) {
+      if (perfect_hash_.HasIndex()) return perfect_hash_.GetIndex(value);
+    }
     return func_([value]() { return impl::CaseFirstIndexer{value}; }).Extract();
   }
 
  private:
+  static constexpr bool kUsePerfectHash =
+      impl::kUsePerfectHashSet<First, TypesPair::kSize>;
+  using PerfectHash =
+      std::conditional_t<kUsePerfectHash,
+                         impl::PerfectHashSet<TypesPair::kSize>,
+                         impl::NoPerfectHash>;
+
   const BuilderFunc func_;
+  const PerfectHash perfect_hash_;
 };
 
 template <typename BuilderFunc>
@@ -720,7 +1317,8 @@ TrivialSet(BuilderFunc) -> TrivialSet<BuilderFunc>;
 /// string, or if `value` is not contained in `map`.
 /// @see @ref scripts/docs/en/userver/formats.md
 template <typename ExceptionType = void, typename Value, typename BuilderFunc>
-auto ParseFromValueString(const Value& value, TrivialBiMap<BuilderFunc> map) {
+auto ParseFromValueString(const Value& value,
+                          const TrivialBiMap<BuilderFunc>& map) {
   if constexpr (!std::is_void_v<ExceptionType>) {
     if (!value.IsString()) {
       throw ExceptionType(fmt::format(
@@ -748,7 +1346,8 @@ namespace impl {
 // contained in `map`, then crashes the service in Debug builds, or throws
 // utils::InvariantError in Release builds.
 template <typename Enum, typename BuilderFunc>
-std::string_view EnumToStringView(Enum value, TrivialBiMap<BuilderFunc> map) {
+std::string_view EnumToStringView(Enum value,
+                                  const TrivialBiMap<BuilderFunc>& map) {
   static_assert(std::is_enum_v<Enum>);
   if (const auto string = map.TryFind(value)) return *string;
 
@@ -775,8 +1374,17 @@ struct TrivialBiMapMultiCaseDispatch {
   template <class Selector>
   constexpr auto operator()(Selector selector) const {
     constexpr auto kKeysSize = std::size(Keys);
-    return impl::TrivialBiMapMultiCase(selector(), Keys, Values,
-                                       std::make_index_sequence<kKeysSize>{});
+    if constexpr (std::is_same_v<Selector, SwitchTypesDetector>) {
+      // Case() of the detector changes the type of the result, so it can not
+      // be chained via the assignment
+      using Detected = decltype(selector().Case(std::data(Keys)[0],
+                                                std::data(Values)[0]));
+      return SwitchTypesDetected<typename Detected::first_type,
+                                 typename Detected::second_type, kKeysSize>{};
+    } else {
+      return impl::TrivialBiMapMultiCase(
+          selector(), Keys, Values, std::make_index_sequence<kKeysSize>{});
+    }
   }
 };
 
@@ -3,6 +3,7 @@
 #include <mutex>
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -16,6 +17,22 @@ namespace {
 // and hide the string size from the optimizer.
 std::string_view MyLaunder(std::string_view value) { return Launder(value); }
 
+// Present and missing keys of kLargeTrivialBiMap
+std::vector<std::string_view> MakeLargeMappingKeys() {
+  return {
+      MyLaunder("accept"),
+      MyLaunder("content-type"),
+      MyLaunder("x-request-id"),
+      MyLaunder("www-authenticate"),
+      MyLaunder("access-control-allow-origin"),
+      MyLaunder("host"),
+      MyLaunder("content-md5"),
+      MyLaunder("traceparent"),
+      MyLaunder("if-none-match"),
+      MyLaunder("user-agent"),
+  };
+}
+
 constexpr utils::TrivialBiMap kSmallTrivialBiMap = [](auto selector) {
   return selector().Case("hello", 1).Case("world", 2).Case("z", 42);
 };
@@ -131,6 +148,171 @@ const auto kHugeUnorderedMapping = std::unordered_map<std::string_view, int>{
     {"aaaaaaaaaaaaaaaa_x9", 42},
 };
 
+// Big enough for the perfect hash index to be used
+constexpr utils::TrivialBiMap kLargeTrivialBiMap = [](auto selector) {
+  return selector()
+      .Case("accept", 0)
+      .Case("accept-charset", 1)
+      .Case("accept-encoding", 2)
+      .Case("accept-language", 3)
+      .Case("accept-ranges", 4)
+      .Case("access-control-allow-credentials", 5)
+      .Case("access-control-allow-headers", 6)
+      .Case("access-control-allow-methods", 7)
+      .Case("access-control-allow-origin", 8)
+      .Case("access-control-expose-headers", 9)
+      .Case("access-control-max-age", 10)
+      .Case("access-control-request-headers", 11)
+      .Case("access-control-request-method", 12)
+      .Case("age", 13)
+      .Case("allow", 14)
+      .Case("authorization", 15)
+      .Case("baggage", 16)
+      .Case("cache-control", 17)
+      .Case("connection", 18)
+      .Case("content-disposition", 19)
+      .Case("content-encoding", 20)
+      .Case("content-language", 21)
+      .Case("content-length", 22)
+      .Case("content-location", 23)
+      .Case("content-range", 24)
+      .Case("content-security-policy", 25)
+      .Case("content-type", 26)
+      .Case("cookie", 27)
+      .Case("date", 28)
+      .Case("etag", 29)
+      .Case("expect", 30)
+      .Case("expires", 31)
+      .Case("forwarded", 32)
+      .Case("from", 33)
+      .Case("host", 34)
+      .Case("if-match", 35)
+      .Case("if-modified-since", 36)
+      .Case("if-none-match", 37)
+      .Case("if-range", 38)
+      .Case("if-unmodified-since", 39)
+      .Case("keep-alive", 40)
+      .Case("last-modified", 41)
+      .Case("link", 42)
+      .Case("location", 43)
+      .Case("max-forwards", 44)
+      .Case("origin", 45)
+      .Case("pragma", 46)
+      .Case("proxy-authorization", 47)
+      .Case("range", 48)
+      .Case("referer", 49)
+      .Case("retry-after", 50)
+      .Case("server", 51)
+      .Case("set-cookie", 52)
+      .Case("strict-transport-security", 53)
+      .Case("te", 54)
+      .Case("traceparent", 55)
+      .Case("tracestate", 56)
+      .Case("transfer-encoding", 57)
+      .Case("upgrade", 58)
+      .Case("user-agent", 59)
+      .Case("vary", 60)
+      .Case("via", 61)
+      .Case("warning", 62)
+      .Case("www-authenticate", 63);
+};
+
+constexpr std::string_view kLargeTrivialBiMapKeys[] = {
+    "accept", "accept-charset", "accept-encoding", "accept-language",
+    "accept-ranges", "access-control-allow-credentials",
+    "access-control-allow-headers", "access-control-allow-methods",
+    "access-control-allow-origin", "access-control-expose-headers",
+    "access-control-max-age", "access-control-request-headers",
+    "access-control-request-method", "age", "allow", "authorization", "baggage",
+    "cache-control", "connection", "content-disposition", "content-encoding",
+    "content-language", "content-length", "content-location", "content-range",
+    "content-security-policy", "content-type", "cookie", "date", "etag",
+    "expect", "expires", "forwarded", "from", "host", "if-match",
+    "if-modified-since", "if-none-match", "if-range", "if-unmodified-since",
+    "keep-alive", "last-modified", "link", "location", "max-forwards", "origin",
+    "pragma", "proxy-authorization", "range", "referer", "retry-after",
+    "server", "set-cookie", "strict-transport-security", "te", "traceparent",
+    "tracestate", "transfer-encoding", "upgrade", "user-agent", "vary", "via",
+    "warning", "www-authenticate",
+};
+
+constexpr int kLargeTrivialBiMapValues[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63,
+};
+
+constexpr auto kLargeTrivialBiMapAlt =
+    utils::MakeTrivialBiMap<kLargeTrivialBiMapKeys, kLargeTrivialBiMapValues>();
+
+const auto kLargeUnorderedMapping = std::unordered_map<std::string_view, int>{
+    {"accept", 0},
+    {"accept-charset", 1},
+    {"accept-encoding", 2},
+    {"accept-language", 3},
+    {"accept-ranges", 4},
+    {"access-control-allow-credentials", 5},
+    {"access-control-allow-headers", 6},
+    {"access-control-allow-methods", 7},
+    {"access-control-allow-origin", 8},
+    {"access-control-expose-headers", 9},
+    {"access-control-max-age", 10},
+    {"access-control-request-headers", 11},
+    {"access-control-request-method", 12},
+    {"age", 13},
+    {"allow", 14},
+    {"authorization", 15},
+    {"baggage", 16},
+    {"cache-control", 17},
+    {"connection", 18},
+    {"content-disposition", 19},
+    {"content-encoding", 20},
+    {"content-language", 21},
+    {"content-length", 22},
+    {"content-location", 23},
+    {"content-range", 24},
+    {"content-security-policy", 25},
+    {"content-type", 26},
+    {"cookie", 27},
+    {"date", 28},
+    {"etag", 29},
+    {"expect", 30},
+    {"expires", 31},
+    {"forwarded", 32},
+    {"from", 33},
+    {"host", 34},
+    {"if-match", 35},
+    {"if-modified-since", 36},
+    {"if-none-match", 37},
+    {"if-range", 38},
+    {"if-unmodified-since", 39},
+    {"keep-alive", 40},
+    {"last-modified", 41},
+    {"link", 42},
+    {"location", 43},
+    {"max-forwards", 44},
+    {"origin", 45},
+    {"pragma", 46},
+    {"proxy-authorization", 47},
+    {"range", 48},
+    {"referer", 49},
+    {"retry-after", 50},
+    {"server", 51},
+    {"set-cookie", 52},
+    {"strict-transport-security", 53},
+    {"te", 54},
+    {"traceparent", 55},
+    {"tracestate", 56},
+    {"transfer-encoding", 57},
+    {"upgrade", 58},
+    {"user-agent", 59},
+    {"vary", 60},
+    {"via", 61},
+    {"warning", 62},
+    {"www-authenticate", 63},
+};
+
 enum class Enum1 {
   C1,
   C2,
@@ -447,6 +629,59 @@ void MappingHugeUnorderedLast(benchmark::State& state) {
 }
 BENCHMARK(MappingHugeUnorderedLast);
 
+void MappingLargeTrivialBiMap(benchmark::State& state) {
+  const auto keys = MakeLargeMappingKeys();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) {
+      benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(key));
+    }
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMap);
+
+void MappingLargeTrivialBiMapZip(benchmark::State& state) {
+  const auto keys = MakeLargeMappingKeys();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) {
+      benchmark::DoNotOptimize(kLargeTrivialBiMapAlt.TryFind(key));
+    }
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMapZip);
+
+void MappingLargeTrivialBiMapICase(benchmark::State& state) {
+  const auto keys = MakeLargeMappingKeys();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) {
+      benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFindICase(key));
+    }
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMapICase);
+
+void MappingLargeTrivialBiMapBySecond(benchmark::State& state) {
+  const auto value = Launder(42);
+
+  for ([[maybe_unused]] auto _ : state) {
+    benchmark::DoNotOptimize(kLargeTrivialBiMap.TryFind(value));
+  }
+}
+BENCHMARK(MappingLargeTrivialBiMapBySecond);
+
+void MappingLargeUnordered(benchmark::State& state) {
+  const auto keys = MakeLargeMappingKeys();
+
+  for ([[maybe_unused]] auto _ : state) {
+    for (const auto key : keys) {
+      benchmark::DoNotOptimize(kLargeUnorderedMapping.find(key));
+    }
+  }
+}
+BENCHMARK(MappingLargeUnordered);
+
 void MappingEnumsTrivialBiMap(benchmark::State& state) {
   const auto enum2 = Launder(Enum2::C7);
 
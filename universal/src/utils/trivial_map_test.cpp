@@ -342,4 +342,238 @@ TEST(TrivialBiMap, GetIndex) {
   EXPECT_EQ(kNames.GetIndex("aba"), std::nullopt);
 }
 
+constexpr utils::TrivialBiMap kContentTypes = [](auto selector) {
+  return selector()
+      .Case("application/json", 0)
+      .Case("application/xml", 1)
+      .Case("application/octet-stream", 2)
+      .Case("application/x-www-form-urlencoded", 3)
+      .Case("application/x-protobuf", 4)
+      .Case("application/grpc", 5)
+      .Case("application/pdf", 6)
+      .Case("application/zip", 7)
+      .Case("application/gzip", 8)
+      .Case("application/javascript", 9)
+      .Case("application/ld+json", 10)
+      .Case("application/msgpack", 11)
+      .Case("application/problem+json", 12)
+      .Case("application/x-ndjson", 13)
+      .Case("application/yaml", 14)
+      .Case("audio/mpeg", 15)
+      .Case("audio/ogg", 16)
+      .Case("audio/wav", 17)
+      .Case("font/woff", 18)
+      .Case("font/woff2", 19)
+      .Case("image/avif", 20)
+      .Case("image/gif", 21)
+      .Case("image/jpeg", 22)
+      .Case("image/png", 23)
+      .Case("image/svg+xml", 24)
+      .Case("image/webp", 25)
+      .Case("multipart/form-data", 26)
+      .Case("multipart/mixed", 27)
+      .Case("text/css", 28)
+      .Case("text/csv", 29)
+      .Case("text/event-stream", 30)
+      .Case("text/html", 31)
+      .Case("text/javascript", 32)
+      .Case("text/plain", 33)
+      .Case("text/xml", 34)
+      .Case("video/mp4", 35)
+      .Case("video/webm", 36)
+      .Case("application/atom+xml", 50)
+      .Case("application/rss+xml", 51)
+      .Case("application/xhtml+xml", 52)
+      .Case("application/wasm", 53)
+      .Case("application/graphql", 54)
+      .Case("application/cbor", 55)
+      .Case("application/jwt", 56)
+      .Case("application/sql", 57)
+      .Case("application/rtf", 58)
+      .Case("application/x-tar", 59)
+      .Case("application/x-7z-compressed", 60)
+      .Case("audio/aac", 61)
+      .Case("audio/flac", 62)
+      .Case("audio/webm", 63)
+      .Case("font/otf", 64)
+      .Case("font/ttf", 65)
+      .Case("image/bmp", 66)
+      .Case("image/tiff", 67)
+      .Case("image/x-icon", 68)
+      .Case("image/heic", 69)
+      .Case("text/markdown", 70)
+      .Case("text/calendar", 71)
+      .Case("text/tab-separated-values", 72)
+      .Case("video/ogg", 73)
+      .Case("video/mpeg", 74)
+      .Case("text/plain", 37)
+      .Case("application/json+legacy", 0);
+};
+
+TEST(TrivialBiMap, PerfectHash) {
+  static_assert(kContentTypes.size() >=
+                utils::impl::kPerfectHashAnyLengthsSize);
+
+  EXPECT_EQ(kContentTypes.TryFind("application/json"), 0);
+  EXPECT_EQ(kContentTypes.TryFind("image/png"), 23);
+  EXPECT_EQ(kContentTypes.TryFind("video/webm"), 36);
+  EXPECT_EQ(kContentTypes.TryFind("video/webm2"), std::nullopt);
+  EXPECT_EQ(kContentTypes.TryFind("Image/PNG"), std::nullopt);
+  EXPECT_EQ(kContentTypes.TryFind(""), std::nullopt);
+
+  EXPECT_EQ(kContentTypes.TryFind("video/mpeg"), 74);
+  EXPECT_EQ(kContentTypes.TryFind(23), "image/png");
+  EXPECT_EQ(kContentTypes.TryFind(42), std::nullopt);
+
+  // First matching Case wins, as for the small maps
+  EXPECT_EQ(kContentTypes.TryFind("text/plain"), 33);
+  EXPECT_EQ(kContentTypes.TryFind(0), "application/json");
+
+  EXPECT_EQ(kContentTypes.TryFindICase("Image/PNG"), 23);
+  EXPECT_EQ(kContentTypes.TryFindICase("APPLICATION/X-WWW-FORM-URLENCODED"),
+            3);
+  EXPECT_EQ(kContentTypes.TryFindICase("Image/PNGs"), std::nullopt);
+}
+
+TEST(TrivialBiMap, PerfectHashConstexpr) {
+  static_assert(kContentTypes.TryFind("text/csv") == 29);
+  static_assert(kContentTypes.TryFind("text/csv2") == std::nullopt);
+  static_assert(kContentTypes.TryFindICase("TEXT/CSV") == 29);
+  static_assert(kContentTypes.TryFind(29) == "text/csv");
+}
+
+// Enough keys of the same length for the perfect hash index
+constexpr std::string_view kManyKeys[] = {
+    "k00", "k01", "k02", "k03", "k04", "k05", "k06", "k07", "k08", "k09",
+    "k10", "k11", "k12", "k13", "k14", "k15", "k16", "k17", "k18", "k19",
+    "k20", "k21", "k22", "k23", "k24", "k25", "k26", "k27", "k28", "k29",
+    "k30", "k31", "k32", "k33", "k34", "k35", "k36", "k37", "k38", "k39",
+    "k40", "k41", "k42", "k43", "k44", "k45", "k46", "k47",
+};
+constexpr std::string_view kManyValues[] = {
+    "v00", "v01", "v02", "v03", "v04", "v05", "v06", "v07", "v08", "v09",
+    "v10", "v11", "v12", "v13", "v14", "v15", "v16", "v17", "v18", "v19",
+    "v20", "v21", "v22", "v23", "v24", "v25", "v26", "v27", "v28", "v29",
+    "v30", "v31", "v32", "v33", "v34", "v35", "v36", "v37", "v38", "v39",
+    "v40", "v41", "v42", "v43", "v44", "v45", "v46", "v47",
+};
+
+TEST(TrivialBiMap, PerfectHashMakeTrivialBiMap) {
+  static constexpr auto kMap =
+      utils::MakeTrivialBiMap<kManyKeys, kManyValues>();
+  static_assert(kMap.size() == std::size(kManyKeys));
+  static_assert(kMap.size() >= utils::impl::kPerfectHashMinSize);
+
+  for (std::size_t i = 0; i < std::size(kManyKeys); ++i) {
+    EXPECT_EQ(kMap.TryFindByFirst(kManyKeys[i]), kManyValues[i]);
+    EXPECT_EQ(kMap.TryFindBySecond(kManyValues[i]), kManyKeys[i]);
+    const auto uppercase_value = "V" + std::string{kManyValues[i].substr(1)};
+    EXPECT_EQ(kMap.TryFindICaseBySecond(uppercase_value), kManyKeys[i]);
+  }
+  EXPECT_EQ(kMap.TryFindByFirst("v00"), std::nullopt);
+  EXPECT_EQ(kMap.TryFindBySecond("k00"), std::nullopt);
+}
+
+TEST(TrivialBiMap, PerfectHashSet) {
+  static constexpr utils::TrivialSet kSet = [](auto selector) {
+    return selector()
+        .Case("a").Case("b").Case("c").Case("d").Case("e").Case("f").Case("g")
+        .Case("h").Case("i").Case("j").Case("k").Case("l").Case("m").Case("n")
+        .Case("o").Case("p").Case("q").Case("r").Case("s").Case("t").Case("u")
+        .Case("v").Case("w").Case("x").Case("y").Case("z").Case("aa").Case("bb")
+        .Case("cc").Case("dd").Case("ee").Case("ff").Case("gg").Case("hh")
+        .Case("ii").Case("jj").Case("kk").Case("ll").Case("mm").Case("nn")
+        .Case("oo").Case("pp").Case("qq").Case("rr").Case("ss").Case("tt")
+        .Case("uu").Case("vv").Case("ww").Case("xx").Case("yy").Case("zz")
+        .Case("ab").Case("bc").Case("cd").Case("de").Case("ef").Case("fg")
+        .Case("gh").Case("hi").Case("ij").Case("jk").Case("kl").Case("lm")
+        .Case("a");
+  };
+  static_assert(kSet.size() >= utils::impl::kPerfectHashAnyLengthsSize);
+
+  EXPECT_TRUE(kSet.Contains("a"));
+  EXPECT_TRUE(kSet.Contains("ff"));
+  EXPECT_TRUE(kSet.Contains("lm"));
+  EXPECT_FALSE(kSet.Contains("gh1"));
+  EXPECT_FALSE(kSet.Contains("ba"));
+  EXPECT_FALSE(kSet.Contains("A"));
+  EXPECT_TRUE(kSet.ContainsICase("A"));
+  EXPECT_TRUE(kSet.ContainsICase("Ff"));
+  EXPECT_FALSE(kSet.ContainsICase("Ba"));
+  EXPECT_EQ(kSet.GetIndex("a"), 0);
+  EXPECT_EQ(kSet.GetIndex("ff"), 31);
+  EXPECT_EQ(kSet.GetIndex("lm"), 63);
+  EXPECT_EQ(kSet.GetIndex("ba"), std::nullopt);
+}
+
+TEST(TrivialBiMap, PerfectHashIndex) {
+  static constexpr std::array<std::string_view, 4> kFewKeys{"foo", "bar",
+                                                            "baz", "foo"};
+  constexpr auto kFewKeysIndex = [] {
+    utils::impl::PerfectHashIndex<std::string_view, 4> index;
+    index.Build(kFewKeys);
+    return index;
+  }();
+  // The switch by length is used for such keys
+  static_assert(!kFewKeysIndex.IsBuilt());
+
+  static constexpr auto kKeys = [] {
+    std::array<std::string_view, std::size(kManyKeys) + 1> keys{};
+    for (std::size_t i = 0; i < std::size(kManyKeys); ++i) {
+      keys[i] = kManyKeys[i];
+    }
+    keys.back() = kManyKeys[1];
+    return keys;
+  }();
+  constexpr auto kIndex = [] {
+    utils::impl::PerfectHashIndex<std::string_view, kKeys.size()> index;
+    index.Build(kKeys);
+    return index;
+  }();
+  static_assert(kIndex.IsBuilt());
+
+  EXPECT_EQ(kIndex.Find(kKeys, "k00"), 0);
+  EXPECT_EQ(kIndex.Find(kKeys, "k01"), 1);
+  EXPECT_EQ(kIndex.Find(kKeys, "k47"), 47);
+  EXPECT_EQ(kIndex.Find(kKeys, "k48"), utils::impl::kInvalidSize);
+  EXPECT_EQ(kIndex.Find(kKeys, "K00"), utils::impl::kInvalidSize);
+  EXPECT_EQ(kIndex.Find(kKeys, ""), utils::impl::kInvalidSize);
+
+  // All the keys are lower case, the same index serves ICase lookups
+  static_assert(kIndex.IsCaseInsensitive());
+  EXPECT_EQ(kIndex.FindICase(kKeys, "K00"), 0);
+  EXPECT_EQ(kIndex.FindICase(kKeys, "K47"), 47);
+  EXPECT_EQ(kIndex.FindICase(kKeys, "K48"), utils::impl::kInvalidSize);
+  EXPECT_EQ(kIndex.FindICase(kKeys, "K0"), utils::impl::kInvalidSize);
+
+  static constexpr auto kMixedCaseKeys = [] {
+    auto keys = kKeys;
+    keys.back() = "K01";
+    return keys;
+  }();
+  constexpr auto kMixedCaseIndex = [] {
+    utils::impl::PerfectHashIndex<std::string_view, kMixedCaseKeys.size()>
+        index;
+    index.Build(kMixedCaseKeys);
+    return index;
+  }();
+  static_assert(kMixedCaseIndex.IsBuilt());
+  static_assert(!kMixedCaseIndex.IsCaseInsensitive());
+
+  EXPECT_EQ(kMixedCaseIndex.Find(kMixedCaseKeys, "k01"), 1);
+  EXPECT_EQ(kMixedCaseIndex.Find(kMixedCaseKeys, "K01"), 48);
+  EXPECT_EQ(kMixedCaseIndex.Find(kMixedCaseKeys, "K00"),
+            utils::impl::kInvalidSize);
+}
+
+TEST(TrivialBiMap, PerfectHashAsciiToLower) {
+  // "AZaz@[`{" and the same letters with the high bit set
+  static_assert(utils::impl::AsciiToLowerWord(0x7b60'5b40'7a61'5a41) ==
+                0x7b60'5b40'7a61'7a61);
+  static_assert(utils::impl::AsciiToLowerWord(0xdac1'dac1'dac1'dac1) ==
+                0xdac1'dac1'dac1'dac1);
+  static_assert(utils::impl::AsciiToLowerWord(0x3039'2d5f'2f2e'5a5a) ==
+                0x3039'2d5f'2f2e'7a7a);
+}
+
 USERVER_NAMESPACE_END